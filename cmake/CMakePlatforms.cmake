@@ -31,15 +31,16 @@ endif()
 # Mark it as processed
 set(_PLATFORMS_ 1)
 
-# Detect target platform
-if(NOT WIN32)
-    message(FATAL_ERROR "This project must be built on Windows.")
+# Detect target platform, only the null graphics backend is available outside of Windows
+if(WIN32)
+	set(PLATFORM_WINDOWS 1)
+	set(PLATFORM_NAME "windows")
+	add_definitions(-DWINDOWSPC)
+else()
+	set(PLATFORM_LINUX 1)
+	set(PLATFORM_NAME "linux")
 endif()
 
-set(PLATFORM_WINDOWS 1)
-set(PLATFORM_NAME "windows")
-add_definitions(-DWINDOWSPC)
-
 message(STATUS "Detected platform: ${PLATFORM_NAME}")
 
 # Set the target architecture
@@ -55,10 +56,12 @@ set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${PROJECT_SOURCE_DIR}/output/bin)
 set(CMAKE_VS_INCLUDE_INSTALL_TO_DEFAULT_BUILD 1)
 
 # Find D3D12 and enable it if possible
-FIND_PACKAGE(D3D12)
-add_definitions(-DD3D12_SUPPORTED)
-add_definitions(-DD3D12_EXPERIMENTAL_COOP_VECTOR)
-add_definitions(-DD3D12_EXPERIMENTAL_SHADER_MODEL)
-if (NOT DEFINED DDX12_SDK_VERSION)
-	add_definitions(-DDX12_SDK_VERSION=717)
+if(PLATFORM_WINDOWS)
+	FIND_PACKAGE(D3D12)
+	add_definitions(-DD3D12_SUPPORTED)
+	add_definitions(-DD3D12_EXPERIMENTAL_COOP_VECTOR)
+	add_definitions(-DD3D12_EXPERIMENTAL_SHADER_MODEL)
+	if (NOT DEFINED DDX12_SDK_VERSION)
+		add_definitions(-DDX12_SDK_VERSION=717)
+	endif()
 endif()
\ No newline at end of file
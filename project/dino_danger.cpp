@@ -6,7 +6,13 @@
  */
 
 // Includes
+#include "network/feature_textures.h"
+#include "network/mlp_int8.h"
+#include "network/mlp_pruning.h"
+#include "network/tsnc_container.h"
 #include "render_pipeline/dino_renderer.h"
+#include "scene/animation_pca.h"
+#include "scene/mesh.h"
 #include "tools/command_line.h"
 
 // System includes
@@ -24,6 +30,92 @@ int CALLBACK main(HINSTANCE hInstance, HINSTANCE, PWSTR, int)
     CommandLineOptions options;
     if (!command_line::parse_args(options, args))
         return -1;
+
+    // Memory vs ALU trade-off of the feature textures, no device required
+    if (options.benchmarkFeatureTextures)
+    {
+        std::vector<CPUMLP> mlpArray;
+        std::vector<CPULatentTexture> latentArray;
+        cpu_decoder::load_network(options.dataDir + "\\models\\michel\\bc1_mip", 1, mlpArray, latentArray);
+        FeatureTextureBenchmark result;
+        feature_textures::benchmark(mlpArray, latentArray, 0, result);
+        printf("Latent space: %.2f MB, %u network + %u filtering MACs per texel, mip 0 decoded in %.2f ms\n", result.latentSize / (1024.0 * 1024.0), result.latentMACs, result.latentFilterMACs, result.latentDecodeTime);
+        printf("Feature textures: %.2f MB, %u network + %u filtering MACs per texel, mip 0 decoded in %.2f ms (baked in %.2f ms)\n", result.featureSize / (1024.0 * 1024.0), result.featureMACs, result.featureFilterMACs, result.featureDecodeTime, result.bakeTime);
+        printf("Max absolute error: %f\n", result.maxError);
+        return 0;
+    }
+
+    // Offline pruning of the hidden layers, the shaders pick up the new dimensions from the files
+    if (!options.pruneOutputDir.empty())
+    {
+        std::vector<CPUMLP> mlpArray;
+        std::vector<CPULatentTexture> latentArray;
+        cpu_decoder::load_network(options.dataDir + "\\models\\michel\\bc1_mip", 1, mlpArray, latentArray);
+        PruningSettings settings;
+        settings.threshold = options.pruneThreshold;
+        settings.maxWidth[0] = settings.maxWidth[1] = options.pruneMaxWidth;
+        PruningReport report;
+        mlp_pruning::prune_network(mlpArray, latentArray, settings, report);
+        mlp_pruning::save_network(options.pruneOutputDir, mlpArray);
+        printf("Hidden layers: %u x %u -> %u x %u (%u and %u dead neurons)\n", report.sourceWidth[0], report.sourceWidth[1], report.prunedWidth[0], report.prunedWidth[1], report.deadNeurons[0], report.deadNeurons[1]);
+        printf("Max absolute error on the sampled texels: %f\n", report.maxError);
+        return 0;
+    }
+
+    // Int8 weights, the renderer switches to the int8 shader path when the mlp_*.bin files are loaded
+    if (!options.exportInt8Dir.empty())
+    {
+        std::vector<CPUMLP> mlpArray;
+        std::vector<CPULatentTexture> latentArray;
+        cpu_decoder::load_network(options.dataDir + "\\models\\michel\\bc1_mip", 1, mlpArray, latentArray);
+        Int8Report report;
+        mlp_int8::quantize_network(mlpArray, latentArray, report);
+        for (uint32_t setIdx = 0; setIdx < (uint32_t)mlpArray.size(); ++setIdx)
+            mlp::save_file((options.exportInt8Dir + "/mlp_" + std::to_string(setIdx) + ".bin").c_str(), mlpArray[setIdx]);
+        printf("MLP files: %.1f KB -> %.1f KB\n", report.floatSize / 1024.0, report.int8Size / 1024.0);
+        printf("Max absolute error against the float network: %f, against the shader evaluation: %f\n", report.maxError, report.maxKernelError);
+        return 0;
+    }
+
+    // Single file container of the model directory, picked up by the renderer when saved as models\michel\michel.tsnc
+    if (!options.exportContainerPath.empty())
+    {
+        tsnc_container::export_model_directory(options.dataDir + "\\models\\michel\\bc1_mip", 1, options.exportContainerPath.c_str(), options.exportHalfWeights);
+        printf("Container written to %s\n", options.exportContainerPath.c_str());
+        return 0;
+    }
+
+    // Quantized mesh animation, picked up by the renderer when saved as geometry\michel.canim
+    if (!options.compressAnimationPath.empty())
+    {
+        MeshAnimation meshAnimation;
+        mesh::import_mesh_animation((options.dataDir + "\\geometry\\michel.anim").c_str(), meshAnimation);
+        CompactMeshAnimation compactAnimation;
+        mesh::compress_animation(meshAnimation, compactAnimation);
+        mesh::export_compact_animation(compactAnimation, options.compressAnimationPath.c_str());
+        const uint64_t sourceSize = meshAnimation.vertexBufferArray.size() * compactAnimation.numVertices * sizeof(VertexData);
+        const uint64_t compactSize = compactAnimation.baseVertices.size() * sizeof(AnimationBaseVertex) + compactAnimation.frameVertices.size() * sizeof(CompactVertex) + compactAnimation.frameBounds.size() * sizeof(AnimationFrameBounds);
+        printf("Vertex data: %.2f MB -> %.2f MB\n", sourceSize / (1024.0 * 1024.0), compactSize / (1024.0 * 1024.0));
+        return 0;
+    }
+
+    // Low rank mesh animation, picked up by the renderer when saved as geometry\michel.pcanim
+    if (!options.pcaAnimationPath.empty())
+    {
+        MeshAnimation meshAnimation;
+        mesh::import_mesh_animation((options.dataDir + "\\geometry\\michel.anim").c_str(), meshAnimation);
+        PCASettings settings;
+        settings.numComponents = options.pcaComponents;
+        PCAMeshAnimation pcaAnimation;
+        PCAReport report;
+        animation_pca::compress_animation(meshAnimation, settings, pcaAnimation, report);
+        animation_pca::export_animation(pcaAnimation, options.pcaAnimationPath.c_str());
+        const uint64_t sourceSize = meshAnimation.vertexBufferArray.size() * pcaAnimation.numVertices * sizeof(VertexData);
+        const uint64_t pcaSize = pcaAnimation.attributes.size() * sizeof(AnimationVertexAttributes) + (pcaAnimation.mean.size() + pcaAnimation.basis.size()) * sizeof(PCAVertex) + pcaAnimation.coefficients.size() * sizeof(float);
+        printf("Vertex data: %.2f MB -> %.2f MB (%u components, %.4f%% of the variance)\n", sourceSize / (1024.0 * 1024.0), pcaSize / (1024.0 * 1024.0), pcaAnimation.numComponents, 100.0 * report.explainedVariance);
+        printf("Max position error: %f, max normal error: %f\n", report.maxPositionError, report.maxNormalError);
+        return 0;
+    }
     
     // Create the renderer
     DinoRenderer renderer;
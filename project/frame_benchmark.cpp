@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Headless frame construction benchmark, records the neural texture passes of the renderer on the null backend.
+// The network is the michel MLP with synthetic latent textures, the benchmark only needs the files tracked outside of LFS.
+
+// Includes
+#include "graphics/backend.h"
+#include "network/tsnc.h"
+#include "network/tsnc_container.h"
+#include "null/null_backend.h"
+#include "render_pipeline/constant_buffers.h"
+#include "render_pipeline/gbuffer_renderer.h"
+#include "render_pipeline/ibl.h"
+#include "render_pipeline/material_renderer.h"
+#include "render_pipeline/tile_classifier.h"
+#include "tools/command_line.h"
+#include "tools/upload_manager.h"
+
+// System includes
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <stdio.h>
+
+// Resolution of the recorded frames
+#define BENCHMARK_WIDTH 1920
+#define BENCHMARK_HEIGHT 1080
+
+// Frames recorded when the command line doesn't specify a count
+#define BENCHMARK_DEFAULT_FRAMES 100
+
+// Writes a container made of the MLP of the first set and random latent textures
+static std::string write_synthetic_container(const std::string& dataDir)
+{
+    std::vector<CPUMLP> mlpArray(1);
+    mlp::load_file((dataDir + "/models/michel/bc1_mip/mlp_0.bin").c_str(), mlpArray[0]);
+
+    // Same layout as the model, two textures at full resolution and two at half resolution
+    std::vector<CPULatentTexture> latentArray(4);
+    std::vector<std::vector<uint8_t>> latentData(4);
+    std::mt19937 generator(0x7e5c);
+    for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+    {
+        CPULatentTexture& texture = latentArray[texIdx];
+        texture.width = 1024 >> (texIdx / 2);
+        texture.height = 1024 >> (texIdx / 2);
+        texture.mipCount = 6;
+        latentData[texIdx].resize(latent_space::mip_offset(texture, texture.mipCount));
+        for (uint8_t& byte : latentData[texIdx])
+            byte = (uint8_t)generator();
+        texture.data = std::span<const uint8_t>(latentData[texIdx].data(), latentData[texIdx].size());
+    }
+
+    const std::string containerPath = (std::filesystem::temp_directory_path() / "frame_benchmark.tsnc").string();
+    tsnc_container::write(containerPath.c_str(), mlpArray, latentArray, false);
+    return containerPath;
+}
+
+int main(int argc, char** argv)
+{
+    // Stack the command line args
+    std::vector<std::string> args;
+    for (int idx = 0; idx < argc; ++idx)
+        args.push_back(argv[idx]);
+
+    // Parse the command line
+    CommandLineOptions options;
+    if (!command_line::parse_args(options, args))
+        return -1;
+    const uint32_t frameCount = options.frameCount != 0 ? options.frameCount : BENCHMARK_DEFAULT_FRAMES;
+    const std::string shaderLibrary = options.dataDir + "/shaders";
+
+    // Graphics components
+    graphics::setup_graphics_api(GraphicsAPI::Null);
+    GraphicsDevice device = graphics::device::create_graphics_device();
+    CommandQueue cmdQueue = graphics::command_queue::create_command_queue(device);
+    CommandBuffer cmdBuffer = graphics::command_buffer::create_command_buffer(device);
+    UploadManager uploadManager;
+    uploadManager.initialize(device, cmdQueue);
+    const bool cooperativeVectors = options.enableCooperative && graphics::device::feature_support(device, GPUFeature::CoopVector);
+
+    // Render targets
+    const uint2 screenSize = { BENCHMARK_WIDTH, BENCHMARK_HEIGHT };
+    const uint2 tileSize = { screenSize.x / 8, screenSize.y / 4 };
+    ConstantBuffer globalCB = graphics::resources::create_constant_buffer(device, sizeof(GlobalCB), ConstantBufferType::Mixed);
+    TextureDescriptor descriptor;
+    descriptor.type = TextureType::Tex2D;
+    descriptor.width = screenSize.x;
+    descriptor.height = screenSize.y;
+    descriptor.depth = 1;
+    descriptor.mipCount = 1;
+    descriptor.isUAV = true;
+    descriptor.format = TextureFormat::R32_UInt;
+    RenderTexture visibilityBuffer = graphics::resources::create_render_texture(device, descriptor);
+    descriptor.format = TextureFormat::R8_UNorm;
+    RenderTexture shadowTexture = graphics::resources::create_render_texture(device, descriptor);
+    descriptor.format = TextureFormat::R16G16B16A16_Float;
+    RenderTexture colorTexture = graphics::resources::create_render_texture(device, descriptor);
+
+    // The geometry isn't read by the null backend, only its bindings are recorded
+    GraphicsBuffer vertexBuffer = graphics::resources::create_graphics_buffer(device, 64, 16);
+    GraphicsBuffer indexBuffer = graphics::resources::create_graphics_buffer(device, 64, 4);
+
+    // Components
+    TSNC tsnc;
+    tsnc.initialize(device, cooperativeVectors, options.featureTextures);
+    const std::string containerPath = write_synthetic_container(options.dataDir);
+    tsnc.reload_network(containerPath, 1);
+    tsnc.reload_shaders(shaderLibrary);
+    GBufferRenderer gbufferRenderer;
+    gbufferRenderer.initialize(device, cooperativeVectors);
+    gbufferRenderer.reload_shaders(shaderLibrary, tsnc.shader_defines());
+    MaterialRenderer materialRenderer;
+    materialRenderer.initialize(device, cooperativeVectors);
+    materialRenderer.reload_shaders(shaderLibrary, tsnc);
+    TileClassifier classifier;
+    classifier.initialize(device, tileSize, 1);
+    classifier.reload_shaders(shaderLibrary);
+    IBL ibl;
+
+    // Upload the network before the first frame
+    tsnc.upload_network(uploadManager);
+    uploadManager.submit();
+
+    // Intermediate buffer of the deferred path
+    const uint32_t numChannels = tsnc.texture_size().z;
+    GraphicsBuffer gbuffer = graphics::resources::create_graphics_buffer(device, screenSize.x * screenSize.y * sizeof(uint16_t) * numChannels, sizeof(uint16_t), GraphicsBufferType::Default);
+
+    // Record the frames
+    null_backend::device::reset_statistics(device);
+    graphics::command_buffer::reset_state_statistics(cmdBuffer);
+    std::vector<double> frameTimes(frameCount);
+    GlobalCB globalCBData = {};
+    for (uint32_t frameIdx = 0; frameIdx < frameCount; ++frameIdx)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        graphics::command_buffer::reset(cmdBuffer);
+
+        // Constant buffer of the frame
+        globalCBData._FrameIndex = frameIdx;
+        graphics::resources::set_constant_buffer(globalCB, (const char*)&globalCBData, sizeof(GlobalCB));
+        graphics::command_buffer::upload_constant_buffer(cmdBuffer, globalCB);
+        graphics::command_buffer::clear_render_texture(cmdBuffer, visibilityBuffer, float4({ 0.0, 0.0, 0.0, 1.0 }));
+
+        // Classification and neural texture evaluation
+        classifier.classify(cmdBuffer, globalCB, visibilityBuffer, vertexBuffer, indexBuffer);
+        if (options.renderingMode == RenderingMode::MaterialPass)
+        {
+            materialRenderer.evaluate_neural_cmp_indirect(cmdBuffer, globalCB, tsnc, vertexBuffer, indexBuffer, ibl, cooperativeVectors, options.filteringMode,
+                visibilityBuffer, shadowTexture, classifier, colorTexture);
+        }
+        else
+        {
+            gbufferRenderer.evaluate_neural_cmp_indirect(cmdBuffer, globalCB, visibilityBuffer, vertexBuffer, indexBuffer, gbuffer, classifier, cooperativeVectors, tsnc, options.filteringMode);
+            gbufferRenderer.lighting_indirect(cmdBuffer, globalCB, vertexBuffer, indexBuffer, ibl, gbuffer, classifier.active_tiles_buffer(), classifier.indirect_buffer(), visibilityBuffer, shadowTexture, colorTexture);
+        }
+
+        // Close and execute
+        graphics::command_buffer::close(cmdBuffer);
+        graphics::command_queue::execute_command_buffer(cmdQueue, cmdBuffer);
+        graphics::command_queue::flush(cmdQueue);
+        uploadManager.retire_batches();
+        frameTimes[frameIdx] = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    // Report
+    const NullBackendStats& stats = null_backend::device::statistics(device);
+    std::sort(frameTimes.begin(), frameTimes.end());
+    printf("Frames: %u (%s, %s)\n", frameCount, options.renderingMode == RenderingMode::MaterialPass ? "material pass" : "gbuffer deferred", cooperativeVectors ? "cooperative vectors" : "no cooperative vectors");
+    printf("Frame time: %.2f us median, %.2f us min, %.2f us max\n", frameTimes[frameCount / 2], frameTimes.front(), frameTimes.back());
+    printf("Recording time: %.2f us per frame\n", stats.recordingTimeUS / frameCount);
+    printf("Per frame: %.1f dispatches, %.1f bindings, %.1f barriers\n", stats.numCommands[(uint32_t)NullCommandType::Dispatch] / (double)frameCount,
+        stats.numCommands[(uint32_t)NullCommandType::Binding] / (double)frameCount, stats.numCommands[(uint32_t)NullCommandType::Barrier] / (double)frameCount);
+    const StateStats& stateStats = graphics::command_buffer::state_statistics(cmdBuffer);
+    printf("Skipped per frame: %.1f pipelines, %.1f root signatures, %.1f tables, %.1f table copies\n", stateStats.skippedPipelineStates / (double)frameCount,
+        stateStats.skippedRootSignatures / (double)frameCount, stateStats.skippedRootTables / (double)frameCount, stateStats.skippedTableCopies / (double)frameCount);
+
+    // Release
+    graphics::resources::destroy_graphics_buffer(gbuffer);
+    classifier.release();
+    materialRenderer.release();
+    gbufferRenderer.release();
+    tsnc.release();
+    std::filesystem::remove(containerPath);
+    graphics::resources::destroy_graphics_buffer(indexBuffer);
+    graphics::resources::destroy_graphics_buffer(vertexBuffer);
+    graphics::resources::destroy_render_texture(colorTexture);
+    graphics::resources::destroy_render_texture(shadowTexture);
+    graphics::resources::destroy_render_texture(visibilityBuffer);
+    graphics::resources::destroy_constant_buffer(globalCB);
+    uploadManager.release();
+    graphics::command_buffer::destroy_command_buffer(cmdBuffer);
+    graphics::command_queue::destroy_command_queue(cmdQueue);
+    graphics::device::destroy_graphics_device(device);
+    return 0;
+}
@@ -11,6 +11,7 @@
 // SDK includes
 #include "graphics/descriptors.h"
 #include "graphics/event_collector.h"
+#include "graphics/state_tracker.h"
 
 namespace d3d12
 {
@@ -102,6 +103,10 @@ namespace d3d12
         void reset(CommandBuffer commandBuffer);
         void close(CommandBuffer commandBuffer);
 
+        // Redundant state statistics
+        const StateStats& state_statistics(CommandBuffer commandBuffer);
+        void reset_state_statistics(CommandBuffer commandBuffer);
+
 #pragma region Render Texture
         void clear_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture, const float4& color);
         void clear_depth_texture(CommandBuffer commandBuffer, RenderTexture depthTexture, float value);
@@ -146,12 +151,12 @@ namespace d3d12
 
 #pragma region Compute Shader
         // Bindings
-        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, ConstantBuffer constantBuffer);
-        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, GraphicsBuffer graphicsBuffer);
-        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Texture texture, uint32_t mipLevel = 0);
-        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, RenderTexture texture);
-        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Sampler sampler);
-        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, TopLevelAS rtas);
+        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, ConstantBuffer constantBuffer);
+        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, GraphicsBuffer graphicsBuffer);
+        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Texture texture, uint32_t mipLevel = 0);
+        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, RenderTexture texture);
+        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Sampler sampler);
+        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, TopLevelAS rtas);
 
         // Dispatch
         void dispatch(CommandBuffer commandBuffer, ComputeShader computeShader, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ);
@@ -163,12 +168,12 @@ namespace d3d12
         void set_viewport(CommandBuffer commandBuffer, int32_t offsetX, int32_t offsetY, uint32_t width, uint32_t height);
 
         // Bindings
-        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, ConstantBuffer constantBuffer);
-        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset = 0);
-        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Texture texture);
-        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, RenderTexture renderTexture);
-        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Sampler sampler);
-        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, TopLevelAS rtas);
+        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, ConstantBuffer constantBuffer);
+        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset = 0);
+        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Texture texture);
+        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, RenderTexture renderTexture);
+        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Sampler sampler);
+        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, TopLevelAS rtas);
 
         // Draw
         void draw_indexed(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive = DrawPrimitive::Triangle);
@@ -274,6 +279,9 @@ namespace d3d12
         // Value operations sync
         void set_value(Fence fence, uint64_t value);
         uint64_t get_value(Fence fence);
+
+        // Block the CPU until the fence reaches the value
+        void wait_value(Fence fence, uint64_t value);
     }
 
     namespace imgui
@@ -9,6 +9,8 @@
 
 // SDK includes
 #include "graphics/descriptors.h"
+#include "dx12/dx12_backend.h"
+#include "graphics/state_tracker.h"
 #include "tools/security.h"
 
 // DX12 includes
@@ -21,13 +23,16 @@
 // System includes
 #include <vector>
 #include <string>
-#include <map>
+#include <deque>
 
 namespace d3d12
 {
 	// Global DX12 Constants
 	#define DX12_NUM_FRAMES 2
 	#define DX12_CB_ALIGNEMENT_SIZE 256
+	#define DX12_VIEW_HEAP_SIZE 4096
+	#define DX12_DESCRIPTOR_RING_SIZE 65536
+	#define DX12_SAMPLER_RING_SIZE 2048
 
 	// Forward declarations
 	struct DX12GraphicsDevice;
@@ -77,6 +82,32 @@ namespace d3d12
 		ProfilingScopeT,
 	};
 
+	struct DX12DescriptorRing
+	{
+		// Shader visible heap
+		ID3D12DescriptorHeap* descriptorHeap = nullptr;
+		D3D12_CPU_DESCRIPTOR_HANDLE cpuStart = {};
+		D3D12_GPU_DESCRIPTOR_HANDLE gpuStart = {};
+
+		// Number of descriptors in the heap
+		uint32_t capacity = 0;
+
+		// Monotonic counters of the allocated and recycled descriptors
+		uint64_t head = 0;
+		uint64_t tail = 0;
+	};
+
+	struct DX12RingSubmission
+	{
+		// Heads of the rings when the submission was executed
+		uint64_t csuHead = 0;
+		uint64_t samplerHead = 0;
+
+		// Fence signaled when the submission is done
+		ID3D12Fence* fence = nullptr;
+		uint64_t fenceValue = 0;
+	};
+
 	struct DX12GraphicsDevice
 	{
 #if defined(_DEBUG)
@@ -110,6 +141,20 @@ namespace d3d12
 		// Tracks if the device was created with the debug option
 		bool debugDevice = false;
 
+		// Non shader visible heaps where the views of the resources are created once and copied at bind time
+		std::vector<ID3D12DescriptorHeap*> viewHeaps;
+		std::vector<uint32_t> freeViews;
+		uint32_t numViews = 0;
+		uint64_t nextViewID = 1;
+
+		// Identifier of the next command buffer recording
+		uint64_t nextRecordingID = 1;
+
+		// Shader visible heaps, the tables of every dispatch and draw are suballocated from them
+		DX12DescriptorRing csuRing = {};
+		DX12DescriptorRing samplerRing = {};
+		std::deque<DX12RingSubmission> ringSubmissions;
+
 		// Additional stats
 		uint64_t allocatedMemory = 0;
 		uint32_t allocatedTextures = 0;
@@ -173,6 +218,18 @@ namespace d3d12
 		DX12CommandSubQueue copySubQueue = {};
 	};
 
+	struct DX12ResourceView
+	{
+		// Slot in the view heaps of the device
+		uint32_t index = UINT32_MAX;
+
+		// Unique identifier, the slots are recycled
+		uint64_t id = 0;
+
+		// CPU descriptor of the view
+		D3D12_CPU_DESCRIPTOR_HANDLE handle = {};
+	};
+
 	struct DX12Texture
 	{
 #if defined(_DEBUG)
@@ -199,6 +256,10 @@ namespace d3d12
 		uint32_t alignment = 0;
 		TextureType type = TextureType::Tex2D;
 		bool isDepth = false;
+
+		// Cached views, created on first bind
+		DX12ResourceView srv;
+		std::vector<DX12ResourceView> uavs;
 	};
 
 	struct DX12RenderTexture
@@ -264,6 +325,9 @@ namespace d3d12
 		// Command buffer type
 		D3D12_COMMAND_LIST_TYPE type = D3D12_COMMAND_LIST_TYPE_DIRECT;
 
+		// State set on the command list and current recording, the redundant calls are skipped
+		CommandStateTracker state = CommandStateTracker();
+
 		// Grab the current command allocator
 		inline ID3D12CommandAllocator* cmdAlloc()
 		{
@@ -290,6 +354,9 @@ namespace d3d12
 
 		// Actual resource
 		SamplerDescriptor resource = {};
+
+		// Identifier used to skip the redundant copies, never reused
+		uint64_t id = 0;
 	};
 
 	struct DX12DescriptorHeap
@@ -300,17 +367,26 @@ namespace d3d12
 		// Type of this heap
 		D3D12_DESCRIPTOR_HEAP_TYPE type;
 
-		// GPU Handles for every resource type
-		D3D12_GPU_DESCRIPTOR_HANDLE srvGPU;
-		D3D12_GPU_DESCRIPTOR_HANDLE uavGPU;
-		D3D12_GPU_DESCRIPTOR_HANDLE cbvGPU;
-		D3D12_GPU_DESCRIPTOR_HANDLE samplerGPU;
-
 		// CPU Handles for every resource type
 		D3D12_CPU_DESCRIPTOR_HANDLE srvCPU;
 		D3D12_CPU_DESCRIPTOR_HANDLE uavCPU;
 		D3D12_CPU_DESCRIPTOR_HANDLE cbvCPU;
 		D3D12_CPU_DESCRIPTOR_HANDLE samplerCPU;
+
+		// Identifier of the cached view copied in each descriptor, 0 if unknown
+		std::vector<uint64_t> boundViews;
+
+		// Tracks if a descriptor changed since the heap was last copied in the descriptor ring
+		bool dirty = true;
+	};
+
+	struct DX12DescriptorTables
+	{
+		// Ring handles of the SRV, UAV, CBV and sampler tables
+		D3D12_GPU_DESCRIPTOR_HANDLE handles[4] = {};
+
+		// Recording the ring ranges were allocated for
+		uint64_t recordingID = 0;
 	};
 
 	struct DX12RootSignature
@@ -327,6 +403,7 @@ namespace d3d12
 
 	struct DX12Binding
 	{
+		uint32_t nameHash;
 		uint8_t type;
 		uint8_t slot;
 	};
@@ -353,14 +430,15 @@ namespace d3d12
 		uint32_t uavCount = 0;
 		uint32_t samplerCount = 0;
 
-		// Reflection data
-		std::map<std::string, DX12Binding> bindings;
+		// Reflection data, sorted by name hash
+		std::vector<DX12Binding> bindings;
+
+		// Non shader visible heaps where the bindings are staged until the next dispatch or draw
+		DX12DescriptorHeap CSUHeap = {};
+		DX12DescriptorHeap samplerHeap = {};
 
-		// Set of descriptor heaps that can be used for this compute shader
-		uint32_t cmdBatchIndex = 0;
-		uint32_t nextUsableHeap = 0;
-		std::vector<DX12DescriptorHeap> CSUHeaps;
-		std::vector<DX12DescriptorHeap> samplerHeaps;
+		// Tables of the last dispatch or draw
+		DX12DescriptorTables tables = {};
 
 		// Command signature for indirect dispatch
 		ID3D12CommandSignature* commandSignature = nullptr;
@@ -397,14 +475,15 @@ namespace d3d12
 		uint32_t cbvCount = 0;
 		uint32_t samplerCount = 0;
 
-		// Reflection data
-		std::map<std::string, DX12Binding> bindings;
+		// Reflection data, sorted by name hash
+		std::vector<DX12Binding> bindings;
 
-		// Set of descriptor heaps that can be used for this compute shader
-		uint32_t cmdBatchIndex = 0;
-		uint32_t nextUsableHeap = 0;
-		std::vector<DX12DescriptorHeap> CSUHeaps;
-		std::vector<DX12DescriptorHeap> samplerHeaps;
+		// Non shader visible heaps where the bindings are staged until the next dispatch or draw
+		DX12DescriptorHeap CSUHeap = {};
+		DX12DescriptorHeap samplerHeap = {};
+
+		// Tables of the last dispatch or draw
+		DX12DescriptorTables tables = {};
 
 		// Stencil ref
 		uint8_t stencilRef = 0;
@@ -437,6 +516,11 @@ namespace d3d12
 		uint64_t bufferSize = 0;
 		uint32_t elementSize = 0;
 		GraphicsBufferType heapType = GraphicsBufferType::Default;
+
+		// Cached views of the whole buffer, created on first bind
+		DX12ResourceView srv;
+		DX12ResourceView uav;
+		DX12ResourceView cbv;
 	};
 
 	struct DX12Query
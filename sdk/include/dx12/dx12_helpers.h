@@ -28,7 +28,7 @@ namespace d3d12
     D3D12_COMMAND_QUEUE_PRIORITY convert_command_queue_priority(CommandQueuePriority priority);
 
     // Descriptor heaps
-    ID3D12DescriptorHeap* create_descriptor_heap_internal(DX12GraphicsDevice* deviceI, uint32_t numDescriptors, uint32_t opaqueType);
+    ID3D12DescriptorHeap* create_descriptor_heap_internal(DX12GraphicsDevice* deviceI, uint32_t numDescriptors, uint32_t opaqueType, bool shaderVisible);
     DX12DescriptorHeap create_descriptor_heap_suc(DX12GraphicsDevice* deviceI, uint32_t srvCount, uint32_t uavCount, uint32_t cbvCount);
     DX12DescriptorHeap create_descriptor_heap_sampler(DX12GraphicsDevice* deviceI, uint32_t samplerCount);
     void destroy_descriptor_heap(DX12DescriptorHeap& descriptorHeap);
@@ -38,14 +38,36 @@ namespace d3d12
     void destroy_root_signature(DX12RootSignature* rootSignature);
 
     // Binding
-    void query_bindings(IDxcBlob* blob, uint32_t& cbvCount, uint32_t& srvCount, uint32_t& uavCount, uint32_t& samplerCount, std::map<std::string, DX12Binding>& outBindings);
-    bool request_binding(const std::map<std::string, DX12Binding>& bindings, const char* name, DX12Binding& outBind);
+    void query_bindings(IDxcBlob* blob, uint32_t& cbvCount, uint32_t& srvCount, uint32_t& uavCount, uint32_t& samplerCount, std::vector<DX12Binding>& outBindings);
+    bool request_binding(const std::vector<DX12Binding>& bindings, BindingSlot slot, DX12Binding& outBind);
 
-    // Compute shaders
-    void validate_compute_shader_heap(DX12ComputeShader* computeShader, uint32_t cmdBatchIndex);
+    // Resource views
+    void create_buffer_srv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer, uint64_t firstElement, D3D12_CPU_DESCRIPTOR_HANDLE handle);
+    void create_buffer_uav(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer, uint64_t firstElement, D3D12_CPU_DESCRIPTOR_HANDLE handle);
+    void create_buffer_cbv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer, D3D12_CPU_DESCRIPTOR_HANDLE handle);
+    void create_texture_srv(DX12GraphicsDevice* deviceI, DX12Texture* texture, D3D12_CPU_DESCRIPTOR_HANDLE handle);
+    void create_texture_uav(DX12GraphicsDevice* deviceI, DX12Texture* texture, uint32_t mipLevel, D3D12_CPU_DESCRIPTOR_HANDLE handle);
 
-    // Graphics pipeline
-    void validate_graphics_pipeline_heap(DX12GraphicsPipeline* graphicsPipeline, uint32_t cmdBatchIndex);
+    // View cache
+    const DX12ResourceView& buffer_srv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer);
+    const DX12ResourceView& buffer_uav(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer);
+    const DX12ResourceView& buffer_cbv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer);
+    const DX12ResourceView& texture_srv(DX12GraphicsDevice* deviceI, DX12Texture* texture);
+    const DX12ResourceView& texture_uav(DX12GraphicsDevice* deviceI, DX12Texture* texture, uint32_t mipLevel);
+    void release_resource_view(DX12GraphicsDevice* deviceI, DX12ResourceView& view);
+    void destroy_view_heaps(DX12GraphicsDevice* deviceI);
+    void copy_resource_view(DX12GraphicsDevice* deviceI, DX12DescriptorHeap& heap, D3D12_CPU_DESCRIPTOR_HANDLE destination, const DX12ResourceView& view);
+    void invalidate_resource_view(DX12GraphicsDevice* deviceI, DX12DescriptorHeap& heap, D3D12_CPU_DESCRIPTOR_HANDLE destination);
+
+    // Descriptor rings
+    void create_descriptor_rings(DX12GraphicsDevice* deviceI);
+    void destroy_descriptor_rings(DX12GraphicsDevice* deviceI);
+    void track_descriptor_rings(DX12GraphicsDevice* deviceI, ID3D12Fence* fence, uint64_t fenceValue);
+    void flush_descriptor_rings(DX12GraphicsDevice* deviceI);
+
+    // Redundant state elimination
+    void bind_compute_shader(DX12CommandBuffer* cmdI, DX12ComputeShader* computeShader);
+    void bind_graphics_pipeline(DX12CommandBuffer* cmdI, DX12GraphicsPipeline* graphicsPipeline);
 
     // Graphics device
     uint32_t vendor_to_vendor_id(GPUVendor vendor);
@@ -10,6 +10,7 @@
 // SDK includes
 #include "graphics/descriptors.h"
 #include "graphics/event_collector.h"
+#include "graphics/state_tracker.h"
 
 namespace graphics
 {
@@ -64,6 +65,10 @@ namespace graphics
         void reset(CommandBuffer commandBuffer);
         void close(CommandBuffer commandBuffer);
 
+        // Redundant state statistics
+        const StateStats& state_statistics(CommandBuffer commandBuffer);
+        void reset_state_statistics(CommandBuffer commandBuffer);
+
 #pragma region Render Texture
         void clear_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture, const float4& color);
         void clear_depth_texture(CommandBuffer commandBuffer, RenderTexture depthTexture, float value);
@@ -115,6 +120,14 @@ namespace graphics
         void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Sampler sampler);
         void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, TopLevelAS rtas);
 
+        // Bindings with a slot hashed at compile time, see binding_slot
+        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, ConstantBuffer constantBuffer);
+        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, GraphicsBuffer graphicsBuffer);
+        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Texture texture, uint32_t mipLevel = 0);
+        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, RenderTexture texture);
+        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Sampler sampler);
+        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, TopLevelAS rtas);
+
         // Dispatch
         void dispatch(CommandBuffer commandBuffer, ComputeShader computeShader, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ);
         void dispatch_indirect(CommandBuffer commandBuffer, ComputeShader computeShader, GraphicsBuffer indirectBuffer, uint32_t offset = 0);
@@ -132,6 +145,14 @@ namespace graphics
         void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Sampler sampler);
         void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, TopLevelAS rtas);
 
+        // Bindings with a slot hashed at compile time, see binding_slot
+        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, ConstantBuffer constantBuffer);
+        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset = 0);
+        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Texture texture);
+        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, RenderTexture renderTexture);
+        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Sampler sampler);
+        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, TopLevelAS rtas);
+
         // Draw
         void draw_indexed(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive = DrawPrimitive::Triangle);
         void draw_procedural(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive = DrawPrimitive::Triangle);
@@ -266,6 +287,20 @@ namespace graphics
         uint64_t get_duration_us(ProfilingScope profilingScope, CommandQueue cmdQ, CommandBufferType type = CommandBufferType::Default);
     }
 
+    namespace fence
+    {
+        // Creation and destruction
+        Fence create_fence(GraphicsDevice graphicsDevice, uint64_t initialValue = 0);
+        void destroy_fence(Fence fence);
+
+        // Value operations
+        void set_value(Fence fence, uint64_t value);
+        uint64_t get_value(Fence fence);
+
+        // Block the CPU until the fence reaches the value
+        void wait_value(Fence fence, uint64_t value);
+    }
+
     namespace imgui
     {
         // Init & Dst
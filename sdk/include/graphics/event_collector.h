@@ -9,6 +9,7 @@
 
 // System includes
 #include <queue>
+#include <stdint.h>
 
 enum class MouseButton
 {
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// System includes
+#include <stdint.h>
+
+// Maximal number of descriptor tables of a root signature (SRV, UAV, CBV and sampler)
+#define STATE_TRACKER_MAX_TABLES 4
+
+// Calls skipped by a command buffer because the state was already set on it
+struct StateStats
+{
+    uint64_t skippedPipelineStates = 0;
+    uint64_t skippedRootSignatures = 0;
+    uint64_t skippedDescriptorHeaps = 0;
+    uint64_t skippedRootTables = 0;
+
+    // Dispatches and draws that reused the tables of the previous one instead of copying them in the descriptor ring
+    uint64_t skippedTableCopies = 0;
+};
+
+// Root signatures and tables are set separately for the compute and graphics work
+enum class StateBindPoint
+{
+    Compute = 0,
+    Graphics,
+    Count
+};
+
+// Shadow of the state set on a command buffer, the objects are identified by backend specific non-zero values
+struct CommandStateTracker
+{
+    // Identifier of the current recording, unique across the command buffers of a device
+    uint64_t recordingID = 0;
+
+    // State set on the command buffer (0 = unknown)
+    bool heapsSet = false;
+    uint64_t pipelineState = 0;
+    uint64_t rootSignatures[(uint32_t)StateBindPoint::Count] = {};
+    uint64_t rootTables[(uint32_t)StateBindPoint::Count][STATE_TRACKER_MAX_TABLES] = {};
+
+    // Skipped calls since the last statistics reset
+    StateStats stats = StateStats();
+};
+
+// The functions return true when the backend has to issue the call and update the shadow state accordingly
+namespace state_tracker
+{
+    // New recording, nothing is set on the command buffer
+    void begin_recording(CommandStateTracker& tracker, uint64_t recordingID);
+
+    // The state was replaced outside of the tracker (e.g. by the imgui pass)
+    void invalidate(CommandStateTracker& tracker);
+
+    // Pipeline state, shared by the bind points
+    bool set_pipeline_state(CommandStateTracker& tracker, uint64_t pipelineState);
+
+    // Changing the root signature invalidates the tables of the bind point
+    bool set_root_signature(CommandStateTracker& tracker, StateBindPoint bindPoint, uint64_t rootSignature);
+
+    // Shader visible heaps, only set once per recording. Setting them invalidates every table.
+    bool set_descriptor_heaps(CommandStateTracker& tracker);
+
+    // The tables copied earlier in the same recording can be reused as long as none of their descriptors changed (dirty).
+    // When a copy is required, tablesRecordingID is moved to the current recording.
+    bool copy_descriptor_tables(CommandStateTracker& tracker, uint64_t& tablesRecordingID, bool dirty);
+
+    // Descriptor table at a root index of the bind point
+    bool set_root_table(CommandStateTracker& tracker, StateBindPoint bindPoint, uint32_t rootIndex, uint64_t table);
+}
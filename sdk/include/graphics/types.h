@@ -37,9 +37,32 @@ typedef uint64_t BottomLevelAS;
 // Profiling
 typedef uint64_t ProfilingScope;
 
+// Shader binding, identified by the hash of its name so that setting it doesn't build any string
+struct BindingSlot
+{
+	uint32_t hash = 0;
+};
+
+// FNV-1a hash of a binding name
+constexpr uint32_t binding_hash(const char* name)
+{
+	uint32_t hash = 2166136261u;
+	while (*name != '\0')
+		hash = (hash ^ (uint8_t)*name++) * 16777619u;
+	return hash;
+}
+
+// Binding slot of a name known at compile time
+consteval BindingSlot binding_slot(const char* name)
+{
+	return { binding_hash(name) };
+}
+
 enum class GraphicsAPI
 {
 	DX12 = 0,
+	// Headless backend in host memory, nothing is executed on a GPU
+	Null,
 	Count
 };
 
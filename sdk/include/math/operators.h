@@ -21,6 +21,11 @@
 	float lerp(const float& v0, const float& v1, float f);
 #pragma endregion
 
+#pragma region half
+	float16_t to_half(float v);
+	float to_float(float16_t v);
+#pragma endregion
+
 #pragma region float2
 	float2 lerp(const float2& v0, const float2& v1, float f);
 	float2 min(const float2& v0, const float2& v1);
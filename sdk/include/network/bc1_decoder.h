@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// System includes
+#include <stdint.h>
+
+// Floats written per decoded block: the R, G and B planes of the 16 texels (row major inside the block)
+#define BC1_DECODED_BLOCK_SIZE 48
+
+// Instruction set used by the block decoder
+enum class BC1DecodeLevel
+{
+	Scalar = 0,
+	SSE42,
+	AVX2,
+	Count
+};
+
+namespace bc1_decoder
+{
+	// Best level supported by the host
+	BC1DecodeLevel best_decode_level();
+
+	// Decode blockCount consecutive 8 byte blocks to BC1_DECODED_BLOCK_SIZE floats each.
+	// Every level produces the same bits as latent_space::decode_bc1_texel.
+	void decode_blocks(const uint8_t* blocks, uint64_t blockCount, float* output, BC1DecodeLevel level);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/latent_space.h"
+#include "network/mlp.h"
+#include "network/mlp_fp16.h"
+
+// System includes
+#include <string>
+#include <vector>
+
+// Decoded texture set, channels are interleaved per texel
+struct DecodedTextureSet
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t channelCount = 0;
+	std::vector<float> data;
+};
+
+// Half precision version of the decoded texture set
+struct DecodedTextureSetHalf
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t channelCount = 0;
+	std::vector<float16_t> data;
+};
+
+namespace cpu_decoder
+{
+	// Load the MLPs and latent textures of a model directory or a .tsnc container (numSets is then ignored) without a graphics device
+	void load_network(const std::string& modelDir, uint32_t numSets, std::vector<CPUMLP>& mlpArray, std::vector<CPULatentTexture>& latentArray);
+
+	// Size of the scratch memory required by evaluate_mlp (in floats)
+	uint32_t scratch_size(const CPUMLP& mlp);
+
+	// Equivalent of sample_latent_space_bc1, fills the 12 latent entries of the MLP input
+	void sample_latent_space(const CPULatentTexture* latentSet, float2 uv, float2 uvDX, float2 uvDY, float* input);
+	void sample_latent_space(const DecodedLatentTexture* latentSet, float2 uv, float2 uvDX, float2 uvDY, float* input);
+
+	// Equivalent of the non cooperative vector mlp_evaluation (fp32 accumulation)
+	void evaluate_mlp(const CPUMLP& mlp, const float* input, float* output, float* scratch);
+
+	// Decode a full texture set at a given mip, numThreads = 0 uses all the cores
+	void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, DecodedTextureSet& output, uint32_t numThreads = 0);
+	void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, DecodedTextureSetHalf& output, uint32_t numThreads = 0);
+
+	// Decode the channels selected by channelMask (bit c for channel c), the output only holds those channels in increasing order
+	void decode_channels(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, uint32_t channelMask, DecodedTextureSet& output, uint32_t numThreads = 0);
+	void decode_channels(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, uint32_t channelMask, DecodedTextureSetHalf& output, uint32_t numThreads = 0);
+
+	// Decode a full texture set with a bit accurate emulation of the fp16 shader path (reference for golden images)
+	void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, FP16MulAdd mode, DecodedTextureSetHalf& output, uint32_t numThreads = 0);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/cpu_decoder.h"
+
+// System includes
+#include <vector>
+
+// Product of the first layer's weights with the texels of one latent texture (one per latent texture)
+// The first layer being linear, filtering the products is equivalent to multiplying the filtered latents
+struct CPUFeatureTexture
+{
+	// Dimensions of the first mip (same as the source latent texture)
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	// Number of usable mips
+	uint32_t mipCount = 0;
+
+	// Number of features per texel (output dimension of the first layer)
+	uint32_t featureCount = 0;
+
+	// UV offset applied before sampling
+	float2 uvOffset = { 0.0f, 0.0f };
+
+	// Features of every mip, stored one after the other ([mip][y][x][feature])
+	std::vector<float16_t> data;
+};
+
+// Cost of the feature texture mode against the latent space for a texture set
+struct FeatureTextureBenchmark
+{
+	// Memory footprint (bytes, all mips)
+	uint64_t latentSize = 0;
+	uint64_t featureSize = 0;
+
+	// Network multiply-adds per texel, the filtering isn't included
+	uint32_t latentMACs = 0;
+	uint32_t featureMACs = 0;
+
+	// Filtering multiply-adds per texel (trilinear taps x filtered channels over the 4 textures)
+	uint32_t latentFilterMACs = 0;
+	uint32_t featureFilterMACs = 0;
+
+	// Duration of the bake and of a full mip 0 decode (ms)
+	double bakeTime = 0.0;
+	double latentDecodeTime = 0.0;
+	double featureDecodeTime = 0.0;
+
+	// Largest absolute difference between both decodes
+	float maxError = 0.0f;
+};
+
+namespace feature_textures
+{
+	// Offset of a mip inside the data buffer (in float16_t)
+	uint64_t mip_offset(const CPUFeatureTexture& texture, uint32_t mipIdx);
+
+	// Multiply every texel of the latent texture texIdx (0 to 3) by the matching rows of the first layer
+	void bake(const CPUMLP& mlp, const CPULatentTexture& latentTex, uint32_t texIdx, CPUFeatureTexture& featureTex);
+
+	// Bake the 4 feature textures of every set
+	void bake_network(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, std::vector<CPUFeatureTexture>& featureArray);
+
+	// Equivalent of SampleGrad with bc1_linear_clamp_sampler, accumulated into output (featureCount entries)
+	void sample_grad(const CPUFeatureTexture& texture, float2 uv, float2 uvDX, float2 uvDY, float* output);
+
+	// Equivalent of sample_feature_textures, fills the mlp0Width entries of the first layer's output (after RELU)
+	void evaluate_first_layer(const CPUMLP& mlp, const CPUFeatureTexture* featureSet, float2 uv, float2 uvDX, float2 uvDY, float lodInput, float* hidden);
+
+	// Decode a full texture set at a given mip from the feature textures, numThreads = 0 uses all the cores
+	void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPUFeatureTexture>& featureArray, uint32_t setIdx, uint32_t mipIdx, DecodedTextureSet& output, uint32_t numThreads = 0);
+
+	// Compare the memory and ALU cost of both modes and their output on a texture set
+	void benchmark(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, FeatureTextureBenchmark& result, uint32_t numThreads = 0);
+}
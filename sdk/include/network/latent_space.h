@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Includes
+#include "math/types.h"
+#include "tools/file_view.h"
+
+// System includes
+#include <memory>
+#include <span>
+#include <vector>
+
+// CPU representation of a BC1 latent space texture
+struct CPULatentTexture
+{
+	// Dimensions of the first mip
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	// Number of usable mips
+	uint32_t mipCount = 0;
+
+	// UV offset applied before sampling
+	float2 uvOffset = { 0.0f, 0.0f };
+
+	// BC1 blocks of every mip, stored one after the other (points inside file)
+	std::span<const uint8_t> data;
+
+	// Mapping of the source file, shared by the copies of the texture
+	std::shared_ptr<const FileView> file;
+};
+
+// Latent texture with every mip decoded to floats, blocks keep their order (see bc1_decoder::decode_blocks for their layout)
+struct DecodedLatentTexture
+{
+	// Dimensions of the first mip
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	// Number of usable mips
+	uint32_t mipCount = 0;
+
+	// UV offset applied before sampling
+	float2 uvOffset = { 0.0f, 0.0f };
+
+	// Decoded blocks of every mip, stored one after the other
+	std::vector<float> data;
+};
+
+namespace latent_space
+{
+	// Map a packed BC1 latent texture from disk (same format as load_bc1_to_graphics_buffer), the blocks are not copied
+	void load_bc1(const char* texturePath, CPULatentTexture& texture);
+
+	// Size and offset of a mip inside the data buffer
+	uint64_t mip_size(const CPULatentTexture& texture, uint32_t mipIdx);
+	uint64_t mip_offset(const CPULatentTexture& texture, uint32_t mipIdx);
+
+	// Decodes a single texel of a BC1 block
+	float3 decode_bc1_texel(const uint8_t* block, uint32_t texelX, uint32_t texelY);
+
+	// Reads a texel of a given mip with clamp addressing
+	float3 fetch(const CPULatentTexture& texture, uint32_t mipIdx, int32_t x, int32_t y);
+
+	// Equivalent of SampleGrad with bc1_linear_clamp_sampler (trilinear, clamp)
+	float3 sample_grad(const CPULatentTexture& texture, float2 uv, float2 uvDX, float2 uvDY);
+
+	// Decode every mip of a latent texture with the SIMD block decoder
+	void decode(const CPULatentTexture& texture, DecodedLatentTexture& decoded);
+
+	// Same as above on a decoded texture (identical results, without the per texel block decoding)
+	float3 fetch(const DecodedLatentTexture& texture, uint32_t mipIdx, int32_t x, int32_t y);
+	float3 sample_grad(const DecodedLatentTexture& texture, float2 uv, float2 uvDX, float2 uvDY);
+}
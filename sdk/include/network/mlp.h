@@ -10,13 +10,44 @@
 // Includes
 #include "math/types.h"
 #include "graphics/types.h"
+#include "network/mlp_repack.h"
+#include "tools/upload_manager.h"
 
 // System includes
+#include <span>
 #include <vector>
 
+// Forward declaration
+class StreamWriter;
+
+// Channel mask selecting every output of the last layer
+#define MLP_ALL_CHANNELS 0xFFFFFFFF
+
+// Leading tag of the int8 variant of the mlp_*.bin files (legacy files start with nbMlp)
+#define MLP_INT8_FORMAT_TAG 0x38544E49
+
+// Storage of the weights of an MLP
+enum class MLPWeightFormat
+{
+	Float32 = 0,
+	Int8,
+	Count
+};
+
+// Int8 weights of a layer, dequantized as scale[x] * (weights[width * l + x] - zeroPoint[x])
+struct QuantizedLayer
+{
+	std::vector<int8_t> weights;
+	std::vector<float> scale;
+	std::vector<int32_t> zeroPoint;
+};
+
 // CPU representation of the MLP
 struct CPUMLP
 {
+	// Format of the source file, the float buffers always hold the (dequantized) weights
+	MLPWeightFormat weightFormat = MLPWeightFormat::Float32;
+
 	uint32_t nbMlp;
 	uint32_t finalChannelCount;
 	uint32_t finalBlockWidth;
@@ -25,6 +56,7 @@ struct CPUMLP
 	uint32_t mlp0Width;
 	uint32_t mlp0Height;
 	std::vector<float> mlp0Buffer;
+	QuantizedLayer mlp0Int8;
 
 	// Activation: ReLU(x) 
 
@@ -32,6 +64,7 @@ struct CPUMLP
 	uint32_t mlp1Width;
 	uint32_t mlp1Height;
 	std::vector<float> mlp1Buffer;
+	QuantizedLayer mlp1Int8;
 
 	// Activation: ReLU(x) 
 
@@ -39,6 +72,36 @@ struct CPUMLP
 	uint32_t mlp2Width;
 	uint32_t mlp2Height;
 	std::vector<float> mlp2Buffer;
+	QuantizedLayer mlp2Int8;
+
+	// Layout used by the CPU kernels (see mlp::repack)
+	RepackedMLP repacked;
+};
+
+// Layer of an mlp_*.bin file read in place
+struct MLPLayerView
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	// Float variant: the weights followed by the bias (same layout as the CPUMLP buffers)
+	std::span<const float> buffer;
+
+	// Int8 variant
+	std::span<const float> scale;
+	std::span<const int32_t> zeroPoint;
+	std::span<const int8_t> weights;
+	std::span<const float> bias;
+};
+
+// mlp_*.bin file read in place (usually from a FileView), the spans point inside the file
+struct CPUMLPView
+{
+	MLPWeightFormat weightFormat = MLPWeightFormat::Float32;
+	uint32_t nbMlp = 0;
+	uint32_t finalChannelCount = 0;
+	uint32_t finalBlockWidth = 0;
+	MLPLayerView layers[3];
 };
 
 // GPU representation of the MLP
@@ -65,17 +128,39 @@ namespace mlp
 	// Adjust to fit to multiples of 16
 	void align_dimensions(CPUMLP& mlp);
 
-	// Allocate GPU buffers
+	// Point the view inside the content of an mlp_*.bin file, false if it is truncated, misaligned or fails its checksum
+	bool map_view(const char* data, uint64_t size, CPUMLPView& view);
+
+	// Copy a view to the CPU representation. It owns its buffers: align_dimensions pads them, repack and the GPU upload
+	// build their own layouts from them and the int8 weights are dequantized, so nothing reads the mapping after the copy.
+	void load_view(const CPUMLPView& view, CPUMLP& mlp);
+
+	// Map an mlp_*.bin file and copy it to the CPU representation (the file is read once, in place)
+	void load_file(const char* mlpPath, CPUMLP& mlp);
+
+	// Write an mlp_*.bin file (float or int8 variant based on weightFormat)
+	void save_file(const char* mlpPath, const CPUMLP& mlp);
+
+	// Quantize the weights to int8 (per output channel scale and zero point), the float weights are replaced by their dequantized values
+	void quantize_int8(CPUMLP& mlp);
+
+	// Size of a layer in the int8 GPU layout: scales (float), zero points (int32) and the weights packed by 4 in uints
+	uint64_t int8_layer_size(uint32_t width, uint32_t height);
+	void pack_int8_layer(std::vector<char>& buffer, const QuantizedLayer& layer, uint32_t width, uint32_t height);
+
+	// Allocate GPU buffers, int8 networks only get the fp16 optimal buffers if the cooperative vector shaders consume them
 	void allocate_gpu_mlp(GraphicsDevice device, const CPUMLP& cpuMLP, GPUMLP& gpuMLP);
-	void allocate_gpu_mlp_array(GraphicsDevice device, const std::vector<CPUMLP>& cpuMLPArray, GPUMLP& gpuMLP);
+	void allocate_gpu_mlp_array(GraphicsDevice device, const std::vector<CPUMLP>& cpuMLPArray, bool cooperativeVectors, GPUMLP& gpuMLP);
 
 	// Free the allocated memory
 	void destroy_gpu_mlp(GPUMLP& gpuMLP);
 
-	// Upload the MLP buffers to the GPU
-	void upload_and_convert_matrices(GraphicsDevice device, CommandQueue queue, CommandBuffer cmdB, const char* buffer, uint32_t matrixWidth, uint32_t matrixHeight, GraphicsBuffer mainBuffer, GraphicsBuffer optimalBuffer, uint64_t offsetBuffer);
-	void upload(GraphicsDevice device, CommandQueue cmdQ, CommandBuffer cmdB, ComputeShader fp32tofp16CS, const CPUMLP& cpuMLP, GPUMLP& gpuMLP);
+	// Record the upload of the MLP buffers to the GPU
+	void upload(UploadManager& uploadManager, ComputeShader fp32tofp16CS, const CPUMLP& cpuMLP, GPUMLP& gpuMLP);
 }
 
-// Unpacks the CPU MLP from a stream
-void unpack_type(const char*& stream, CPUMLP& mlp);
+// Packs the CPU MLP to a stream (float or int8 variant based on weightFormat), mlp::map_view reads it back
+void pack_type(std::vector<char>& buffer, const CPUMLP& mlp);
+
+// Same as pack_type, straight to a file (returns false if a write failed)
+bool pack_type(StreamWriter& writer, const CPUMLP& mlp);
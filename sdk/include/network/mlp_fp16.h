@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/mlp_simd.h"
+
+// Rounding of the multiply-adds of the fp16 shader path
+enum class FP16MulAdd
+{
+	// fma rounds once
+	Fused = 0,
+	// The product is rounded before the addition
+	Separate,
+	Count
+};
+
+// Weights and biases rounded to fp16 (stored as float), in the panel layout of mlp::repack
+struct FP16Network
+{
+	RepackedMLP layers;
+};
+
+namespace mlp_fp16
+{
+	// Round the weights as FP32toFP16 does before the upload
+	void prepare(const CPUMLP& mlp, FP16Network& network);
+
+	// Bit accurate fp16 operations (correctly rounded to nearest even)
+	float16_t fma(float16_t a, float16_t b, float16_t c, FP16MulAdd mode);
+	float16_t add(float16_t a, float16_t b);
+
+	// Scratch memory required to evaluate a batch (in floats)
+	uint32_t scratch_size(const FP16Network& network, uint32_t batchSize);
+
+	// Same buffer layout as mlp_simd::evaluate_batch. The input is rounded to fp16 and every operation of the non cooperative vector
+	// mlp_evaluation is rounded like the shader does, the output values are exactly representable in fp16.
+	void evaluate_batch(const FP16Network& network, const float* input, float* output, float* scratch, uint32_t batchSize, FP16MulAdd mode, SIMDLevel level);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/cpu_decoder.h"
+#include "network/mlp_simd.h"
+
+// System includes
+#include <vector>
+
+// Int8 layer prepared for the CPU kernels
+struct Int8Layer
+{
+	// Number of outputs and inputs
+	uint32_t width = 0;
+	uint32_t height = 0;
+
+	// Weights grouped by 4 consecutive inputs (padded with the zero points): [(height + 3) / 4][width][4]
+	std::vector<int8_t> weights;
+	std::vector<float> scale;
+	std::vector<int32_t> zeroPoint;
+	std::vector<float> bias;
+};
+
+// Int8 network used by the CPU kernels
+struct Int8Network
+{
+	Int8Layer layers[3];
+};
+
+// Outcome of the int8 quantization of a network
+struct Int8Report
+{
+	// Size of the packed mlp_*.bin content of every set (bytes)
+	uint64_t floatSize = 0;
+	uint64_t int8Size = 0;
+
+	// Largest absolute difference of the mip 0 decodes against the float network
+	float maxError = 0.0f;
+
+	// Largest absolute difference of the mip 0 decodes between the int8 kernels and the fp32 activations of the shader
+	float maxKernelError = 0.0f;
+};
+
+namespace mlp_int8
+{
+	// Build the kernel layout from an int8 MLP (see mlp::quantize_int8)
+	void prepare(const CPUMLP& mlp, Int8Network& network);
+
+	// Scratch memory required to evaluate a batch (in floats)
+	uint32_t scratch_size(const Int8Network& network, uint32_t batchSize);
+
+	// Same buffer layout as mlp_simd::evaluate_batch. The activations are quantized per texel to 7 bits (the inputs are expected to be positive)
+	// so that every level (VNNI, AVX2 or scalar) produces the same integer dot products.
+	// The shader keeps fp32 activations, so the results are not bit exact: each rounded activation is off by at most half a step
+	// (max(input) / 254), which bounds the error of output x by max(input) / 254 * Sum_l |w[l][x]| per layer before it propagates.
+	// quantize_network reports the measured difference (maxKernelError).
+	void evaluate_batch(const Int8Network& network, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+
+	// Quantize every set with mlp::quantize_int8 and measure the mip 0 error against the float network and against the shader evaluation
+	void quantize_network(std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, Int8Report& report);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/cpu_decoder.h"
+
+// System includes
+#include <string>
+#include <vector>
+
+// Post activation statistics of the hidden neurons over a sample of decoded texels
+struct NeuronStatistics
+{
+	// Number of evaluated texels
+	uint32_t sampleCount = 0;
+
+	// Per neuron mean, min and max of the output of the first (0) and second (1) layers
+	std::vector<float> mean[2];
+	std::vector<float> minimum[2];
+	std::vector<float> maximum[2];
+};
+
+struct PruningSettings
+{
+	// Neurons whose contribution is below threshold * the largest one of their layer are removed
+	float threshold = 0.01f;
+
+	// Upper bound of the hidden widths (multiple of 16), 0 leaves the threshold alone in charge
+	uint32_t maxWidth[2] = { 0, 0 };
+
+	// One texel out of sampleStride (on both axes) of every mip is evaluated
+	uint32_t sampleStride = 4;
+};
+
+struct PruningReport
+{
+	// Hidden widths before and after
+	uint32_t sourceWidth[2] = { 0, 0 };
+	uint32_t prunedWidth[2] = { 0, 0 };
+
+	// Neurons that never activate (summed over the sets)
+	uint32_t deadNeurons[2] = { 0, 0 };
+
+	// Largest absolute difference of the outputs over the sampled texels
+	float maxError = 0.0f;
+};
+
+namespace mlp_pruning
+{
+	// Evaluate the MLP on a grid of texels of every mip of the latent set
+	void collect_statistics(const CPUMLP& mlp, const CPULatentTexture* latentSet, uint32_t sampleStride, NeuronStatistics& statistics);
+
+	// Remove the dead and low contribution hidden neurons of every set. All the sets keep the same dimensions, aligned on 16.
+	// The mean output of a removed neuron is folded in the bias of the next layer.
+	void prune_network(std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, const PruningSettings& settings, PruningReport& report);
+
+	// Write the mlp_*.bin files of the network to a directory
+	void save_network(const std::string& modelDir, const std::vector<CPUMLP>& mlpArray);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// System includes
+#include <new>
+#include <stdint.h>
+#include <vector>
+
+// Cache line size targeted by the repacked layouts
+#define MLP_CACHE_LINE_SIZE 64
+
+// Number of output columns of a panel (one cache line of floats)
+#define MLP_PANEL_WIDTH 16
+
+// Allocator that keeps the vector storage on cache line boundaries
+template<typename T>
+struct CacheAlignedAllocator
+{
+	typedef T value_type;
+
+	CacheAlignedAllocator() = default;
+	template<typename U>
+	CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+	T* allocate(size_t count) { return (T*)::operator new(count * sizeof(T), std::align_val_t(MLP_CACHE_LINE_SIZE)); }
+	void deallocate(T* ptr, size_t) { ::operator delete(ptr, std::align_val_t(MLP_CACHE_LINE_SIZE)); }
+
+	template<typename U>
+	bool operator==(const CacheAlignedAllocator<U>&) const { return true; }
+	template<typename U>
+	bool operator!=(const CacheAlignedAllocator<U>&) const { return false; }
+};
+
+// Panel major copy of a layer (the CPU equivalent of MATRIX_LAYOUT_MUL_OPTIMAL)
+// Panel p holds the columns [16p, 16p + 16): one row of bias followed by one row per input, each row being a cache line.
+// A tile of outputs reads its weights linearly instead of striding by the layer width. The columns past the width are zeros.
+struct RepackedLayer
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t panelCount = 0;
+	std::vector<float, CacheAlignedAllocator<float>> data;
+};
+
+// Repacked copy of the three layers
+struct RepackedMLP
+{
+	RepackedLayer layers[3];
+};
+
+// Forward declaration
+struct CPUMLP;
+
+namespace mlp
+{
+	// Build the repacked layout cached in the MLP, needs to be called again every time the weights change
+	void repack(CPUMLP& mlp);
+	void repack_layer(const float* layerBuffer, uint32_t width, uint32_t height, RepackedLayer& layer);
+
+	// Distance (in floats) between two panels
+	inline uint32_t panel_stride(const RepackedLayer& layer) { return (layer.height + 1) * MLP_PANEL_WIDTH; }
+
+	// First element (bias row) of the panel that contains column x, offset to the column
+	inline const float* panel_column(const RepackedLayer& layer, uint32_t x) { return layer.data.data() + (x / MLP_PANEL_WIDTH) * panel_stride(layer) + (x % MLP_PANEL_WIDTH); }
+}
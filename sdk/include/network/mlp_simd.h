@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/mlp.h"
+
+// Largest batch evaluated by the SIMD kernels
+#define MLP_BATCH_SIZE_MAX 32
+
+// Instruction set used by the batched kernels
+enum class SIMDLevel
+{
+	Scalar = 0,
+	AVX2,
+	AVX512,
+	Count
+};
+
+// Batched evaluation function (see mlp_simd::evaluate_batch)
+typedef void (*MLPKernelFunction)(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+
+// Evaluation specialized for the MLP0_IN_DIM, MLP0_OUT_DIM, MLP1_OUT_DIM and MLP2_OUT_DIM of a network
+template<uint32_t In, uint32_t H0, uint32_t H1, uint32_t Out>
+struct MLPKernel
+{
+	static void evaluate_batch(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+
+	// Every dimension (including the batch size) is known at compile time
+	template<uint32_t BatchSize>
+	static void evaluate(const CPUMLP& mlp, const float* input, float* output, float* scratch, SIMDLevel level);
+};
+
+namespace mlp_simd
+{
+	// Best level supported by the host
+	SIMDLevel best_simd_level();
+
+	// Scratch memory required to evaluate a batch (in floats)
+	uint32_t scratch_size(const CPUMLP& mlp, uint32_t batchSize);
+
+	// Specialized kernel matching the dimensions of the MLP, nullptr if the shape is not in the dispatch table
+	MLPKernelFunction find_kernel(const CPUMLP& mlp);
+
+	// Specialized kernel if available, generic one otherwise
+	MLPKernelFunction select_kernel(const CPUMLP& mlp);
+
+	// Generic evaluation (dimensions read from the MLP at runtime)
+	void evaluate_batch_generic(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+
+	// Evaluates a batch of 8, 16 or 32 texels. Buffers are channel major: channel c of texel t is at [c * batchSize + t]
+	void evaluate_batch(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+	void evaluate_batch(const CPUMLP& mlp, const float16_t* input, float16_t* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+
+	// Only evaluates the outputs of the last layer selected by channelMask (bit c for channel c)
+	// The selected channels are stored contiguously in increasing order, still channel major
+	void evaluate_batch_channels(const CPUMLP& mlp, uint32_t channelMask, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+
+	// Evaluates the last two layers from the post activation output of the first one (mlp0Width channels, channel major)
+	// Scratch memory must hold mlp1Width * batchSize floats
+	void evaluate_hidden_batch(const CPUMLP& mlp, const float* hidden, float* output, float* scratch, uint32_t batchSize, SIMDLevel level);
+}
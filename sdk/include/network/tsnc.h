@@ -8,9 +8,13 @@
 #pragma once
 
 // Project includes
+#include "network/feature_textures.h"
+#include "network/latent_space.h"
 #include "network/mlp.h"
+#include "network/tsnc_container.h"
 
 // System includes
+#include <future>
 #include <string>
 #include <vector>
 
@@ -32,6 +36,13 @@ struct GPUNetworkCompressed
 	Texture tex2 = 0;
 	Texture tex3 = 0;
 
+	// Feature textures (replace the latent space textures and the first layer's weights when enabled)
+	Texture feature0 = 0;
+	Texture feature1 = 0;
+	Texture feature2 = 0;
+	Texture feature3 = 0;
+	GraphicsBuffer featureLayer0Buffer = 0;
+
 	// MLP
 	GPUMLP mlp;
 };
@@ -44,24 +55,44 @@ public:
 	~TSNC();
 
 	// Init and releases
-	void initialize(GraphicsDevice device, bool cvs);
+	void initialize(GraphicsDevice device, bool cvs, bool featureTextures = false);
 	void release();
 
-	// Reload resources
-	void reload_network(const std::string& modelDir, uint32_t numSets);
+	// Reload resources (model directory or .tsnc container, the container provides the number of sets)
+	void reload_network(const std::string& modelPath, uint32_t numSets);
+
+	// Same as reload_network with the files read on worker threads (numThreads = 0 uses every core).
+	// Once the future is ready, finish_reload_network creates the GPU resources on the thread that owns the device.
+	std::future<void> reload_network_async(const std::string& modelPath, uint32_t numSets, uint32_t numThreads = 0);
+	void finish_reload_network();
 	void reload_shaders(const std::string& shaderLibrary);
-	void upload_network(CommandQueue cmdQ, CommandBuffer cmdB);
+	void upload_network(UploadManager& uploadManager);
 
 	// Network data access
 	const GPUNetworkCompressed& gpu_network() const { return m_Nwk; }
 	const GraphicsBuffer& uv_offset_buffer() const { return m_UVOffsetBuffer; }
 	const std::vector<std::string>& shader_defines() const { return m_ShaderDefines; }
 	uint3 texture_size() const { return m_TextureSize; }
+	bool feature_textures_enabled() const { return m_FeatureTextures; }
+
+	// CPU data access (see cpu_decoder)
+	const std::vector<CPUMLP>& mlp_array() const { return m_MLPArray; }
+	const std::vector<CPULatentTexture>& latent_array() const { return m_LatentArray; }
+	const std::vector<CPUFeatureTexture>& feature_array() const { return m_FeatureArray; }
+
+protected:
+	// Reload steps (CPU side on any thread, GPU side on the device thread)
+	void load_cpu_network(const std::string& modelPath, uint32_t numSets, uint32_t numThreads);
+	void create_gpu_network();
+
+	// Feature texture mode (see feature_textures)
+	void upload_feature_textures(UploadManager& uploadManager);
 
 protected:
 	// Device
 	GraphicsDevice m_Device = 0;
 	bool m_CVS = false;
+	bool m_FeatureTextures = false;
 
 	// Number of sets
 	uint32_t m_NumSets = 0;
@@ -69,10 +100,16 @@ protected:
 	uint3 m_TextureSize = { 0, 0, 0 };
 	// Latent space texture data (compressed)
 	std::vector<LSTextureData> m_TexData;
+	// Latent space texture data (CPU copy)
+	std::vector<CPULatentTexture> m_LatentArray;
+	// Feature textures (CPU, empty unless enabled)
+	std::vector<CPUFeatureTexture> m_FeatureArray;
 	// MLP data (CPU)
 	std::vector<CPUMLP> m_MLPArray;
 	// UV offsets used 
 	std::vector<float2> m_UVOffset;
+	// Values of the shader defines
+	ContainerMetadata m_Metadata;
 	std::vector<std::string> m_ShaderDefines;
 
 	// GPU data
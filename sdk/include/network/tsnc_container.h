@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "network/latent_space.h"
+#include "network/mlp.h"
+
+// System includes
+#include <string>
+#include <vector>
+
+// "TSNC" in little endian
+#define TSNC_CONTAINER_MAGIC 0x434E5354
+#define TSNC_CONTAINER_VERSION 3
+
+// Every payload starts on a page boundary of the file, mapped payloads can be copied to the GPU as is
+#define TSNC_CONTAINER_ALIGNMENT 4096
+
+// Payload kinds of the table of contents
+enum class ContainerChunk : uint32_t
+{
+	// Content of an mlp_*.bin file (float or int8 variant, readable with mlp::map_view)
+	MLP = 0,
+	// Float weights converted to fp16: the MLP data, then per layer width, height and the weights followed by the bias
+	MLPHalf,
+	// BC1 blocks of the usable mips of a latent texture
+	Latent,
+	Count
+};
+
+// Values of the shader defines (dimensions after mlp::align_dimensions)
+struct ContainerMetadata
+{
+	uint32_t mip0Resolution = 0;
+	uint32_t mlp0InDim = 0;
+	uint32_t mlp0OutDim = 0;
+	uint32_t mlp1OutDim = 0;
+	uint32_t mlp2OutDim = 0;
+	uint32_t finalChannelCount = 0;
+	uint32_t weightFormat = 0;
+	uint32_t reserved = 0;
+};
+
+// First bytes of the file, the table of contents follows
+struct ContainerHeader
+{
+	uint32_t magic = TSNC_CONTAINER_MAGIC;
+	uint32_t version = TSNC_CONTAINER_VERSION;
+	uint32_t numSets = 0;
+	uint32_t entryCount = 0;
+	ContainerMetadata metadata;
+
+	// CRC32C of the header (with this field set to zero) followed by the table of contents
+	uint32_t tocChecksum = 0;
+	uint32_t reserved = 0;
+};
+
+// Entry of the table of contents
+struct ContainerEntry
+{
+	ContainerChunk chunk = ContainerChunk::Count;
+	uint32_t setIdx = 0;
+	// Latent texture index inside the set (0 for the MLP)
+	uint32_t texIdx = 0;
+	uint32_t reserved = 0;
+
+	// Location of the payload (offset aligned on TSNC_CONTAINER_ALIGNMENT)
+	uint64_t offset = 0;
+	uint64_t size = 0;
+
+	// Latent textures only: dimensions of the first mip, usable mips (no fixup required) and UV offset
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t mipCount = 0;
+	float2 uvOffset = { 0.0f, 0.0f };
+
+	// CRC32C of the payload
+	uint32_t checksum = 0;
+};
+
+static_assert(sizeof(ContainerHeader) == 56, "Unexpected container header size");
+static_assert(sizeof(ContainerEntry) == 56, "Unexpected container entry size");
+
+namespace tsnc_container
+{
+	// True if the path designates a container (.tsnc extension) rather than a model directory
+	bool is_container(const std::string& path);
+
+	// Shader define values of a network, the MLP must be aligned
+	void build_metadata(const CPUMLP& mlp, const CPULatentTexture& latentTex, ContainerMetadata& metadata);
+
+	// Write the sets to a container, the float weights are stored in fp16 if halfWeights is set (int8 networks ignore it)
+	void write(const char* containerPath, const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, bool halfWeights);
+
+	// Map a container and verify the checksums of the table of contents and of the payloads, false if the file is truncated, corrupted or incomplete.
+	// The MLPs are copied (not aligned), the latent textures point inside the shared mapping.
+	bool load(const char* containerPath, std::vector<CPUMLP>& mlpArray, std::vector<CPULatentTexture>& latentArray, ContainerHeader& header);
+
+	// Convert a model directory (mlp_N.bin and texK_N.bc1 files) to a container
+	void export_model_directory(const std::string& modelDir, uint32_t numSets, const char* containerPath, bool halfWeights);
+}
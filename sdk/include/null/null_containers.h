@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// SDK includes
+#include "graphics/descriptors.h"
+#include "graphics/state_tracker.h"
+#include "null/null_backend.h"
+
+// System includes
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace null_backend
+{
+	// Global null backend constants
+	#define NULL_NUM_BACK_BUFFERS 2
+
+	typedef std::chrono::high_resolution_clock NullClock;
+
+	struct NullGraphicsDevice
+	{
+		// Device name
+		std::string adapterName = "Null Device";
+
+		// Recording and execution statistics
+		NullBackendStats stats = NullBackendStats();
+
+		// Identifier of the next command buffer recording
+		uint64_t nextRecordingID = 1;
+
+		// Identifier of the next descriptor table range, stands for the descriptor rings of the DX12 backend
+		uint64_t nextTableRange = 1;
+
+		// Additional stats
+		uint64_t allocatedMemory = 0;
+		uint32_t allocatedTextures = 0;
+		uint32_t allocatedBuffers = 0;
+		uint32_t allocatedCS = 0;
+		uint32_t allocatedGP = 0;
+		uint32_t allocatedSamplers = 0;
+	};
+
+	struct NullWindow
+	{
+		// Size of the client area
+		uint32_t width = 0;
+		uint32_t height = 0;
+	};
+
+	struct NullCommandQueue
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+	};
+
+	struct NullCommand
+	{
+		NullCommandType type = NullCommandType::Count;
+
+		// Resources and ranges of the command, their meaning depends on the type
+		uint64_t resource0 = 0;
+		uint64_t resource1 = 0;
+		uint64_t offset0 = 0;
+		uint64_t offset1 = 0;
+		uint64_t size = 0;
+		uint32_t params[4] = {};
+	};
+
+	struct NullCommandBuffer
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Type of the command buffer
+		CommandBufferType type = CommandBufferType::Default;
+
+		// Recorded stream
+		std::vector<NullCommand> commands;
+		bool closed = false;
+
+		// Recording window of the stream
+		NullClock::time_point resetTime = NullClock::time_point();
+		double recordingTimeUS = 0.0;
+
+		// State set by the recorded dispatches and draws
+		CommandStateTracker state = CommandStateTracker();
+	};
+
+	struct NullTexture
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Internal properties
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t depth = 0;
+		uint32_t mipLevels = 0;
+		TextureFormat format = TextureFormat::Count;
+		TextureType type = TextureType::Tex2D;
+		bool isUAV = false;
+
+		// Host memory of the subresources, the slices are stored one after the other with their mips
+		std::vector<char> data;
+		std::vector<uint64_t> subresourceOffsets;
+		std::vector<uint64_t> subresourceSizes;
+	};
+
+	struct NullGraphicsBuffer
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Properties of the buffer
+		GraphicsBufferType type = GraphicsBufferType::Default;
+		uint64_t bufferSize = 0;
+		uint32_t elementSize = 0;
+
+		// Host memory
+		std::vector<char> data;
+	};
+
+	struct NullConstantBuffer
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Host memory, shared by the CPU and the "GPU" copies
+		std::vector<char> data;
+	};
+
+	struct NullSampler
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+		SamplerDescriptor descriptor = SamplerDescriptor();
+	};
+
+	struct NullDescriptorTables
+	{
+		// Ranges of the SRV, UAV, CBV and sampler tables
+		uint64_t handles[STATE_TRACKER_MAX_TABLES] = {};
+
+		// Recording the ranges were allocated for
+		uint64_t recordingID = 0;
+
+		// Tracks if a binding changed since the tables were last allocated
+		bool dirty = true;
+	};
+
+	struct NullComputeShader
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Source of the kernel, nothing is compiled
+		std::string filename = "";
+		std::string kernelname = "";
+
+		// Without reflection, the slots are assigned to the name hashes in order of first use
+		std::vector<uint32_t> bindings;
+		std::vector<uint64_t> boundResources;
+		std::vector<uint64_t> boundSubresources;
+
+		// Tables of the last dispatch or draw
+		NullDescriptorTables tables = {};
+	};
+
+	struct NullGraphicsPipeline
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Source of the stages, nothing is compiled
+		std::string filename = "";
+
+		// Without reflection, the slots are assigned to the name hashes in order of first use
+		std::vector<uint32_t> bindings;
+		std::vector<uint64_t> boundResources;
+		std::vector<uint64_t> boundSubresources;
+
+		// Tables of the last dispatch or draw
+		NullDescriptorTables tables = {};
+
+		// Dynamic state
+		uint8_t stencilRef = 0;
+	};
+
+	struct NullSwapChain
+	{
+		// Back buffers, rotated on present
+		RenderTexture backBuffers[NULL_NUM_BACK_BUFFERS] = {};
+		uint32_t currentBackBuffer = 0;
+	};
+
+	struct NullAccelerationStructure
+	{
+		// Graphics device
+		NullGraphicsDevice* deviceI = nullptr;
+
+		// Instances of a TLAS, empty for a BLAS
+		std::vector<BottomLevelAS> instances;
+	};
+
+	struct NullProfilingScope
+	{
+		// CPU time of the recording between the enable and the disable
+		NullClock::time_point startTime = NullClock::time_point();
+		uint64_t durationUS = 0;
+	};
+
+	struct NullFence
+	{
+		uint64_t value = 0;
+	};
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// SDK includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+
+namespace null_backend
+{
+    // Textures
+    uint64_t texture_region_size(TextureFormat format, uint32_t width, uint32_t height, uint32_t depth);
+    uint32_t texture_slice_count(TextureType type, uint32_t depth);
+
+    // Commands
+    void record_command(NullCommandBuffer* cmdI, const NullCommand& command);
+
+    // Binding, the slot of a name is allocated on first use
+    uint32_t request_binding(std::vector<uint32_t>& bindings, std::vector<uint64_t>& boundResources, std::vector<uint64_t>& boundSubresources, BindingSlot slot);
+
+    // Redundant state elimination, mirrors the DX12 backend without issuing anything
+    void bind_compute_shader(NullCommandBuffer* cmdI, NullComputeShader* computeShader);
+    void bind_graphics_pipeline(NullCommandBuffer* cmdI, NullGraphicsPipeline* graphicsPipeline);
+}
@@ -36,7 +36,8 @@ struct GlobalCB
 
     // Filtering
     float _EnableFiltering;
-    float2 _PaddingGB0;
+    // Key frames interpolated by the skinning
+    uint2 _AnimationFrames;
     uint32_t _FrameIndex;
 
     // Sun direction
@@ -20,6 +20,7 @@
 #include <tools/profiling_helper.h>
 #include <tools/camera_controller.h>
 #include <tools/command_line.h>
+#include <tools/upload_manager.h>
 
 // System includes
 #include <string>
@@ -71,6 +72,8 @@ private:
 	uint2 m_TileSizeI = { 0, 0 };
 	float4 m_ScreenSize = { 0.0, 0.0, 0.0, 0.0 };
 	uint32_t m_FrameIndex = 0;
+	uint32_t m_NumRenderedFrames = 0;
+	uint32_t m_MaxFrames = 0;
 	double m_Time = 0.0;
 	std::vector<float> m_DurationArray;
 	std::vector<float> m_DrawArray;
@@ -115,4 +118,5 @@ private:
 	// Components
 	CameraController m_CameraController = CameraController();
 	ProfilingHelper m_ProfilingHelper = ProfilingHelper();
+	UploadManager m_UploadManager = UploadManager();
 };
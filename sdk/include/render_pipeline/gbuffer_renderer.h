@@ -34,6 +34,9 @@ public:
 	// Reload network
 	void reload_shaders(const std::string& shaderLibrary, const std::vector<std::string>& shaderDefines);
 
+	// Restrict the neural inference to a subset of the output channels (MLP_ALL_CHANNELS to disable), compiles the permutation when it changes
+	void set_channel_mask(uint32_t channelMask);
+
 	// Evaluate the network
 	void evaluate_indirect(CommandBuffer cmdB, ConstantBuffer globalCB, GraphicsBuffer visibilityBuffer, GraphicsBuffer indexationBuffer, GraphicsBuffer indirectBuffer, GraphicsBuffer outputBuffer,
 		const TextureSet& texSet, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, FilteringMode filteringMode);
@@ -48,6 +51,7 @@ public:
 		RenderTexture visibilityBuffer, RenderTexture shadowTexture, RenderTexture colorTexture);
 
 private:
+	void compile_channel_shaders();
 	void partial_inference(CommandBuffer cmdB, ComputeShader repackedCS, uint32_t indirectOffset, GraphicsBuffer tileBuffer, ConstantBuffer globalCB, GraphicsBuffer visibilityBuffer, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, GraphicsBuffer outputBuffer,
 		const TileClassifier& classifier, bool useCoopVectors, const TSNC& network, FilteringMode filteringMode);
 
@@ -73,6 +77,15 @@ private:
 	ComputeShader m_FMABC1_Repacked_CS = 0;
 	ComputeShader m_CVBC1_Repacked_CS = 0;
 
+	// BC1 inference restricted to the channels of m_ChannelMask (FMA only)
+	uint32_t m_ChannelMask = MLP_ALL_CHANNELS;
+	ComputeShader m_FMABC1_Channels_CS = 0;
+	ComputeShader m_FMABC1_Channels_Repacked_CS = 0;
+
+	// Kept to compile the channel permutations on demand
+	std::string m_ShaderLibrary;
+	std::vector<std::string> m_ShaderDefines;
+
 	// Lighting shader
 	ComputeShader m_DeferredLightingCS = 0;
 };
\ No newline at end of file
@@ -10,6 +10,7 @@
 // Includes
 #include "graphics/descriptors.h"
 #include "tools/texture_utils.h"
+#include "tools/upload_manager.h"
 
 class IBL
 {
@@ -25,7 +26,7 @@ public:
     void reload_shaders(const std::string& shaderLibrary);
 
     // Upload the texture
-    void upload_textures(CommandQueue cmdQ, CommandBuffer cmdB);
+    void upload_textures(UploadManager& uploadManager);
 
     // Render the cubemap to the currently bound render target
     void render_cubemap(CommandBuffer cmd, ConstantBuffer globalCB, RenderTexture colorTexture, RenderTexture shadowTexture, GraphicsBuffer displacementBuffer);
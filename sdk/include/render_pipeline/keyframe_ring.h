@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Includes
+#include "graphics/types.h"
+#include "scene/mesh.h"
+
+// System includes
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Life cycle of a slot of the ring
+enum class KeyframeSlotState
+{
+	// No frame assigned
+	Empty = 0,
+	// Frame assigned, waiting for the streaming thread
+	Requested,
+	// The streaming thread is writing the upload buffer of the slot
+	Loading,
+	// Upload buffer ready, the copy to the GPU ring is recorded by the next update
+	Staged,
+	// Copy recorded in the command buffer of the current frame, the upload buffer is in flight
+	Copying,
+	// Frame available to the skinning
+	Resident,
+};
+
+// Fixed size ring of compact key frames resident on the GPU around the playback time.
+// Upcoming frames are written to per slot upload buffers by a background thread and copied to the ring on the render thread.
+// The renderer flushes its queue every frame, an upload buffer is never rewritten while its copy is in flight.
+class KeyframeRing
+{
+public:
+	// Cst & Dst
+	KeyframeRing();
+	~KeyframeRing();
+
+	// Init & Release, the animation must outlive the ring
+	void initialize(GraphicsDevice device, const CompactMeshAnimation& animation, uint32_t numSlots);
+	void release();
+
+	// Request the frames that follow currentFrame, record the copies of the staged ones and wait for the two frames used by the skinning.
+	// Returns the slots of currentFrame and nextFrame.
+	uint2 update(CommandBuffer cmdB, uint32_t currentFrame, uint32_t nextFrame);
+
+	// GPU ring, same layout as the full frame and bounds buffers with slots instead of frames
+	GraphicsBuffer frame_buffer() const { return m_FrameBuffer; }
+	GraphicsBuffer bounds_buffer() const { return m_BoundsBuffer; }
+	uint32_t num_slots() const { return (uint32_t)m_Slots.size(); }
+
+private:
+	struct KeyframeSlot
+	{
+		uint32_t frameIdx = UINT32_MAX;
+		KeyframeSlotState state = KeyframeSlotState::Empty;
+	};
+
+	// Streaming thread
+	void stream_frames();
+
+	// Distance from the current frame in playback order
+	uint32_t playback_distance(uint32_t frameIdx) const;
+
+	// Slot holding a frame (UINT32_MAX if none), the mutex must be held
+	uint32_t find_slot(uint32_t frameIdx) const;
+
+	// Assign the frames of the window that follows the current frame to the free slots, the mutex must be held
+	void request_frames();
+
+	// Record the copies of the staged slots of the window, the mutex must be held
+	void copy_staged_slots(CommandBuffer cmdB);
+
+private:
+	// Source data
+	GraphicsDevice m_Device = 0;
+	const CompactMeshAnimation* m_Animation = nullptr;
+	uint64_t m_FrameSize = 0;
+
+	// GPU ring and its upload buffers
+	GraphicsBuffer m_FrameBuffer = 0;
+	GraphicsBuffer m_BoundsBuffer = 0;
+	std::vector<GraphicsBuffer> m_UploadBuffers;
+
+	// Slots, shared with the streaming thread
+	std::vector<KeyframeSlot> m_Slots;
+	uint32_t m_CurrentFrame = 0;
+	bool m_Exit = false;
+	std::mutex m_Mutex;
+	std::condition_variable m_RequestCV;
+	std::condition_variable m_StagedCV;
+	std::thread m_Worker;
+};
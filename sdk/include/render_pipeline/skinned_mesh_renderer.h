@@ -9,7 +9,10 @@
 
 // Includes
 #include "graphics/types.h"
+#include "render_pipeline/keyframe_ring.h"
+#include "scene/animation_pca.h"
 #include "scene/mesh.h"
+#include "tools/upload_manager.h"
 
 // System includes
 #include <string>
@@ -22,13 +25,16 @@ public:
 	SkinnedMeshRenderer();
 	~SkinnedMeshRenderer();
 
-	// Init & Release
-	void initialize(GraphicsDevice device, const std::string& modelName);
+	// Init & Release, ringSize key frames are kept resident on the GPU and streamed (0 uploads all the frames)
+	void initialize(GraphicsDevice device, const std::string& modelName, uint32_t ringSize = 0);
 	void release();
 
 	// Resource loading
 	void reload_shaders(const std::string& shaderLibrary);
-	void upload_geometry(CommandQueue cmdQ, CommandBuffer cmdB);
+	void upload_geometry(UploadManager& uploadManager);
+
+	// Make the key frames of the skinning resident, before the constant buffers are updated
+	void stream_animation(CommandBuffer cmdB);
 
 	// Rendering
 	void render_ui();
@@ -47,6 +53,8 @@ public:
 
 	// Animation data
 	float interpolation_factor() const;
+	// Key frames interpolated by the skinning (slots of the key frame ring when streaming)
+	uint2 animation_frames() const;
 	float animation_time() const;
 	uint32_t num_vertices() const { return m_NumVertices; }
 
@@ -60,13 +68,26 @@ private:
 
 	// Animation mesh
 	uint32_t m_NumFrames = 0;
-	MeshAnimation m_AnimMesh = MeshAnimation();
+	CompactMeshAnimation m_AnimMesh = CompactMeshAnimation();
+	// Low rank basis used instead of the compact frames when a .pcanim file is loaded
+	bool m_PCAAnimation = false;
+	PCAMeshAnimation m_PCAMesh = PCAMeshAnimation();
+	// Compact frames streamed through a ring instead of being all resident
+	bool m_StreamAnimation = false;
+	KeyframeRing m_KeyframeRing;
+	uint2 m_AnimationSlots = { 0, 0 };
 	uint32_t m_NumTriangles = 0;
 	uint32_t m_NumVertices = 0;
 
 	// Runtime buffers
 	GraphicsBuffer m_AnimIndexBuffer = 0;
-	std::vector<GraphicsBuffer> m_AnimVertexBuffer;
+	GraphicsBuffer m_AnimBaseBuffer = 0;
+	GraphicsBuffer m_AnimFrameBuffer = 0;
+	GraphicsBuffer m_AnimBoundsBuffer = 0;
+	GraphicsBuffer m_PCAAttributesBuffer = 0;
+	GraphicsBuffer m_PCAMeanBuffer = 0;
+	GraphicsBuffer m_PCABasisBuffer = 0;
+	GraphicsBuffer m_PCACoefficientBuffer = 0;
 	GraphicsBuffer m_SkinnedVertexBuffer = 0;
 	GraphicsBuffer m_DisplacementBuffer = 0;
 
@@ -9,6 +9,8 @@
 
 // Project includes
 #include "graphics/types.h"
+#include "render_pipeline/types.h"
+#include "tools/upload_manager.h"
 
 // System includes
 #include <string>
@@ -22,6 +24,21 @@ struct TextureSet
 	Texture tex4 = 0;
 };
 
+// Residency counters of the texture sets
+struct TextureResidencyStats
+{
+	// Size of the resident sets
+	uint64_t residentBytes = 0;
+	// Sets loaded since the initialization
+	uint32_t numLoads = 0;
+	// Sets evicted to fit in the budget and their cumulated size
+	uint32_t numEvictions = 0;
+	uint64_t evictedBytes = 0;
+};
+
+// Owns the uncompressed and BC6 texture sets, the neural one lives in the TSNC.
+// A set is loaded the first time its mode is requested and the least recently used ones are evicted while the budget is exceeded.
+// The renderer flushes its queue every frame, an evicted set is never in use by the GPU.
 class TextureManager
 {
 public:
@@ -29,21 +46,52 @@ public:
 	TextureManager();
 	~TextureManager();
 
-	// Init & release
-	void initialize(GraphicsDevice device);
+	// Init & release, a budget of 0 keeps every loaded set resident
+	void initialize(GraphicsDevice device, const std::string& modelDir, const std::string& modelName, uint64_t budget = 0);
 	void release();
 
-	// Upload the textures
-	void upload_textures(CommandQueue cmdQ, CommandBuffer cmdB, const std::string& modelDir, const std::string& modelName);
+	// Make the set of a texture mode resident, its uploads are recorded in the upload manager.
+	// The requested set is never evicted, even if it doesn't fit in the budget on its own.
+	void request_texture_set(TextureMode mode, UploadManager& uploadManager);
+
+	// Returns the texture set of a mode, must be resident
+	const TextureSet& texture_set(TextureMode mode) const;
+
+	// Residency
+	bool is_resident(TextureMode mode) const;
+	const TextureResidencyStats& residency_stats() const { return m_Stats; }
+	void render_ui();
 
-	// Returns the texture set
-	const TextureSet& texture_set(bool compressed) const {return compressed ? m_BC6Set : m_UncompressedSet;}
+private:
+	struct ResidentSet
+	{
+		TextureSet textures = TextureSet();
+		uint64_t sizeInBytes = 0;
+		// Value of the use counter at the last request
+		uint64_t lastUse = 0;
+		bool resident = false;
+	};
+
+	// Index of the set of a mode
+	uint32_t set_index(TextureMode mode) const;
+
+	// Load & evict a set
+	void load_set(uint32_t setIdx, UploadManager& uploadManager);
+	void evict_set(uint32_t setIdx);
 
 private:
 	// Graphics device
 	GraphicsDevice m_Device = 0;
 
-	// Texture data
-	TextureSet m_UncompressedSet = TextureSet();
-	TextureSet m_BC6Set = TextureSet();
+	// Source of the textures
+	std::string m_ModelDir;
+	std::string m_ModelName;
+
+	// Texture data, indexed by texture mode
+	ResidentSet m_Sets[(uint32_t)TextureMode::Neural] = {};
+
+	// Residency
+	uint64_t m_Budget = 0;
+	uint64_t m_UseCounter = 0;
+	TextureResidencyStats m_Stats = TextureResidencyStats();
 };
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Project includes
+#include "scene/mesh.h"
+
+// Leading tag of the PCA animation files ("PCAN")
+#define PCA_ANIMATION_TAG 0x4E414350
+
+// Animated attributes of a vertex, the layout of the mean frame and of the basis vectors
+struct PCAVertex
+{
+	float3 position;
+	float3 normal;
+	float3 tangent;
+};
+
+// Attributes shared by every frame
+struct AnimationVertexAttributes
+{
+	float2 texCoord;
+	uint32_t matID;
+};
+
+// Frame f of the animation is mean + sum_k coefficients[f * numComponents + k] * basis[k * numVertices + v]
+struct PCAMeshAnimation
+{
+	uint32_t numFrames = 0;
+	uint32_t numVertices = 0;
+	uint32_t numComponents = 0;
+	std::vector<uint3> indexBuffer;
+	std::vector<AnimationVertexAttributes> attributes;
+	std::vector<PCAVertex> mean;
+	// The components one after the other, sorted by decreasing singular value
+	std::vector<PCAVertex> basis;
+	std::vector<float> coefficients;
+};
+
+struct PCASettings
+{
+	// Size of the basis (clamped to the number of frames)
+	uint32_t numComponents = 16;
+
+	// Extra random vectors and power iterations of the randomized SVD
+	uint32_t oversampling = 8;
+	uint32_t powerIterations = 2;
+
+	// 0 uses all the cores
+	uint32_t numThreads = 0;
+};
+
+struct PCAReport
+{
+	// Share of the variance of the frames captured by the basis
+	float explainedVariance = 0.0f;
+
+	// Largest reconstruction error over all the frames
+	float maxPositionError = 0.0f;
+	float maxNormalError = 0.0f;
+};
+
+namespace animation_pca
+{
+	// Compute a low rank basis of the frames with a randomized SVD (Halko et al. 2011) and the per frame coefficients
+	void compress_animation(const MeshAnimation& meshAnimation, const PCASettings& settings, PCAMeshAnimation& pcaAnimation, PCAReport& report);
+
+	// Rebuild a frame, matches the reconstruction of SkinMeshPCA.compute (normals and tangents are renormalized, the material id is kept)
+	void reconstruct_frame(const PCAMeshAnimation& pcaAnimation, uint32_t frameIdx, VertexBuffer& vertexBuffer);
+
+	// Import/Export a PCA mesh animation (.pcanim)
+	void import_animation(const char* path, PCAMeshAnimation& pcaAnimation);
+	void export_animation(const PCAMeshAnimation& pcaAnimation, const char* path);
+}
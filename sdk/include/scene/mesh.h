@@ -24,6 +24,46 @@ struct MeshAnimation
     std::vector<VertexBuffer> vertexBufferArray;
 };
 
+// Leading tag of the compact animation files ("CANM")
+#define COMPACT_ANIMATION_TAG 0x4D4E4143
+
+// Attributes of a vertex shared by every frame of a compact animation, the position is the one of the first frame
+struct AnimationBaseVertex
+{
+    float3 position;
+    float2 texCoord;
+    uint32_t matID;
+};
+
+// Quantization of the position deltas of a frame: delta = minimum + quantized * scale
+struct AnimationFrameBounds
+{
+    float3 minimum;
+    float padding0;
+    float3 scale;
+    float padding1;
+};
+
+// Per frame data of a vertex (8 bytes instead of the 48 of VertexData)
+struct CompactVertex
+{
+    // Position delta to the base vertex, 11, 11 and 10 bits
+    uint32_t position;
+    // Octahedral normal (2 x 11 bits) and angle of the tangent around the normal (10 bits)
+    uint32_t frame;
+};
+
+struct CompactMeshAnimation
+{
+    uint32_t numFrames = 0;
+    uint32_t numVertices = 0;
+    std::vector<uint3> indexBuffer;
+    std::vector<AnimationBaseVertex> baseVertices;
+    std::vector<AnimationFrameBounds> frameBounds;
+    // The vertices of every frame, one frame after the other
+    std::vector<CompactVertex> frameVertices;
+};
+
 namespace mesh
 {
     // Import a packed mesh animation from disk
@@ -31,4 +71,14 @@ namespace mesh
 
     // Export a packed mesh animation to disk
     void export_mesh_animation(const MeshAnimation& meshAnimation, const char* path);
+
+    // Quantize an animation, uv and material are kept once and the frames store quantized deltas and an octahedral frame
+    void compress_animation(const MeshAnimation& meshAnimation, CompactMeshAnimation& compactAnimation);
+
+    // Decode a frame of a compact animation, matches the decoding of SkinMesh.compute
+    void decompress_frame(const CompactMeshAnimation& compactAnimation, uint32_t frameIdx, VertexBuffer& vertexBuffer);
+
+    // Import/Export a compact mesh animation (.canim)
+    void import_compact_animation(const char* path, CompactMeshAnimation& compactAnimation);
+    void export_compact_animation(const CompactMeshAnimation& compactAnimation, const char* path);
 }
\ No newline at end of file
@@ -22,6 +22,12 @@ struct CommandLineOptions
 	// Adapter index (as returned by OS)
 	int32_t adapterIndex = -1;
 
+	// Headless run on the null backend, measures the CPU cost of the frames
+	bool nullBackend = false;
+
+	// Number of frames rendered before exiting (0 = Unlimited)
+	uint32_t frameCount = 0;
+
 	// Picking an initial POI
 	uint32_t initialPOI = 0;
 
@@ -39,6 +45,37 @@ struct CommandLineOptions
 
 	// Filtering mode
 	FilteringMode filteringMode = FilteringMode::Anisotropic;
+
+	// Key frames of the animation kept resident on the GPU, the others are streamed (0 = All)
+	uint32_t animationRingSize = 0;
+
+	// VRAM budget of the uncompressed and BC6 texture sets in MiB, the least recently used one is evicted above it (0 = Unlimited)
+	uint32_t textureBudget = 0;
+
+	// First layer baked in feature textures
+	bool featureTextures = false;
+
+	// Run the feature texture benchmark on the CPU and exit
+	bool benchmarkFeatureTextures = false;
+
+	// Prune the hidden layers of the network, write the result to pruneOutputDir and exit
+	std::string pruneOutputDir;
+	float pruneThreshold = 0.01f;
+	uint32_t pruneMaxWidth = 0;
+
+	// Quantize the network to int8, write the mlp_*.bin files to exportInt8Dir and exit
+	std::string exportInt8Dir;
+
+	// Convert the model directory to a single file container written to exportContainerPath and exit
+	std::string exportContainerPath;
+	bool exportHalfWeights = false;
+
+	// Convert the mesh animation to the quantized format written to compressAnimationPath and exit
+	std::string compressAnimationPath;
+
+	// Compress the mesh animation to a low rank basis written to pcaAnimationPath and exit
+	std::string pcaAnimationPath;
+	uint32_t pcaComponents = 16;
 };
 
 namespace command_line
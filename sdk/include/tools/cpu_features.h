@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// Architecture
+#if defined(_M_X64) || defined(__x86_64__)
+#define CPU_X64
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define CPU_ARM64
+#endif
+
+// Per-function instruction set targets (MSVC exposes every intrinsic without flags)
+#if defined(CPU_X64) && !defined(_MSC_VER)
+#define TARGET_SSE42 __attribute__((target("sse4.2")))
+#define TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#define TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl,avx2,fma,f16c")))
+#define TARGET_AVX512VNNI __attribute__((target("avx512vnni,avx512f,avx512bw,avx512vl,avx2,fma,f16c")))
+#else
+#define TARGET_SSE42
+#define TARGET_AVX2
+#define TARGET_AVX512
+#define TARGET_AVX512VNNI
+#endif
+
+// Fully unroll the fixed trip count loops of the SIMD kernels so the accumulators stay in registers
+#if defined(__GNUC__)
+#define UNROLL_LOOP _Pragma("GCC unroll 32")
+#else
+#define UNROLL_LOOP
+#endif
+
+// Instruction sets available on the host
+struct CPUFeatures
+{
+	bool sse42 = false;
+	bool avx2 = false;
+	bool fma = false;
+	bool f16c = false;
+	bool avx512 = false;
+	bool avx512vnni = false;
+};
+
+// Queried once and cached
+const CPUFeatures& cpu_features();
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// System includes
+#include <stdint.h>
+
+// Implementation used by the checksum
+enum class CRC32CLevel
+{
+	Table = 0,
+	SSE42,
+	ARMv8,
+	Count
+};
+
+namespace crc32c
+{
+	// Best implementation supported by the host
+	CRC32CLevel best_level();
+
+	// CRC32C (Castagnoli) of a buffer, pass the result of the previous call to checksum a buffer in several pieces.
+	// Uses the SSE4.2 or ARMv8 CRC instructions when available, a table otherwise.
+	uint32_t compute(const void* data, uint64_t size, uint32_t previous = 0);
+
+	// Same as compute with a given implementation, it must be supported by the host. Every level gives the same result.
+	uint32_t compute(const void* data, uint64_t size, uint32_t previous, CRC32CLevel level);
+}
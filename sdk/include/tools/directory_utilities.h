@@ -7,10 +7,12 @@
 
 #pragma once
 
-// Includes
-#include "tools/dirent.h"
-
 // System includes
+#if defined(_WIN32)
+#include "tools/dirent.h"
+#else
+#include <dirent.h>
+#endif
 #include <vector>
 #include <string>
 
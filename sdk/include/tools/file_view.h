@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// System includes
+#include <stdint.h>
+
+// Read only memory mapping of a whole file (MapViewOfFile on Windows, mmap otherwise)
+// The pages are loaded on first access, nothing is copied.
+class FileView
+{
+public:
+	FileView();
+	~FileView();
+
+	// A mapping has a single owner (share it through a std::shared_ptr)
+	FileView(const FileView&) = delete;
+	FileView& operator=(const FileView&) = delete;
+
+	// Map the file, returns false if it can't be opened
+	bool open(const char* filePath);
+
+	// Unmap the file
+	void close();
+
+	// Mapped content
+	bool is_open() const { return m_Open; }
+	const char* data() const { return m_Data; }
+	uint64_t size() const { return m_Size; }
+
+private:
+	const char* m_Data = nullptr;
+	uint64_t m_Size = 0;
+	bool m_Open = false;
+};
@@ -16,7 +16,7 @@ void imgui_dropdown_enum(T& currentValue, const char* label, const char* mode_la
     const char* current_item = mode_labels[(uint32_t)currentValue];
     if (ImGui::BeginCombo(label, current_item)) // "Dropdown" is the label of the dropdown
     {
-        for (int i = 0; i < (uint32_t)T::Count; i++)
+        for (uint32_t i = 0; i < (uint32_t)T::Count; i++)
         {
             bool is_selected = (current_item == mode_labels[i]); // Check if the item is selected
             if (ImGui::Selectable(mode_labels[i], is_selected))
@@ -8,8 +8,15 @@
 #pragma once
 
 // System includes
+#include <span>
+#include <stdint.h>
+#include <stdio.h>
 #include <vector>
 
+// Leading tag of the checksum trailer ("CRCC"), followed by the CRC32C of every preceding byte of the file
+#define STREAM_CHECKSUM_TAG 0x43435243
+#define STREAM_CHECKSUM_TRAILER_SIZE 8
+
 // Functions to pack/unpack a raw buffer (knwoing its size in both cases
 void pack_buffer(std::vector<char>& buffer, size_t write_size, const char* data);
 void unpack_buffer(const char*& stream, size_t read_size, char* data);
@@ -39,4 +46,96 @@ void pack_type(std::vector<char>& buffer, const T& type);
 template<typename T>
 void unpack_type(const char*& stream, T& type);
 
+// Append the checksum trailer to a buffer about to be written to disk
+void pack_checksum(std::vector<char>& buffer);
+
+// Bounds checked counterpart of the unpack functions over a memory range (usually a FileView).
+// A read past the end fails without touching its output and the failure is sticky, a sequence of reads can be checked once.
+class StreamReader
+{
+public:
+	StreamReader(const char* data, uint64_t size);
+
+	// Same as unpack_buffer, unpack_bytes and unpack_vector_bytes
+	bool read_buffer(uint64_t readSize, char* data);
+	template<typename T>
+	bool read_bytes(T& type);
+	template<typename T>
+	bool read_vector_bytes(std::vector<T>& data);
+
+	// Point count elements in place, the cursor must be aligned for T
+	template<typename T>
+	bool map_span(uint64_t count, std::span<const T>& span);
+	bool skip(uint64_t size);
+
+	// Check and remove the checksum trailer of the stream (before any read). Fails if the checksum doesn't match,
+	// or if the trailer is missing and required.
+	bool verify_checksum(bool required = false);
+
+	// Check a CRC32C computed on the next size bytes, the cursor doesn't move
+	bool verify_checksum(uint64_t size, uint32_t checksum);
+
+	// State
+	bool failed() const { return m_Failed; }
+	const char* cursor() const { return m_Cursor; }
+	uint64_t remaining() const { return (uint64_t)(m_End - m_Cursor); }
+
+private:
+	bool fail();
+
+private:
+	const char* m_Begin = nullptr;
+	const char* m_Cursor = nullptr;
+	const char* m_End = nullptr;
+	bool m_Failed = false;
+};
+
+// Size of the staging chunk of StreamWriter
+#define STREAM_WRITER_CHUNK_SIZE (4 << 20)
+
+// Counterpart of the pack functions that writes to a file through a fixed staging chunk instead of growing a buffer.
+// Large writes skip the chunk, the peak memory doesn't depend on the size of the file.
+class StreamWriter
+{
+public:
+	StreamWriter();
+	~StreamWriter();
+
+	// A writer has a single owner
+	StreamWriter(const StreamWriter&) = delete;
+	StreamWriter& operator=(const StreamWriter&) = delete;
+
+	// Create the file, returns false if it can't be opened
+	bool open(const char* filePath, uint64_t chunkSize = STREAM_WRITER_CHUNK_SIZE);
+
+	// Same as pack_buffer, pack_bytes and pack_vector_bytes
+	bool write_buffer(uint64_t writeSize, const char* data);
+	template<typename T>
+	bool write_bytes(const T& type);
+	template<typename T>
+	bool write_vector_bytes(const std::vector<T>& data);
+
+	// Append the checksum trailer (see pack_checksum), the CRC is updated as the chunks are flushed
+	bool write_checksum();
+
+	// Flush and close the file, false if any write failed
+	bool close();
+
+	// State
+	bool failed() const { return m_Failed; }
+	uint64_t size() const { return m_Size; }
+
+private:
+	bool flush();
+	bool write_to_file(const char* data, uint64_t size);
+
+private:
+	FILE* m_File = nullptr;
+	std::vector<char> m_Chunk;
+	uint64_t m_ChunkUsed = 0;
+	uint64_t m_Size = 0;
+	uint32_t m_Checksum = 0;
+	bool m_Failed = false;
+};
+
 #include "stream.inl"
\ No newline at end of file
@@ -64,3 +64,43 @@ void unpack_vector_bytes(const char*& stream, std::vector<T>& data)
 		unpack_buffer(stream, num_elements * sizeof(T), (char*)data.data());
 	}
 }
+
+template<typename T>
+bool StreamReader::read_bytes(T& type)
+{
+	return read_buffer(sizeof(T), (char*)&type);
+}
+
+template<typename T>
+bool StreamReader::read_vector_bytes(std::vector<T>& data)
+{
+	// The element count is checked against the stream before allocating
+	size_t num_elements;
+	if (!read_bytes(num_elements) || num_elements > remaining() / sizeof(T))
+		return fail();
+	data.resize(num_elements);
+	return read_buffer(num_elements * sizeof(T), (char*)data.data());
+}
+
+template<typename T>
+bool StreamReader::map_span(uint64_t count, std::span<const T>& span)
+{
+	if (m_Failed || count > remaining() / sizeof(T) || ((uintptr_t)m_Cursor % alignof(T)) != 0)
+		return fail();
+	span = std::span<const T>((const T*)m_Cursor, count);
+	m_Cursor += count * sizeof(T);
+	return true;
+}
+
+template<typename T>
+bool StreamWriter::write_bytes(const T& type)
+{
+	return write_buffer(sizeof(T), (const char*)&type);
+}
+
+template<typename T>
+bool StreamWriter::write_vector_bytes(const std::vector<T>& data)
+{
+	size_t num_elements = data.size();
+	return write_bytes(num_elements) && write_buffer(num_elements * sizeof(T), (const char*)data.data());
+}
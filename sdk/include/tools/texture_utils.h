@@ -9,6 +9,10 @@
 
 // SDK incldues
 #include "graphics/descriptors.h"
+#include "tools/file_view.h"
+
+// System includes
+#include <span>
 
 struct BinaryTexture
 {
@@ -21,6 +25,18 @@ struct BinaryTexture
     std::vector<uint8_t> data;
 };
 
+// Binary texture read in place, data points inside the mapped file
+struct BinaryTextureView
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+    uint32_t mipCount;
+    TextureFormat format;
+    TextureType type;
+    std::span<const uint8_t> data;
+};
+
 // Our packed BC1 and BC6 formats
 GraphicsBuffer load_bc1_to_graphics_buffer(GraphicsDevice device, const char* texturePath, uint3& dimensions, float2& uvOffset);
 GraphicsBuffer load_bc6_to_graphics_buffer(GraphicsDevice device, const char* texturePath, uint32_t& width, uint32_t& height, uint32_t& mipCount);
@@ -28,5 +44,6 @@ GraphicsBuffer load_bc6_to_graphics_buffer(GraphicsDevice device, const char* te
 namespace binary_texture
 {
     void import_binary_texture(const char* path, BinaryTexture& bt);
+    bool map_binary_texture(const FileView& file, BinaryTextureView& btv);
     void export_binary_texture(const BinaryTexture& bt, const char* path);
 }
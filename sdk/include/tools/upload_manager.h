@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// SDK includes
+#include "graphics/types.h"
+
+// System includes
+#include <deque>
+#include <vector>
+
+// Default size of the staging ring
+#define UPLOAD_RING_DEFAULT_SIZE (64ull << 20)
+
+// Alignment of the staged ranges, the placement alignment of the texture copies
+#define UPLOAD_RING_ALIGNMENT 512
+
+// Number of command buffers of the upload manager, at most one batch is recorded while the others are in flight
+#define UPLOAD_COMMAND_BUFFER_COUNT 4
+
+// Records the uploads to the GPU in batches and stages their data in a persistently mapped ring.
+// A submission signals a fence, the ring space, the transient buffers and the command buffer of a batch are reclaimed once the fence reaches its value.
+// Uploads submitted to the queue before a command buffer are visible to it, no CPU wait is needed before rendering.
+class UploadManager
+{
+public:
+	// Cst & Dst
+	UploadManager();
+	~UploadManager();
+
+	// Init & Release, the release waits for the submitted batches
+	void initialize(GraphicsDevice device, CommandQueue cmdQ, uint64_t ringSize = UPLOAD_RING_DEFAULT_SIZE);
+	void release();
+
+	// Copy a CPU buffer to a graphics buffer
+	void upload_buffer(const char* cpuBuffer, uint64_t bufferSize, GraphicsBuffer targetBuffer, uint64_t targetOffset = 0);
+
+	// Convert a fp32 CPU buffer to fp16 with convertCS, the raw data is also copied to rawBuffer if defined
+	void convert_and_upload_buffer(ComputeShader convertCS, const char* cpuBuffer, uint64_t bufferSize, uint32_t elementSize, GraphicsBuffer convertedBuffer, GraphicsBuffer rawBuffer = 0);
+
+	// Convert a fp32 column major matrix to the fp16 column major (mainBuffer) and mul optimal (optimalBuffer) layouts
+	void convert_and_upload_matrix(const char* cpuBuffer, uint32_t width, uint32_t height, GraphicsBuffer mainBuffer, GraphicsBuffer optimalBuffer, uint64_t targetOffset);
+
+	// Copy a CPU image to a mip of a texture
+	void upload_texture(const char* cpuBuffer, uint64_t bufferSize, Texture texture, uint32_t sliceIdx, uint32_t mipIdx);
+
+	// Copy a CPU image and its mips to a slice of a texture
+	void upload_texture_mips(const char* cpuBuffer, uint64_t bufferSize, uint32_t imageSize, Texture texture, uint32_t sliceIdx);
+
+	// Same with an already filled upload buffer, the manager destroys it once the copy is done
+	void upload_texture_mips(GraphicsBuffer uploadBuffer, uint32_t imageSize, Texture texture, uint32_t sliceIdx);
+
+	// Submit the recorded uploads, returns the fence value of the batch (0 if nothing was recorded)
+	uint64_t submit();
+
+	// Submit and wait for every batch
+	void flush();
+
+	// Check if a batch is done and reclaim the resources of the completed ones
+	bool is_complete(uint64_t fenceValue);
+
+	// Reclaim the ring space and the transient buffers of the completed batches, optionally waiting for the oldest one
+	void retire_batches(bool waitOldest = false);
+
+private:
+	struct UploadBatch
+	{
+		uint64_t fenceValue = 0;
+		// End of the batch in the ring
+		uint64_t ringEnd = 0;
+		// Buffers destroyed when the batch completes
+		std::vector<GraphicsBuffer> transientBuffers;
+		// Command buffer the batch was recorded in
+		CommandBuffer cmdBuffer = 0;
+	};
+
+	// Start recording a batch if needed. The command allocators are recycled when a command buffer is reset,
+	// so a batch takes the command buffer of a completed one and only waits when all of them are in flight.
+	void begin_batch();
+
+	// Allocate a range of the ring for the current batch, returns the staging buffer and the offset in it.
+	// Requests larger than the ring get a dedicated upload buffer.
+	GraphicsBuffer allocate(uint64_t size, uint64_t& offset);
+
+	// Copy the data to the staging memory
+	GraphicsBuffer stage(const char* cpuBuffer, uint64_t size, uint64_t& offset);
+
+private:
+	// Graphics objects
+	GraphicsDevice m_Device = 0;
+	CommandQueue m_CmdQueue = 0;
+
+	// Command buffer of the batch being recorded, and those of the completed batches
+	CommandBuffer m_CmdBuffer = 0;
+	std::vector<CommandBuffer> m_FreeCmdBuffers;
+	Fence m_Fence = 0;
+	uint64_t m_FenceValue = 0;
+
+	// Staging ring, the head and tail grow monotonically and are wrapped on the ring size
+	GraphicsBuffer m_RingBuffer = 0;
+	char* m_RingData = nullptr;
+	uint64_t m_RingSize = 0;
+	uint64_t m_RingHead = 0;
+	uint64_t m_RingTail = 0;
+
+	// Batches
+	bool m_Recording = false;
+	UploadBatch m_CurrentBatch;
+	std::deque<UploadBatch> m_InFlightBatches;
+};
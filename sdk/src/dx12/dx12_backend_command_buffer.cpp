@@ -362,6 +362,9 @@ namespace d3d12
 			dx12_cmdB->frameIdx++;
 			dx12_cmdB->cmdAlloc()->Reset();
 			dx12_cmdB->cmdList()->Reset(dx12_cmdB->cmdAlloc(), nullptr);
+
+			// New recording, nothing is set on the command list
+			state_tracker::begin_recording(dx12_cmdB->state, dx12_cmdB->deviceI->nextRecordingID++);
 		}
 
 		void close(CommandBuffer commandBuffer)
@@ -370,6 +373,18 @@ namespace d3d12
 			dx12_cmdB->cmdList()->Close();
 		}
 
+		const StateStats& state_statistics(CommandBuffer commandBuffer)
+		{
+			DX12CommandBuffer* dx12_cmdB = safe_convert<DX12CommandBuffer>(commandBuffer);
+			return dx12_cmdB->state.stats;
+		}
+
+		void reset_state_statistics(CommandBuffer commandBuffer)
+		{
+			DX12CommandBuffer* dx12_cmdB = safe_convert<DX12CommandBuffer>(commandBuffer);
+			dx12_cmdB->state.stats = StateStats();
+		}
+
 		void set_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture)
 		{
 			// Cast opaque structures
@@ -884,7 +899,7 @@ namespace d3d12
 		{
 		}
 
-		void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, ConstantBuffer constantBuffer)
+		void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, ConstantBuffer constantBuffer)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = safe_convert<DX12CommandBuffer>(commandBuffer);
@@ -893,32 +908,24 @@ namespace d3d12
 			DX12ConstantBuffer* dx12_cb = safe_convert<DX12ConstantBuffer>(constantBuffer);
 			DX12GraphicsBuffer* dx12_cbGB = dx12_cb->mainBuffer;
 
-			// First we need to validate that the right heap will be used
-			validate_compute_shader_heap(dx12_cs, dx12_commandBuffer->frameIdx);
-
-			// Create the view in the compute's heap
-			D3D12_CONSTANT_BUFFER_VIEW_DESC cbvView;
-			cbvView.BufferLocation = dx12_cbGB->resource->GetGPUVirtualAddress();
-			cbvView.SizeInBytes = (uint32_t)dx12_cbGB->bufferSize;
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_cs->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_cs->bindings, slot, bind), "Unexistant binding.");
 
 			// Compute the slot on the heap
-			DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
+			DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeap;
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.cbvCPU);
 			rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-			// Create the CBV
-			deviceI->device->CreateConstantBufferView(&cbvView, rtvHandle);
+			// Copy the cached CBV
+			copy_resource_view(deviceI, currentHeap, rtvHandle, buffer_cbv(deviceI, dx12_cbGB));
 
 			// Change the resource's state (if this is a runtime constant buffer)
 			if (dx12_cbGB->heapType != GraphicsBufferType::Upload)
 				async_change_resource_state(dx12_cs->barriersData, dx12_cbGB->resource, dx12_cbGB->state, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 		}
 
-		void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, GraphicsBuffer graphicsBuffer)
+		void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, GraphicsBuffer graphicsBuffer)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = safe_convert<DX12CommandBuffer>(commandBuffer);
@@ -926,66 +933,37 @@ namespace d3d12
 			DX12ComputeShader* dx12_cs = safe_convert<DX12ComputeShader>(computeShader);
 			DX12GraphicsBuffer* buffer = safe_convert<DX12GraphicsBuffer>(graphicsBuffer);
 
-			// First we need to validate that the right heap will be used
-			validate_compute_shader_heap(dx12_cs, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_cs->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_cs->bindings, slot, bind), "Unexistant binding.");
+			DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeap;
 			if (bind.type == 2)
 			{
-				// Create the view in the compute's heap
-				D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc;
-				ZeroMemory(&uavDesc, sizeof(D3D12_UNORDERED_ACCESS_VIEW_DESC));
-				uavDesc.Format = DXGI_FORMAT_UNKNOWN;
-				uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
-				D3D12_BUFFER_UAV bufferUAV;
-				bufferUAV.FirstElement = 0;
-				bufferUAV.NumElements = (uint32_t)buffer->bufferSize / (uint32_t)buffer->elementSize;
-				bufferUAV.StructureByteStride = buffer->elementSize;
-				bufferUAV.Flags = D3D12_BUFFER_UAV_FLAG_NONE;
-				bufferUAV.CounterOffsetInBytes = 0;
-				uavDesc.Buffer = bufferUAV;
-
 				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
 				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.uavCPU);
 				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-				// Create the UAV
-				deviceI->device->CreateUnorderedAccessView(buffer->resource, nullptr, &uavDesc, rtvHandle);
+				// Copy the cached UAV
+				copy_resource_view(deviceI, currentHeap, rtvHandle, buffer_uav(deviceI, buffer));
 
 				// Change the resource's state
 				async_change_resource_state(dx12_cs->barriersData, buffer->resource, buffer->state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 			}
 			else
 			{
-				// Create the view in the compute's heap
-				D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
-				srvDesc.Format = DXGI_FORMAT_UNKNOWN;
-				srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-				srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3);
-				D3D12_BUFFER_SRV bufferSRV;
-				bufferSRV.FirstElement = 0;
-				bufferSRV.NumElements = (uint32_t)(buffer->bufferSize / buffer->elementSize);
-				bufferSRV.StructureByteStride = buffer->elementSize;
-				bufferSRV.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
-				srvDesc.Buffer = bufferSRV;
-
 				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
 				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.srvCPU);
 				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-				// Create the SRV
-				deviceI->device->CreateShaderResourceView(buffer->resource, &srvDesc, rtvHandle);
+				// Copy the cached SRV
+				copy_resource_view(deviceI, currentHeap, rtvHandle, buffer_srv(deviceI, buffer));
 
 				// Change the resource's state
 				async_change_resource_state(dx12_cs->barriersData, buffer->resource, buffer->state, D3D12_RESOURCE_STATE_COMMON);
 			}
 		}
 
-		void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Texture texture, uint32_t mipLevel)
+		void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Texture texture, uint32_t mipLevel)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = (DX12CommandBuffer*)commandBuffer;
@@ -993,138 +971,37 @@ namespace d3d12
 			DX12ComputeShader* dx12_cs = (DX12ComputeShader*)computeShader;
 			DX12Texture* dx12_tex = (DX12Texture*)texture;
 
-			// First we need to validate that the right heap will be used
-			validate_compute_shader_heap(dx12_cs, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_cs->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_cs->bindings, slot, bind), "Unexistant binding.");
+			DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeap;
 			if (bind.type == 2)
 			{
-				// Create the view in the compute's heap
-				D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc;
-				ZeroMemory(&uavDesc, sizeof(D3D12_UNORDERED_ACCESS_VIEW_DESC));
-				uavDesc.Format = dx12_tex->format;
-
-				switch (dx12_tex->type)
-				{
-					case TextureType::Tex2D:
-					{
-						D3D12_TEX2D_UAV tex2DAUAV;
-						tex2DAUAV.MipSlice = mipLevel;
-						tex2DAUAV.PlaneSlice = 0;
-						uavDesc.Texture2D = tex2DAUAV;
-						uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
-					}
-					break;
-					case TextureType::Tex2DArray:
-					{
-						D3D12_TEX2D_ARRAY_UAV tex2DArrayUAV;
-						tex2DArrayUAV.MipSlice = mipLevel;
-						tex2DArrayUAV.FirstArraySlice = 0;
-						tex2DArrayUAV.ArraySize = dx12_tex->depth;
-						tex2DArrayUAV.PlaneSlice = 0;
-						uavDesc.Texture2DArray = tex2DArrayUAV;
-						uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY;
-					}
-					break;
-					case TextureType::TexCube:
-					{
-						D3D12_TEX2D_ARRAY_UAV tex2DArrayUAV;
-						tex2DArrayUAV.MipSlice = mipLevel;
-						tex2DArrayUAV.FirstArraySlice = 0;
-						tex2DArrayUAV.ArraySize = 6;
-						tex2DArrayUAV.PlaneSlice = 0;
-						uavDesc.Texture2DArray = tex2DArrayUAV;
-						uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY;
-					}
-					break;
-					default:
-						assert_fail();
-				}
-
 				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
 				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.uavCPU);
 				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-				// Create the UAV
-				deviceI->device->CreateUnorderedAccessView(dx12_tex->resource, nullptr, &uavDesc, rtvHandle);
+				// Copy the cached UAV of the mip
+				copy_resource_view(deviceI, currentHeap, rtvHandle, texture_uav(deviceI, dx12_tex, mipLevel));
 
 				// Change the resource's state
 				async_change_resource_state(dx12_cs->barriersData, dx12_tex->resource, dx12_tex->state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 			}
 			else
 			{
-				// Create the view in the compute's heap
-				D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
-				srvDesc.Format = sanitize_dxgi_format_srv(dx12_tex->format);
-				srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-				srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3);
-				switch (dx12_tex->type)
-				{
-					case TextureType::Tex1D:
-					{
-						D3D12_TEX1D_SRV tex1D;
-						tex1D.MostDetailedMip = 0;
-						tex1D.MipLevels = dx12_tex->mipLevels;
-						tex1D.ResourceMinLODClamp = 0;
-						srvDesc.Texture1D = tex1D;
-						srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE1D;
-					}
-					break;
-					case TextureType::Tex2D:
-					{
-						D3D12_TEX2D_SRV tex2D;
-						tex2D.MostDetailedMip = 0;
-						tex2D.MipLevels = dx12_tex->mipLevels;
-						tex2D.PlaneSlice = 0;
-						tex2D.ResourceMinLODClamp = 0;
-						srvDesc.Texture2D = tex2D;
-						srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-					}
-					break;
-					case TextureType::Tex2DArray:
-					{
-						D3D12_TEX2D_ARRAY_SRV tex2DArray;
-						tex2DArray.MostDetailedMip = 0;
-						tex2DArray.MipLevels = dx12_tex->mipLevels;
-						tex2DArray.FirstArraySlice = 0;
-						tex2DArray.ArraySize = dx12_tex->depth;
-						tex2DArray.PlaneSlice = 0;
-						tex2DArray.ResourceMinLODClamp = 0;
-						srvDesc.Texture2DArray = tex2DArray;
-						srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
-					}
-					break;
-					case TextureType::TexCube:
-					{
-						D3D12_TEXCUBE_SRV texCube;
-						texCube.MostDetailedMip = 0;
-						texCube.MipLevels = dx12_tex->mipLevels;;
-						texCube.ResourceMinLODClamp = 0;
-						srvDesc.TextureCube = texCube;
-						srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
-					}
-					break;
-					default:
-						assert_fail();
-				}
-
 				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
 				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.srvCPU);
 				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-				// Create the SRV
-				deviceI->device->CreateShaderResourceView(dx12_tex->resource, &srvDesc, rtvHandle);
+				// Copy the cached SRV
+				copy_resource_view(deviceI, currentHeap, rtvHandle, texture_srv(deviceI, dx12_tex));
 
 				// Change the resource's state
 				async_change_resource_state(dx12_cs->barriersData, dx12_tex->resource, dx12_tex->state, D3D12_RESOURCE_STATE_COMMON);
 			}
 		}
 
-		void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, TopLevelAS rtas)
+		void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, TopLevelAS rtas)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = (DX12CommandBuffer*)commandBuffer;
@@ -1132,12 +1009,9 @@ namespace d3d12
 			DX12ComputeShader* dx12_cs = (DX12ComputeShader*)computeShader;
 			DX12TLAS* dx12_rtas = (DX12TLAS*)rtas;
 
-			// First we need to validate that the right heap will be used
-			validate_compute_shader_heap(dx12_cs, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_cs->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_cs->bindings, slot, bind), "Unexistant binding.");
 
 			// Create the view in the compute's heap
 			D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV rtasSRV;
@@ -1149,28 +1023,29 @@ namespace d3d12
 			srvDesc.RaytracingAccelerationStructure = rtasSRV;
 
 			// Compute the slot on the heap
-			DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
+			DX12DescriptorHeap& currentHeap = dx12_cs->CSUHeap;
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.srvCPU);
 			rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-			// Create the SRV
+			// Create the SRV, the descriptor no longer holds a cached view
 			deviceI->device->CreateShaderResourceView(nullptr, &srvDesc, rtvHandle);
+			invalidate_resource_view(deviceI, currentHeap, rtvHandle);
 
 			// Change the resource's state
 			async_change_resource_state(dx12_cs->barriersData, dx12_rtas->data->resource, dx12_rtas->data->state, D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE);
 		}
 
-		void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, RenderTexture renderTexture)
+		void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, RenderTexture renderTexture)
 		{
 			if (renderTexture == 0)
 				return;
 
 			// Grab all the internal structures
 			DX12RenderTexture* dx12_rTex = (DX12RenderTexture*)renderTexture;
-			set_compute_shader_texture(commandBuffer, computeShader, name, (Texture)(&dx12_rTex->texture));
+			set_compute_shader_texture(commandBuffer, computeShader, slot, (Texture)(&dx12_rTex->texture));
 		}
 
-		void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Sampler sampler)
+		void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Sampler sampler)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = (DX12CommandBuffer*)commandBuffer;
@@ -1180,7 +1055,12 @@ namespace d3d12
 
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_cs->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_cs->bindings, slot, bind), "Unexistant binding.");
+
+			// Skip the sampler if the descriptor already holds it
+			DX12DescriptorHeap& currentHeap = dx12_cs->samplerHeap;
+			if (currentHeap.boundViews[bind.slot] == dx12_sampler->id)
+				return;
 
 			// Set the sampler
 			const SamplerDescriptor& smplDesc = dx12_sampler->resource;
@@ -1197,12 +1077,13 @@ namespace d3d12
 			samplerDescriptor.MaxLOD = smplDesc.maxLOD;
 
 			// Compute the slot on the heap
-			DX12DescriptorHeap& currentHeap = dx12_cs->samplerHeaps[dx12_cs->nextUsableHeap];
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.samplerCPU);
 			rtvHandle.ptr += (uint64_t)dx12_device->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER] * bind.slot;
 
 			// Set the sampler
 			dx12_device->device->CreateSampler(&samplerDescriptor, rtvHandle);
+			currentHeap.boundViews[bind.slot] = dx12_sampler->id;
+			currentHeap.dirty = true;
 		}
 
 		void dispatch(CommandBuffer commandBuffer, ComputeShader computeShader, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ)
@@ -1217,36 +1098,11 @@ namespace d3d12
 				cmdI->cmdList()->ResourceBarrier((uint32_t)dx12_cs->barriersData.size(), dx12_cs->barriersData.data());
 			dx12_cs->barriersData.clear();
 
-			// First we need to validate that the right heap will be used
-			validate_compute_shader_heap(dx12_cs, cmdI->frameIdx);
-
-			// Set the pipeline
-			cmdI->cmdList()->SetPipelineState(dx12_cs->pipelineStateObject);
-
-			// Set the root Signature
-			cmdI->cmdList()->SetComputeRootSignature(dx12_cs->rootSignature->rootSignature);
-
-			// Bind the root descriptor tables
-			DX12DescriptorHeap& currentHeap_cbv_srv_uav = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
-			DX12DescriptorHeap& currentHeap_sampler = dx12_cs->samplerHeaps[dx12_cs->nextUsableHeap];
-			ID3D12DescriptorHeap* ppHeaps[] = { currentHeap_cbv_srv_uav.descriptorHeap, currentHeap_sampler.descriptorHeap };
-			cmdI->cmdList()->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
-
-			// Bind the tables
-			if (dx12_cs->rootSignature->srvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->srvIndex, currentHeap_cbv_srv_uav.srvGPU);
-			if (dx12_cs->rootSignature->uavIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->uavIndex, currentHeap_cbv_srv_uav.uavGPU);
-			if (dx12_cs->rootSignature->cbvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->cbvIndex, currentHeap_cbv_srv_uav.cbvGPU);
-			if (dx12_cs->rootSignature->samplerIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->samplerIndex, currentHeap_sampler.samplerGPU);
+			// Set the pipeline, the root signature and the tables, unless they are already set
+			bind_compute_shader(cmdI, dx12_cs);
 
 			// Dispatch the currently bound shader
 			cmdI->cmdList()->Dispatch(sizeX, sizeY, sizeZ);
-
-			// This heap has been used for the current command buffer batch, we need to move to the next one
-			dx12_cs->nextUsableHeap++;
 		}
 
 		struct IndirectDispatchCommand
@@ -1272,37 +1128,11 @@ namespace d3d12
 				cmdI->cmdList()->ResourceBarrier((uint32_t)dx12_cs->barriersData.size(), dx12_cs->barriersData.data());
 			dx12_cs->barriersData.clear();
 
-			// First we need to validate that the right heap will be used
-			validate_compute_shader_heap(dx12_cs, cmdI->frameIdx);
-
-			// Set the pipeline
-			cmdI->cmdList()->SetPipelineState(dx12_cs->pipelineStateObject);
-
-			// Set the root Signature
-			cmdI->cmdList()->SetComputeRootSignature(dx12_cs->rootSignature->rootSignature);
-
-			// Bind the root descriptor tables
-			DX12DescriptorHeap& currentHeap_cbv_srv_uav = dx12_cs->CSUHeaps[dx12_cs->nextUsableHeap];
-			DX12DescriptorHeap& currentHeap_sampler = dx12_cs->samplerHeaps[dx12_cs->nextUsableHeap];
-			ID3D12DescriptorHeap* ppHeaps[] = { currentHeap_cbv_srv_uav.descriptorHeap, currentHeap_sampler.descriptorHeap };
-			cmdI->cmdList()->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
-
-			// Bind the tables
-			if (dx12_cs->rootSignature->srvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->srvIndex, currentHeap_cbv_srv_uav.srvGPU);
-			if (dx12_cs->rootSignature->uavIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->uavIndex, currentHeap_cbv_srv_uav.uavGPU);
-			if (dx12_cs->rootSignature->cbvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->cbvIndex, currentHeap_cbv_srv_uav.cbvGPU);
-			if (dx12_cs->rootSignature->samplerIndex != UINT32_MAX)
-				cmdI->cmdList()->SetComputeRootDescriptorTable(dx12_cs->rootSignature->samplerIndex, currentHeap_sampler.samplerGPU);
-
+			// Set the pipeline, the root signature and the tables, unless they are already set
+			bind_compute_shader(cmdI, dx12_cs);
 
 			// Execute the command
 			cmdI->cmdList()->ExecuteIndirect(dx12_cs->commandSignature, 1, dx12_indirectBuffer->resource, offset, nullptr, 0);
-
-			// This heap has been used for the current command buffer batch, we need to move to the next one
-			dx12_cs->nextUsableHeap++;
 		}
 
 		void set_viewport(CommandBuffer commandBuffer, int32_t offsetX, int32_t offsetY, uint32_t width, uint32_t height)
@@ -1330,7 +1160,7 @@ namespace d3d12
 			cmdI->cmdList()->RSSetScissorRects(1, &surfaceSize);
 		}
 
-		void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, ConstantBuffer constantBuffer)
+		void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, ConstantBuffer constantBuffer)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = (DX12CommandBuffer*)commandBuffer;
@@ -1339,32 +1169,24 @@ namespace d3d12
 			DX12ConstantBuffer* dx12_cb = (DX12ConstantBuffer*)constantBuffer;
 			DX12GraphicsBuffer* dx12_cbGB = dx12_cb->mainBuffer;
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_gp->bindings, name, bind), "Unexistant binding.");
-
-			// Create the view in the compute's heap
-			D3D12_CONSTANT_BUFFER_VIEW_DESC cbvView;
-			cbvView.BufferLocation = dx12_cbGB->resource->GetGPUVirtualAddress();
-			cbvView.SizeInBytes = (uint32_t)dx12_cbGB->bufferSize;
+			assert_msg(request_binding(dx12_gp->bindings, slot, bind), "Unexistant binding.");
 
 			// Compute the slot on the heap
-			DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
+			DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeap;
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.cbvCPU);
 			rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-			// Create the CBV
-			deviceI->device->CreateConstantBufferView(&cbvView, rtvHandle);
+			// Copy the cached CBV
+			copy_resource_view(deviceI, currentHeap, rtvHandle, buffer_cbv(deviceI, dx12_cbGB));
 
 			// Change the resource's state (if this is a runtime constant buffer)
 			if (dx12_cbGB->heapType != GraphicsBufferType::Upload)
 				async_change_resource_state(dx12_gp->barriersData, dx12_cbGB->resource, dx12_cbGB->state, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 		}
 
-		void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset)
+		void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = (DX12CommandBuffer*)commandBuffer;
@@ -1372,67 +1194,46 @@ namespace d3d12
 			DX12GraphicsPipeline* dx12_gp = (DX12GraphicsPipeline*)graphicsPipeline;
 			DX12GraphicsBuffer* buffer = (DX12GraphicsBuffer*)graphicsBuffer;
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_gp->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_gp->bindings, slot, bind), "Unexistant binding.");
 
-			// Create the view in the compute's heap
+			// Compute the slot on the heap
+			DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeap;
+			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(bind.type == 2 ? currentHeap.uavCPU : currentHeap.srvCPU);
+			rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
+
+			// Only the views of the whole buffer are cached, the offset ones are created in place
+			const uint64_t firstElement = bufferOffset / buffer->elementSize;
 			if (bind.type == 2)
 			{
-				// Create the view in the compute's heap
-				D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc;
-				ZeroMemory(&uavDesc, sizeof(D3D12_UNORDERED_ACCESS_VIEW_DESC));
-				uavDesc.Format = DXGI_FORMAT_UNKNOWN;
-				uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
-				D3D12_BUFFER_UAV bufferUAV;
-				bufferUAV.FirstElement = bufferOffset / (uint32_t)buffer->elementSize;
-				bufferUAV.NumElements = (uint32_t)buffer->bufferSize / (uint32_t)buffer->elementSize - (uint32_t)bufferUAV.FirstElement;
-				bufferUAV.StructureByteStride = buffer->elementSize;
-				bufferUAV.Flags = D3D12_BUFFER_UAV_FLAG_NONE;
-				bufferUAV.CounterOffsetInBytes = 0;
-				uavDesc.Buffer = bufferUAV;
-
-				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
-				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.uavCPU);
-				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
-
-				// Create the UAV
-				deviceI->device->CreateUnorderedAccessView(buffer->resource, nullptr, &uavDesc, rtvHandle);
+				if (firstElement == 0)
+					copy_resource_view(deviceI, currentHeap, rtvHandle, buffer_uav(deviceI, buffer));
+				else
+				{
+					create_buffer_uav(deviceI, buffer, firstElement, rtvHandle);
+					invalidate_resource_view(deviceI, currentHeap, rtvHandle);
+				}
 
 				// Change the resource's state
 				async_change_resource_state(dx12_gp->barriersData, buffer->resource, buffer->state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 			}
 			else
 			{
-				D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
-				srvDesc.Format = DXGI_FORMAT_UNKNOWN;
-				srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-				srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3);
-				D3D12_BUFFER_SRV bufferSRV;
-				bufferSRV.FirstElement = bufferOffset / (uint32_t)buffer->elementSize;
-				bufferSRV.NumElements = (uint32_t)buffer->bufferSize / (uint32_t)buffer->elementSize - (uint32_t)bufferSRV.FirstElement;
-				bufferSRV.StructureByteStride = buffer->elementSize;
-				bufferSRV.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
-				srvDesc.Buffer = bufferSRV;
-
-				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
-				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.srvCPU);
-				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
-
-				// Create the SRV
-				deviceI->device->CreateShaderResourceView(buffer->resource, &srvDesc, rtvHandle);
+				if (firstElement == 0)
+					copy_resource_view(deviceI, currentHeap, rtvHandle, buffer_srv(deviceI, buffer));
+				else
+				{
+					create_buffer_srv(deviceI, buffer, firstElement, rtvHandle);
+					invalidate_resource_view(deviceI, currentHeap, rtvHandle);
+				}
 
 				// Change the resource's state
 				async_change_resource_state(dx12_gp->barriersData, buffer->resource, buffer->state, D3D12_RESOURCE_STATE_COMMON);
 			}
 		}
 
-		void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Texture texture)
+		void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Texture texture)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = safe_convert<DX12CommandBuffer>(commandBuffer);
@@ -1440,12 +1241,9 @@ namespace d3d12
 			DX12GraphicsPipeline* dx12_gp = safe_convert<DX12GraphicsPipeline>(graphicsPipeline);
 			DX12Texture* dx12_tex = safe_convert<DX12Texture>(texture);
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_gp->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_gp->bindings, slot, bind), "Unexistant binding.");
 
 			// Create the view in the compute's heap
 			if (bind.type == 2)
@@ -1454,74 +1252,29 @@ namespace d3d12
 			}
 			else
 			{
-				// Create the view in the compute's heap
-				D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
-				srvDesc.Format = sanitize_dxgi_format_srv(dx12_tex->format);
-				srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-				srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3);
-				switch (dx12_tex->type)
-				{
-				case TextureType::Tex2D:
-				{
-					D3D12_TEX2D_SRV tex2D;
-					tex2D.MostDetailedMip = 0;
-					tex2D.MipLevels = dx12_tex->mipLevels;
-					tex2D.PlaneSlice = 0;
-					tex2D.ResourceMinLODClamp = 0;
-					srvDesc.Texture2D = tex2D;
-					srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-				}
-				break;
-				case TextureType::Tex2DArray:
-				{
-					D3D12_TEX2D_ARRAY_SRV tex2DArray;
-					tex2DArray.MostDetailedMip = 0;
-					tex2DArray.MipLevels = dx12_tex->mipLevels;
-					tex2DArray.FirstArraySlice = 0;
-					tex2DArray.ArraySize = dx12_tex->depth;
-					tex2DArray.PlaneSlice = 0;
-					tex2DArray.ResourceMinLODClamp = 0;
-					srvDesc.Texture2DArray = tex2DArray;
-					srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
-				}
-				break;
-				case TextureType::TexCube:
-				{
-					D3D12_TEXCUBE_SRV texCube;
-					texCube.MostDetailedMip = 0;
-					texCube.MipLevels = dx12_tex->mipLevels;
-					texCube.ResourceMinLODClamp = 0;
-					srvDesc.TextureCube = texCube;
-					srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
-				}
-				break;
-				default:
-					assert_fail();
-				}
-
 				// Compute the slot on the heap
-				DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
+				DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeap;
 				D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.srvCPU);
 				rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-				// Create the SRV
-				deviceI->device->CreateShaderResourceView(dx12_tex->resource, &srvDesc, rtvHandle);
+				// Copy the cached SRV
+				copy_resource_view(deviceI, currentHeap, rtvHandle, texture_srv(deviceI, dx12_tex));
 
 				// Change the resource's state
 				async_change_resource_state(dx12_gp->barriersData, dx12_tex->resource, dx12_tex->state, dx12_tex->isDepth ? D3D12_RESOURCE_STATE_DEPTH_READ : D3D12_RESOURCE_STATE_COMMON);
 			}
 		}
 
-		void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, RenderTexture renderTexture)
+		void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, RenderTexture renderTexture)
 		{
 			// Cast to internal type
 			DX12RenderTexture* dx12_rTex = safe_convert<DX12RenderTexture>(renderTexture);
 
 			// Bind the texture
-			set_graphics_pipeline_texture(commandBuffer, graphicsPipeline, name, (Texture)&dx12_rTex->texture);
+			set_graphics_pipeline_texture(commandBuffer, graphicsPipeline, slot, (Texture)&dx12_rTex->texture);
 		}
 
-		void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Sampler sampler)
+		void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Sampler sampler)
 		{
 			// Grab all the internal structures
 			DX12CommandBuffer* dx12_commandBuffer = (DX12CommandBuffer*)commandBuffer;
@@ -1531,7 +1284,12 @@ namespace d3d12
 
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_gp->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_gp->bindings, slot, bind), "Unexistant binding.");
+
+			// Skip the sampler if the descriptor already holds it
+			DX12DescriptorHeap& currentHeap = dx12_gp->samplerHeap;
+			if (currentHeap.boundViews[bind.slot] == dx12_sampler->id)
+				return;
 
 			// Set the sampler
 			const SamplerDescriptor& smplDesc = dx12_sampler->resource;
@@ -1548,15 +1306,16 @@ namespace d3d12
 			samplerDescriptor.MaxLOD = smplDesc.maxLOD;
 
 			// Compute the slot on the heap
-			DX12DescriptorHeap& currentHeap = dx12_gp->samplerHeaps[dx12_gp->nextUsableHeap];
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.samplerCPU);
 			rtvHandle.ptr += (uint64_t)dx12_device->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER] * bind.slot;
 
 			// Set the sampler
 			dx12_device->device->CreateSampler(&samplerDescriptor, rtvHandle);
+			currentHeap.boundViews[bind.slot] = dx12_sampler->id;
+			currentHeap.dirty = true;
 		}
 
-		void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, TopLevelAS rtas)
+		void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, TopLevelAS rtas)
 		{
 			if (rtas == 0)
 				return;
@@ -1567,12 +1326,9 @@ namespace d3d12
 			DX12GraphicsPipeline* dx12_gp = (DX12GraphicsPipeline*)graphicsPipeline;
 			DX12TLAS* dx12_rtas = (DX12TLAS*)rtas;
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, dx12_commandBuffer->frameIdx);
-
 			// Get the binding
 			DX12Binding bind;
-			assert_msg(request_binding(dx12_gp->bindings, name, bind), "Unexistant binding.");
+			assert_msg(request_binding(dx12_gp->bindings, slot, bind), "Unexistant binding.");
 
 			// Create the view in the compute's heap
 			D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV rtasSRV;
@@ -1584,12 +1340,13 @@ namespace d3d12
 			srvDesc.RaytracingAccelerationStructure = rtasSRV;
 
 			// Compute the slot on the heap
-			DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
+			DX12DescriptorHeap& currentHeap = dx12_gp->CSUHeap;
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(currentHeap.srvCPU);
 			rtvHandle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * bind.slot;
 
-			// Create the SRV
+			// Create the SRV, the descriptor no longer holds a cached view
 			deviceI->device->CreateShaderResourceView(nullptr, &srvDesc, rtvHandle);
+			invalidate_resource_view(deviceI, currentHeap, rtvHandle);
 
 			// Change the resource's state
 			async_change_resource_state(dx12_gp->barriersData, dx12_rtas->data->resource, dx12_rtas->data->state, D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE);
@@ -1600,37 +1357,13 @@ namespace d3d12
 			DX12CommandBuffer* cmdI = (DX12CommandBuffer*)commandBuffer;
 			DX12GraphicsPipeline* dx12_gp = (DX12GraphicsPipeline*)graphicsPipeline;
 
-			cmdI->cmdList()->SetPipelineState(dx12_gp->pipelineStateObject);
-
 			// Process all the barriers that have been registered (at once)
 			if (dx12_gp->barriersData.size() > 0)
 				cmdI->cmdList()->ResourceBarrier((uint32_t)dx12_gp->barriersData.size(), dx12_gp->barriersData.data());
 			dx12_gp->barriersData.clear();
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, cmdI->frameIdx);
-
-			// Set the pipeline state
-			cmdI->cmdList()->SetPipelineState(dx12_gp->pipelineStateObject);
-
-			// Set the root signature
-			cmdI->cmdList()->SetGraphicsRootSignature(dx12_gp->rootSignature->rootSignature);
-
-			// Set the descriptor heap
-			DX12DescriptorHeap& currentHeap_cbv_srv_uav = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
-			DX12DescriptorHeap& currentHeap_sampler = dx12_gp->samplerHeaps[dx12_gp->nextUsableHeap];
-			ID3D12DescriptorHeap* ppHeaps[] = { currentHeap_cbv_srv_uav.descriptorHeap, currentHeap_sampler.descriptorHeap };
-			cmdI->cmdList()->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
-
-			// Set the tables
-			if (dx12_gp->rootSignature->srvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->srvIndex, currentHeap_cbv_srv_uav.srvGPU);
-			if (dx12_gp->rootSignature->uavIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->uavIndex, currentHeap_cbv_srv_uav.uavGPU);
-			if (dx12_gp->rootSignature->cbvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->cbvIndex, currentHeap_cbv_srv_uav.cbvGPU);
-			if (dx12_gp->rootSignature->samplerIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->samplerIndex, currentHeap_sampler.samplerGPU);
+			// Set the pipeline, the root signature and the tables, unless they are already set
+			bind_graphics_pipeline(cmdI, dx12_gp);
 
 			if (primitive == DrawPrimitive::Triangle)
 			{
@@ -1677,9 +1410,6 @@ namespace d3d12
 				cmdI->cmdList()->DrawIndexedInstanced(3 * num_triangles, numInstances, 0, 0, 0);
 			else
 				cmdI->cmdList()->DrawIndexedInstanced(2 * num_triangles, numInstances, 0, 0, 0);
-
-			// This heap has been used for the current command buffer batch, we need to move to the next one
-			dx12_gp->nextUsableHeap++;
 		}
 
 		void draw_procedural(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive)
@@ -1693,30 +1423,8 @@ namespace d3d12
 				cmdI->cmdList()->ResourceBarrier((uint32_t)dx12_gp->barriersData.size(), dx12_gp->barriersData.data());
 			dx12_gp->barriersData.clear();
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, cmdI->frameIdx);
-
-			// Set the pipeline state
-			cmdI->cmdList()->SetPipelineState(dx12_gp->pipelineStateObject);
-
-			// Set the root signature
-			cmdI->cmdList()->SetGraphicsRootSignature(dx12_gp->rootSignature->rootSignature);
-
-			// Set the descriptor heap
-			DX12DescriptorHeap& currentHeap_cbv_srv_uav = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
-			DX12DescriptorHeap& currentHeap_sampler = dx12_gp->samplerHeaps[dx12_gp->nextUsableHeap];
-			ID3D12DescriptorHeap* ppHeaps[] = { currentHeap_cbv_srv_uav.descriptorHeap, currentHeap_sampler.descriptorHeap };
-			cmdI->cmdList()->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
-
-			// Set the tables
-			if (dx12_gp->rootSignature->srvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->srvIndex, currentHeap_cbv_srv_uav.srvGPU);
-			if (dx12_gp->rootSignature->uavIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->uavIndex, currentHeap_cbv_srv_uav.uavGPU);
-			if (dx12_gp->rootSignature->cbvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->cbvIndex, currentHeap_cbv_srv_uav.cbvGPU);
-			if (dx12_gp->rootSignature->samplerIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->samplerIndex, currentHeap_sampler.samplerGPU);
+			// Set the pipeline, the root signature and the tables, unless they are already set
+			bind_graphics_pipeline(cmdI, dx12_gp);
 
 			// Set the right primitive
 			if (dx12_gp->hullblob != nullptr && dx12_gp->domainBlob != nullptr)
@@ -1749,9 +1457,6 @@ namespace d3d12
 				cmdI->cmdList()->DrawInstanced(3 * numTriangles, numInstances, 0, 0);
 			else
 				cmdI->cmdList()->DrawInstanced(2 * numTriangles, numInstances, 0, 0);
-
-			// This heap has been used for the current command buffer batch, we need to move to the next one
-			dx12_gp->nextUsableHeap++;
 		}
 
 		void draw_procedural_indirect(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer indirectBuffer, uint64_t bufferOffset)
@@ -1772,30 +1477,8 @@ namespace d3d12
 				cmdI->cmdList()->ResourceBarrier((uint32_t)dx12_gp->barriersData.size(), dx12_gp->barriersData.data());
 			dx12_gp->barriersData.clear();
 
-			// First we need to validate that the right heap will be used
-			validate_graphics_pipeline_heap(dx12_gp, cmdI->frameIdx);
-
-			// Set the pipeline state
-			cmdI->cmdList()->SetPipelineState(dx12_gp->pipelineStateObject);
-
-			// Set the root signature
-			cmdI->cmdList()->SetGraphicsRootSignature(dx12_gp->rootSignature->rootSignature);
-
-			// Set the descriptor heap
-			DX12DescriptorHeap& currentHeap_cbv_srv_uav = dx12_gp->CSUHeaps[dx12_gp->nextUsableHeap];
-			DX12DescriptorHeap& currentHeap_sampler = dx12_gp->samplerHeaps[dx12_gp->nextUsableHeap];
-			ID3D12DescriptorHeap* ppHeaps[] = { currentHeap_cbv_srv_uav.descriptorHeap, currentHeap_sampler.descriptorHeap };
-			cmdI->cmdList()->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
-
-			// Set the tables
-			if (dx12_gp->rootSignature->srvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->srvIndex, currentHeap_cbv_srv_uav.srvGPU);
-			if (dx12_gp->rootSignature->uavIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->uavIndex, currentHeap_cbv_srv_uav.uavGPU);
-			if (dx12_gp->rootSignature->cbvIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->cbvIndex, currentHeap_cbv_srv_uav.cbvGPU);
-			if (dx12_gp->rootSignature->samplerIndex != UINT32_MAX)
-				cmdI->cmdList()->SetGraphicsRootDescriptorTable(dx12_gp->rootSignature->samplerIndex, currentHeap_sampler.samplerGPU);
+			// Set the pipeline, the root signature and the tables, unless they are already set
+			bind_graphics_pipeline(cmdI, dx12_gp);
 
 			// Set the right stencil
 			cmdI->cmdList()->OMSetStencilRef(dx12_gp->stencilRef);
@@ -1808,9 +1491,6 @@ namespace d3d12
 
 			// Execute the command
 			cmdI->cmdList()->ExecuteIndirect(dx12_gp->commandSignature, 1, dx12_indirectBuffer->resource, bufferOffset, nullptr, 0);
-
-			// This heap has been used for the current command buffer batch, we need to move to the next one
-			dx12_gp->nextUsableHeap++;
 		}
 
 		void build_blas(CommandBuffer cmdB, BottomLevelAS blas)
@@ -76,12 +76,21 @@ namespace d3d12
         void destroy_command_queue(CommandQueue commandQueue)
         {
             DX12CommandQueue* dx12_commandQueue = (DX12CommandQueue*)commandQueue;
+            flush_descriptor_rings(dx12_commandQueue->deviceI);
             destroy_sub_command_queue(dx12_commandQueue->directSubQueue);
             destroy_sub_command_queue(dx12_commandQueue->computeSubQueue);
             destroy_sub_command_queue(dx12_commandQueue->copySubQueue);
             delete dx12_commandQueue;
         }
 
+        void signal_descriptor_rings(DX12GraphicsDevice* deviceI, DX12CommandSubQueue& subQueue)
+        {
+            // The descriptors used by this submission are recycled once the fence reaches this value
+            subQueue.fenceValue++;
+            subQueue.queue->Signal(subQueue.fence, subQueue.fenceValue);
+            track_descriptor_rings(deviceI, subQueue.fence, subQueue.fenceValue);
+        }
+
         void execute_command_buffer(CommandQueue commandQueue, CommandBuffer commandBuffer, bool)
         {
             // Grab the internal structures
@@ -93,9 +102,11 @@ namespace d3d12
             {
                 case D3D12_COMMAND_LIST_TYPE_DIRECT:
                     dx12_commandQueue->directSubQueue.queue->ExecuteCommandLists(1, commandLists);
+                    signal_descriptor_rings(dx12_commandQueue->deviceI, dx12_commandQueue->directSubQueue);
                 break;
                 case D3D12_COMMAND_LIST_TYPE_COMPUTE:
                     dx12_commandQueue->computeSubQueue.queue->ExecuteCommandLists(1, commandLists);
+                    signal_descriptor_rings(dx12_commandQueue->deviceI, dx12_commandQueue->computeSubQueue);
                 break;
                 case D3D12_COMMAND_LIST_TYPE_COPY:
                     dx12_commandQueue->copySubQueue.queue->ExecuteCommandLists(1, commandLists);
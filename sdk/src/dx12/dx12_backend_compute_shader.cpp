@@ -192,11 +192,9 @@ namespace d3d12
 			cS->uavCount = uavCount;
 			cS->samplerCount = samplerCount;
 
-			// Create the descriptor heap for this compute shader
-			cS->CSUHeaps.push_back(create_descriptor_heap_suc(deviceI, srvCount, uavCount, cbvCount));
-			cS->samplerHeaps.push_back(create_descriptor_heap_sampler(deviceI, std::max(samplerCount, 1u)));
-			cS->cmdBatchIndex = UINT32_MAX;
-			cS->nextUsableHeap = 0;
+			// Create the staging heaps for this compute shader
+			cS->CSUHeap = create_descriptor_heap_suc(deviceI, srvCount, uavCount, cbvCount);
+			cS->samplerHeap = create_descriptor_heap_sampler(deviceI, std::max(samplerCount, 1u));
 
 			// Create the command signature and append it
 			D3D12_INDIRECT_ARGUMENT_DESC argumentDescs[1];
@@ -219,13 +217,9 @@ namespace d3d12
 			// Grab the internal structure
 			DX12ComputeShader* dx12_computeShader = (DX12ComputeShader*)computeShader;
 
-			// Destroy all the descriptor heaps
-			uint32_t numDescriptorHeaps = (uint32_t)dx12_computeShader->CSUHeaps.size();
-			for (uint32_t heapIdx = 0; heapIdx < numDescriptorHeaps; ++heapIdx)
-			{
-				destroy_descriptor_heap(dx12_computeShader->CSUHeaps[heapIdx]);
-				destroy_descriptor_heap(dx12_computeShader->samplerHeaps[heapIdx]);
-			}
+			// Destroy the staging heaps
+			destroy_descriptor_heap(dx12_computeShader->CSUHeap);
+			destroy_descriptor_heap(dx12_computeShader->samplerHeap);
 
 			dx12_computeShader->commandSignature->Release();
 			dx12_computeShader->shaderBlob->Release();
@@ -46,5 +46,13 @@ namespace d3d12
             ID3D12Fence* dx12_fence = (ID3D12Fence*)fence;
             return dx12_fence->GetCompletedValue();
         }
+
+        void wait_value(Fence fence, uint64_t value)
+        {
+            // Without an event, SetEventOnCompletion returns once the value is reached
+            ID3D12Fence* dx12_fence = (ID3D12Fence*)fence;
+            if (dx12_fence->GetCompletedValue() < value)
+                assert_msg(dx12_fence->SetEventOnCompletion(value, nullptr) == S_OK, "Failed to wait for the fence");
+        }
     }
 }
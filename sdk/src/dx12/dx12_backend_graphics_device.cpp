@@ -198,6 +198,9 @@ namespace d3d12
             for (int i = 0; i < D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES; ++i)
                 dx12_device->descriptorSize[i] = dx12_device->device->GetDescriptorHandleIncrementSize((D3D12_DESCRIPTOR_HEAP_TYPE)i);
 
+            // Shader visible heaps shared by all the command buffers
+            create_descriptor_rings(dx12_device);
+
             // Get the vendor
             dx12_device->vendor = vendor_id_to_vendor(dxgiAdapterDesc1.VendorId);
 
@@ -254,7 +257,9 @@ namespace d3d12
                 && dx12_device->allocatedCS == 0
                 && dx12_device->allocatedGP == 0, "Graphics Device has still active resources");
 
-            // Release the devfice
+            // Release the descriptor rings, the view cache and the device
+            destroy_descriptor_rings(dx12_device);
+            destroy_view_heaps(dx12_device);
             dx12_device->device->Release();
 
             // Destroty the internal structure
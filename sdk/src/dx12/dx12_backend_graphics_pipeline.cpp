@@ -324,11 +324,9 @@ namespace d3d12
             commandSignatureDesc.ByteStride = sizeof(D3D12_DRAW_ARGUMENTS);
             assert(deviceI->device->CreateCommandSignature(&commandSignatureDesc, nullptr, IID_PPV_ARGS(&dx12_gp->commandSignature)) == S_OK);
 
-            // Create the descriptor heap for this compute shader
-            dx12_gp->CSUHeaps.push_back(create_descriptor_heap_suc(deviceI, srvCount, uavCount, cbvCount));
-            dx12_gp->samplerHeaps.push_back(create_descriptor_heap_sampler(deviceI, std::max(1u, samplerCount)));
-            dx12_gp->cmdBatchIndex = UINT32_MAX;
-            dx12_gp->nextUsableHeap = 0;
+            // Create the staging heaps for this pipeline
+            dx12_gp->CSUHeap = create_descriptor_heap_suc(deviceI, srvCount, uavCount, cbvCount);
+            dx12_gp->samplerHeap = create_descriptor_heap_sampler(deviceI, std::max(1u, samplerCount));
             dx12_gp->srvCount = srvCount;
             dx12_gp->uavCount = uavCount;
             dx12_gp->cbvCount = cbvCount;
@@ -421,13 +419,9 @@ namespace d3d12
             // Grab the internal structure
             DX12GraphicsPipeline* dx12_gp = (DX12GraphicsPipeline*)graphicsPipeline;
 
-            // Destroy all the descriptor heaps
-            uint32_t numDescriptorHeaps = (uint32_t)dx12_gp->CSUHeaps.size();
-            for (uint32_t heapIdx = 0; heapIdx < numDescriptorHeaps; ++heapIdx)
-            {
-                destroy_descriptor_heap(dx12_gp->CSUHeaps[heapIdx]);
-                destroy_descriptor_heap(dx12_gp->samplerHeaps[heapIdx]);
-            }
+            // Destroy the staging heaps
+            destroy_descriptor_heap(dx12_gp->CSUHeap);
+            destroy_descriptor_heap(dx12_gp->samplerHeap);
 
             // Destroy the dx12 objects
             dx12_gp->commandSignature->Release();
@@ -16,6 +16,13 @@ namespace d3d12
 {
 	namespace resources
 	{
+		static void release_texture_views(DX12GraphicsDevice* deviceI, DX12Texture* texture)
+		{
+			release_resource_view(deviceI, texture->srv);
+			for (DX12ResourceView& view : texture->uavs)
+				release_resource_view(deviceI, view);
+		}
+
 		Texture create_texture(GraphicsDevice graphicsDevice, TextureType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipCount, bool isUAV, TextureFormat format, float4 clearColor, const char* debugName)
 		{
 			TextureDescriptor texDescriptor;
@@ -93,6 +100,7 @@ namespace d3d12
 		void destroy_texture(Texture texture)
 		{
 			DX12Texture* dx12_graphicsTexture = (DX12Texture*)texture;
+			release_texture_views(dx12_graphicsTexture->deviceI, dx12_graphicsTexture);
 			dx12_graphicsTexture->resource->Release();
 
 			// Resource tracking
@@ -186,7 +194,7 @@ namespace d3d12
 				resource->SetName(convert_to_wide(rtDesc.debugName).c_str());
 
 			// Create the descriptor heap for the view
-			ID3D12DescriptorHeap* descHeap = create_descriptor_heap_internal(deviceI, 1, isDepth ? D3D12_DESCRIPTOR_HEAP_TYPE_DSV : D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+			ID3D12DescriptorHeap* descHeap = create_descriptor_heap_internal(deviceI, 1, isDepth ? D3D12_DESCRIPTOR_HEAP_TYPE_DSV : D3D12_DESCRIPTOR_HEAP_TYPE_RTV, false);
 
 			// Create a depth stencil view description.
 			D3D12_DEPTH_STENCIL_VIEW_DESC depthStencilViewDsc = {};
@@ -227,6 +235,7 @@ namespace d3d12
 		void destroy_render_texture(RenderTexture renderTexture)
 		{
 			DX12RenderTexture* dx12_graphicsTexture = (DX12RenderTexture*)renderTexture;
+			release_texture_views(dx12_graphicsTexture->deviceI, &dx12_graphicsTexture->texture);
 			dx12_graphicsTexture->descriptorHeap->Release();
 			dx12_graphicsTexture->texture.resource->Release();
 
@@ -305,6 +314,9 @@ namespace d3d12
 		void destroy_graphics_buffer(GraphicsBuffer graphicsBuffer)
 		{
 			DX12GraphicsBuffer* dx12_buffer = (DX12GraphicsBuffer*)graphicsBuffer;
+			release_resource_view(dx12_buffer->device, dx12_buffer->srv);
+			release_resource_view(dx12_buffer->device, dx12_buffer->uav);
+			release_resource_view(dx12_buffer->device, dx12_buffer->cbv);
 			dx12_buffer->resource->Release();
 			dx12_buffer->device->allocatedMemory -= dx12_buffer->bufferSize;
 
@@ -432,6 +444,7 @@ namespace d3d12
 
 			// Keep track of the sampler descriptor
 			beSampler->resource = smplDesc;
+			beSampler->id = dx12_device->nextViewID++;
 
 			// Resource tracking
 			dx12_device->allocatedSamplers++;
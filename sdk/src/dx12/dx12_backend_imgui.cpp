@@ -85,6 +85,9 @@ namespace d3d12
             dx12_cmd->cmdList()->OMSetRenderTargets(1, &rtvHandle, FALSE, nullptr);
             dx12_cmd->cmdList()->SetDescriptorHeaps(1, &imguiDescHeap);
             ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), dx12_cmd->cmdList());
+
+            // The pipeline, root signature and heaps were replaced by the imgui ones
+            state_tracker::invalidate(dx12_cmd->state);
         }
 
         void handle_input(RenderWindow window, const EventData& data)
@@ -78,7 +78,7 @@ namespace d3d12
 			swapChainI->currentBackBuffer = swapChainI->swapChain->GetCurrentBackBufferIndex();
 
 			// Create the descriptor heap for the swap chain
-			swapChainI->descriptorHeap = create_descriptor_heap_internal(deviceI, DX12_NUM_FRAMES, (uint32_t)D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+			swapChainI->descriptorHeap = create_descriptor_heap_internal(deviceI, DX12_NUM_FRAMES, (uint32_t)D3D12_DESCRIPTOR_HEAP_TYPE_RTV, false);
 
 			// Start of the heap
 			D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle(swapChainI->descriptorHeap->GetCPUDescriptorHandleForHeapStart());
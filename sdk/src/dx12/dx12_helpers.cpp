@@ -283,7 +283,7 @@ namespace d3d12
         return D3D12_COMMAND_QUEUE_PRIORITY_NORMAL;
     }
 
-    ID3D12DescriptorHeap* create_descriptor_heap_internal(DX12GraphicsDevice* deviceI, uint32_t numDescriptors, uint32_t opaqueType)
+    ID3D12DescriptorHeap* create_descriptor_heap_internal(DX12GraphicsDevice* deviceI, uint32_t numDescriptors, uint32_t opaqueType, bool shaderVisible)
     {
         // Get the actual type
         D3D12_DESCRIPTOR_HEAP_TYPE type = (D3D12_DESCRIPTOR_HEAP_TYPE)opaqueType;
@@ -292,10 +292,7 @@ namespace d3d12
         D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
         rtvHeapDesc.NumDescriptors = numDescriptors;
         rtvHeapDesc.Type = type;
-        if (type == D3D12_DESCRIPTOR_HEAP_TYPE_RTV || type == D3D12_DESCRIPTOR_HEAP_TYPE_DSV)
-            rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-        else
-            rtvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+        rtvHeapDesc.Flags = shaderVisible ? D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE : D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
 
         ID3D12DescriptorHeap* descriptorHeap;
         assert_msg(device->CreateDescriptorHeap(&rtvHeapDesc, IID_PPV_ARGS(&descriptorHeap)) == S_OK, "Failed to create descriptor heap.");
@@ -309,9 +306,9 @@ namespace d3d12
 
     DX12DescriptorHeap create_descriptor_heap_suc(DX12GraphicsDevice* deviceI, uint32_t srvCount, uint32_t uavCount, uint32_t cbvCount)
     {
-        // Create the descriptor heap for this compute shader
+        // Create the staging heap of the shader, it is copied in the descriptor ring at dispatch time
         DX12DescriptorHeap descriptorHeap;
-        ID3D12DescriptorHeap* descHeap = create_descriptor_heap_internal(deviceI, srvCount + uavCount + cbvCount, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        ID3D12DescriptorHeap* descHeap = create_descriptor_heap_internal(deviceI, srvCount + uavCount + cbvCount, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, false);
         descriptorHeap.descriptorHeap = descHeap;
         descriptorHeap.type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
 
@@ -323,29 +320,25 @@ namespace d3d12
         descriptorHeap.cbvCPU = descriptorHeap.uavCPU;
         descriptorHeap.cbvCPU.ptr += (uint64_t)uavCount * descSize;
 
-        // Pre-evaluate the GPU Heap handles
-        descriptorHeap.srvGPU = descHeap->GetGPUDescriptorHandleForHeapStart();
-        descriptorHeap.uavGPU = descriptorHeap.srvGPU;
-        descriptorHeap.uavGPU.ptr += (uint64_t)srvCount * descSize;
-        descriptorHeap.cbvGPU = descriptorHeap.uavGPU;
-        descriptorHeap.cbvGPU.ptr += (uint64_t)uavCount * descSize;
+        // Nothing is known about the content of the descriptors
+        descriptorHeap.boundViews.resize(srvCount + uavCount + cbvCount, 0);
 
         return descriptorHeap;
     }
 
     DX12DescriptorHeap create_descriptor_heap_sampler(DX12GraphicsDevice* deviceI, uint32_t samplerCount)
     {
-        // Create the descriptor heap for this compute shader
+        // Create the staging heap of the shader, it is copied in the descriptor ring at dispatch time
         DX12DescriptorHeap descriptorHeap;
-        ID3D12DescriptorHeap* descHeap = create_descriptor_heap_internal(deviceI, samplerCount, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+        ID3D12DescriptorHeap* descHeap = create_descriptor_heap_internal(deviceI, samplerCount, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, false);
         descriptorHeap.descriptorHeap = descHeap;
         descriptorHeap.type = D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER;
 
         // Pre-evaluate the CPU Heap handles
         descriptorHeap.samplerCPU = descHeap->GetCPUDescriptorHandleForHeapStart();
 
-        // Pre-evaluate the GPU Heap handles
-        descriptorHeap.samplerGPU = descHeap->GetGPUDescriptorHandleForHeapStart();
+        // Nothing is known about the content of the descriptors
+        descriptorHeap.boundViews.resize(samplerCount, 0);
 
         return descriptorHeap;
     }
@@ -466,7 +459,7 @@ namespace d3d12
         delete rootSignature;
     }
 
-    void query_bindings(IDxcBlob* blob, uint32_t& cbvCount, uint32_t& srvCount, uint32_t& uavCount, uint32_t& samplerCount, std::map<std::string, DX12Binding>& outBindings)
+    void query_bindings(IDxcBlob* blob, uint32_t& cbvCount, uint32_t& srvCount, uint32_t& uavCount, uint32_t& samplerCount, std::vector<DX12Binding>& outBindings)
     {
         // Create the dxcUtils
         IDxcUtils* utils;
@@ -524,8 +517,15 @@ namespace d3d12
                     break;
             }
 
-            // Add the binding
-            outBindings[bindDesc.Name] = { bindType, (uint8_t)bindDesc.BindPoint };
+            // Add the binding, the stages of a pipeline can declare the same one
+            const DX12Binding binding = { binding_hash(bindDesc.Name), bindType, (uint8_t)bindDesc.BindPoint };
+            auto it = std::lower_bound(outBindings.begin(), outBindings.end(), binding.nameHash, [](const DX12Binding& bind, uint32_t hash) { return bind.nameHash < hash; });
+            if (it != outBindings.end() && it->nameHash == binding.nameHash)
+            {
+                assert_msg(it->type == binding.type && it->slot == binding.slot, "Binding name hash collision.");
+                continue;
+            }
+            outBindings.insert(it, binding);
         }
 
         // Release the reflection
@@ -536,57 +536,471 @@ namespace d3d12
             cbvCount = 1;
     }
 
-    bool request_binding(const std::map<std::string, DX12Binding>& bindings, const char* name, DX12Binding& outBind)
+    bool request_binding(const std::vector<DX12Binding>& bindings, BindingSlot slot, DX12Binding& outBind)
     {
-        auto it = bindings.find(name);
-        if (it != bindings.end())
+        auto it = std::lower_bound(bindings.begin(), bindings.end(), slot.hash, [](const DX12Binding& bind, uint32_t hash) { return bind.nameHash < hash; });
+        if (it != bindings.end() && it->nameHash == slot.hash)
         {
-            outBind = it->second;
+            outBind = *it;
             return true;
         }
         return false;
     }
 
-    void validate_compute_shader_heap(DX12ComputeShader* computeShader, uint32_t cmdBatchIndex)
+    void create_buffer_srv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer, uint64_t firstElement, D3D12_CPU_DESCRIPTOR_HANDLE handle)
+    {
+        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+        srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+        srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3);
+        D3D12_BUFFER_SRV bufferSRV;
+        bufferSRV.FirstElement = firstElement;
+        bufferSRV.NumElements = (uint32_t)(buffer->bufferSize / buffer->elementSize - firstElement);
+        bufferSRV.StructureByteStride = buffer->elementSize;
+        bufferSRV.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
+        srvDesc.Buffer = bufferSRV;
+        deviceI->device->CreateShaderResourceView(buffer->resource, &srvDesc, handle);
+    }
+
+    void create_buffer_uav(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer, uint64_t firstElement, D3D12_CPU_DESCRIPTOR_HANDLE handle)
+    {
+        D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+        ZeroMemory(&uavDesc, sizeof(D3D12_UNORDERED_ACCESS_VIEW_DESC));
+        uavDesc.Format = DXGI_FORMAT_UNKNOWN;
+        uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
+        D3D12_BUFFER_UAV bufferUAV;
+        bufferUAV.FirstElement = firstElement;
+        bufferUAV.NumElements = (uint32_t)(buffer->bufferSize / buffer->elementSize - firstElement);
+        bufferUAV.StructureByteStride = buffer->elementSize;
+        bufferUAV.Flags = D3D12_BUFFER_UAV_FLAG_NONE;
+        bufferUAV.CounterOffsetInBytes = 0;
+        uavDesc.Buffer = bufferUAV;
+        deviceI->device->CreateUnorderedAccessView(buffer->resource, nullptr, &uavDesc, handle);
+    }
+
+    void create_buffer_cbv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer, D3D12_CPU_DESCRIPTOR_HANDLE handle)
+    {
+        D3D12_CONSTANT_BUFFER_VIEW_DESC cbvView;
+        cbvView.BufferLocation = buffer->resource->GetGPUVirtualAddress();
+        cbvView.SizeInBytes = (uint32_t)buffer->bufferSize;
+        deviceI->device->CreateConstantBufferView(&cbvView, handle);
+    }
+
+    void create_texture_srv(DX12GraphicsDevice* deviceI, DX12Texture* texture, D3D12_CPU_DESCRIPTOR_HANDLE handle)
     {
-        // We need to check if we've entered a new frame. If it is the case we just need to:
-        //  - Update the next usable heap to the first one and we're done
-        //  - Update the command buffer batch index accordinly
-        // This is true because we always have at least one allocated heap.
-        if (computeShader->cmdBatchIndex != cmdBatchIndex)
+        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+        srvDesc.Format = sanitize_dxgi_format_srv(texture->format);
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+        srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2, D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3);
+        switch (texture->type)
         {
-            computeShader->nextUsableHeap = 0;
-            computeShader->cmdBatchIndex = cmdBatchIndex;
-            return;
+            case TextureType::Tex1D:
+            {
+                D3D12_TEX1D_SRV tex1D;
+                tex1D.MostDetailedMip = 0;
+                tex1D.MipLevels = texture->mipLevels;
+                tex1D.ResourceMinLODClamp = 0;
+                srvDesc.Texture1D = tex1D;
+                srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE1D;
+            }
+            break;
+            case TextureType::Tex2D:
+            {
+                D3D12_TEX2D_SRV tex2D;
+                tex2D.MostDetailedMip = 0;
+                tex2D.MipLevels = texture->mipLevels;
+                tex2D.PlaneSlice = 0;
+                tex2D.ResourceMinLODClamp = 0;
+                srvDesc.Texture2D = tex2D;
+                srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+            }
+            break;
+            case TextureType::Tex2DArray:
+            {
+                D3D12_TEX2D_ARRAY_SRV tex2DArray;
+                tex2DArray.MostDetailedMip = 0;
+                tex2DArray.MipLevels = texture->mipLevels;
+                tex2DArray.FirstArraySlice = 0;
+                tex2DArray.ArraySize = texture->depth;
+                tex2DArray.PlaneSlice = 0;
+                tex2DArray.ResourceMinLODClamp = 0;
+                srvDesc.Texture2DArray = tex2DArray;
+                srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+            }
+            break;
+            case TextureType::TexCube:
+            {
+                D3D12_TEXCUBE_SRV texCube;
+                texCube.MostDetailedMip = 0;
+                texCube.MipLevels = texture->mipLevels;
+                texCube.ResourceMinLODClamp = 0;
+                srvDesc.TextureCube = texCube;
+                srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+            }
+            break;
+            default:
+                assert_fail();
+        }
+        deviceI->device->CreateShaderResourceView(texture->resource, &srvDesc, handle);
+    }
+
+    void create_texture_uav(DX12GraphicsDevice* deviceI, DX12Texture* texture, uint32_t mipLevel, D3D12_CPU_DESCRIPTOR_HANDLE handle)
+    {
+        D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+        ZeroMemory(&uavDesc, sizeof(D3D12_UNORDERED_ACCESS_VIEW_DESC));
+        uavDesc.Format = texture->format;
+        switch (texture->type)
+        {
+            case TextureType::Tex2D:
+            {
+                D3D12_TEX2D_UAV tex2DAUAV;
+                tex2DAUAV.MipSlice = mipLevel;
+                tex2DAUAV.PlaneSlice = 0;
+                uavDesc.Texture2D = tex2DAUAV;
+                uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+            }
+            break;
+            case TextureType::Tex2DArray:
+            {
+                D3D12_TEX2D_ARRAY_UAV tex2DArrayUAV;
+                tex2DArrayUAV.MipSlice = mipLevel;
+                tex2DArrayUAV.FirstArraySlice = 0;
+                tex2DArrayUAV.ArraySize = texture->depth;
+                tex2DArrayUAV.PlaneSlice = 0;
+                uavDesc.Texture2DArray = tex2DArrayUAV;
+                uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY;
+            }
+            break;
+            case TextureType::TexCube:
+            {
+                D3D12_TEX2D_ARRAY_UAV tex2DArrayUAV;
+                tex2DArrayUAV.MipSlice = mipLevel;
+                tex2DArrayUAV.FirstArraySlice = 0;
+                tex2DArrayUAV.ArraySize = 6;
+                tex2DArrayUAV.PlaneSlice = 0;
+                uavDesc.Texture2DArray = tex2DArrayUAV;
+                uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY;
+            }
+            break;
+            default:
+                assert_fail();
+        }
+        deviceI->device->CreateUnorderedAccessView(texture->resource, nullptr, &uavDesc, handle);
+    }
+
+    static DX12ResourceView allocate_resource_view(DX12GraphicsDevice* deviceI)
+    {
+        DX12ResourceView view;
+        if (!deviceI->freeViews.empty())
+        {
+            // Recycle a released slot
+            view.index = deviceI->freeViews.back();
+            deviceI->freeViews.pop_back();
+        }
+        else
+        {
+            // Add a heap if all of them are full
+            view.index = deviceI->numViews++;
+            if (view.index / DX12_VIEW_HEAP_SIZE == deviceI->viewHeaps.size())
+            {
+                D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+                heapDesc.NumDescriptors = DX12_VIEW_HEAP_SIZE;
+                heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+                heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+                ID3D12DescriptorHeap* descriptorHeap;
+                assert_msg(deviceI->device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&descriptorHeap)) == S_OK, "Failed to create view heap.");
+                deviceI->viewHeaps.push_back(descriptorHeap);
+            }
+        }
+
+        // Evaluate the CPU handle
+        view.id = deviceI->nextViewID++;
+        view.handle = deviceI->viewHeaps[view.index / DX12_VIEW_HEAP_SIZE]->GetCPUDescriptorHandleForHeapStart();
+        view.handle.ptr += (uint64_t)deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV] * (view.index % DX12_VIEW_HEAP_SIZE);
+        return view;
+    }
+
+    const DX12ResourceView& buffer_srv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer)
+    {
+        if (buffer->srv.id == 0)
+        {
+            buffer->srv = allocate_resource_view(deviceI);
+            create_buffer_srv(deviceI, buffer, 0, buffer->srv.handle);
+        }
+        return buffer->srv;
+    }
+
+    const DX12ResourceView& buffer_uav(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer)
+    {
+        if (buffer->uav.id == 0)
+        {
+            buffer->uav = allocate_resource_view(deviceI);
+            create_buffer_uav(deviceI, buffer, 0, buffer->uav.handle);
+        }
+        return buffer->uav;
+    }
+
+    const DX12ResourceView& buffer_cbv(DX12GraphicsDevice* deviceI, DX12GraphicsBuffer* buffer)
+    {
+        if (buffer->cbv.id == 0)
+        {
+            buffer->cbv = allocate_resource_view(deviceI);
+            create_buffer_cbv(deviceI, buffer, buffer->cbv.handle);
         }
+        return buffer->cbv;
+    }
 
-        // If we're tracking properly the current batch but a new heap is required, we need to allocate it.
-        if (computeShader->CSUHeaps.size() == computeShader->nextUsableHeap)
+    const DX12ResourceView& texture_srv(DX12GraphicsDevice* deviceI, DX12Texture* texture)
+    {
+        if (texture->srv.id == 0)
         {
-            // Make sure there are enough heaps
-            computeShader->CSUHeaps.push_back(create_descriptor_heap_suc(computeShader->device, computeShader->srvCount, computeShader->uavCount, computeShader->cbvCount));
-            computeShader->samplerHeaps.push_back(create_descriptor_heap_sampler(computeShader->device, std::max(computeShader->samplerCount, 1u)));
+            texture->srv = allocate_resource_view(deviceI);
+            create_texture_srv(deviceI, texture, texture->srv.handle);
         }
+        return texture->srv;
     }
 
-    void validate_graphics_pipeline_heap(DX12GraphicsPipeline* graphicsPipeline, uint32_t cmdBatchIndex)
+    const DX12ResourceView& texture_uav(DX12GraphicsDevice* deviceI, DX12Texture* texture, uint32_t mipLevel)
     {
-        // We need to check if we've entered a new frame. If it is the case we just need to:
-        //  - Update the next usable heap to the first one and we're done
-        //  - Update the command buffer batch index accordinly
-        // This is true because we always have at least one allocated heap.
-        if (graphicsPipeline->cmdBatchIndex != cmdBatchIndex)
+        if (texture->uavs.size() <= mipLevel)
+            texture->uavs.resize(mipLevel + 1);
+        DX12ResourceView& view = texture->uavs[mipLevel];
+        if (view.id == 0)
         {
-            graphicsPipeline->nextUsableHeap = 0;
-            graphicsPipeline->cmdBatchIndex = cmdBatchIndex;
+            view = allocate_resource_view(deviceI);
+            create_texture_uav(deviceI, texture, mipLevel, view.handle);
+        }
+        return view;
+    }
+
+    void release_resource_view(DX12GraphicsDevice* deviceI, DX12ResourceView& view)
+    {
+        if (view.id == 0)
+            return;
+        deviceI->freeViews.push_back(view.index);
+        view = DX12ResourceView();
+    }
+
+    void destroy_view_heaps(DX12GraphicsDevice* deviceI)
+    {
+        for (ID3D12DescriptorHeap* descriptorHeap : deviceI->viewHeaps)
+            descriptorHeap->Release();
+        deviceI->viewHeaps.clear();
+        deviceI->freeViews.clear();
+        deviceI->numViews = 0;
+    }
+
+    static uint64_t& bound_view(DX12GraphicsDevice* deviceI, DX12DescriptorHeap& heap, D3D12_CPU_DESCRIPTOR_HANDLE destination)
+    {
+        // The SRVs, UAVs and CBVs are contiguous in the heap
+        const uint64_t descIdx = (destination.ptr - heap.srvCPU.ptr) / deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
+        return heap.boundViews[descIdx];
+    }
+
+    void copy_resource_view(DX12GraphicsDevice* deviceI, DX12DescriptorHeap& heap, D3D12_CPU_DESCRIPTOR_HANDLE destination, const DX12ResourceView& view)
+    {
+        // Skip the copy if the descriptor already holds this view
+        uint64_t& boundView = bound_view(deviceI, heap, destination);
+        if (boundView == view.id)
             return;
+        deviceI->device->CopyDescriptorsSimple(1, destination, view.handle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        boundView = view.id;
+        heap.dirty = true;
+    }
+
+    void invalidate_resource_view(DX12GraphicsDevice* deviceI, DX12DescriptorHeap& heap, D3D12_CPU_DESCRIPTOR_HANDLE destination)
+    {
+        bound_view(deviceI, heap, destination) = 0;
+        heap.dirty = true;
+    }
+
+    static DX12DescriptorRing create_descriptor_ring(DX12GraphicsDevice* deviceI, uint32_t capacity, D3D12_DESCRIPTOR_HEAP_TYPE type)
+    {
+        DX12DescriptorRing ring;
+        ring.descriptorHeap = create_descriptor_heap_internal(deviceI, capacity, type, true);
+        ring.cpuStart = ring.descriptorHeap->GetCPUDescriptorHandleForHeapStart();
+        ring.gpuStart = ring.descriptorHeap->GetGPUDescriptorHandleForHeapStart();
+        ring.capacity = capacity;
+        return ring;
+    }
+
+    void create_descriptor_rings(DX12GraphicsDevice* deviceI)
+    {
+        deviceI->csuRing = create_descriptor_ring(deviceI, DX12_DESCRIPTOR_RING_SIZE, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        deviceI->samplerRing = create_descriptor_ring(deviceI, DX12_SAMPLER_RING_SIZE, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+    }
+
+    void destroy_descriptor_rings(DX12GraphicsDevice* deviceI)
+    {
+        deviceI->csuRing.descriptorHeap->Release();
+        deviceI->samplerRing.descriptorHeap->Release();
+        deviceI->ringSubmissions.clear();
+    }
+
+    static void retire_ring_submission(DX12GraphicsDevice* deviceI)
+    {
+        // The GPU is done with everything allocated before this submission
+        const DX12RingSubmission& submission = deviceI->ringSubmissions.front();
+        deviceI->csuRing.tail = submission.csuHead;
+        deviceI->samplerRing.tail = submission.samplerHead;
+        deviceI->ringSubmissions.pop_front();
+    }
+
+    static void wait_ring_submission(DX12GraphicsDevice* deviceI)
+    {
+        // Block until the oldest submission is done, then recycle it
+        const DX12RingSubmission& submission = deviceI->ringSubmissions.front();
+        if (submission.fence->GetCompletedValue() < submission.fenceValue)
+            submission.fence->SetEventOnCompletion(submission.fenceValue, nullptr);
+        retire_ring_submission(deviceI);
+    }
+
+    void track_descriptor_rings(DX12GraphicsDevice* deviceI, ID3D12Fence* fence, uint64_t fenceValue)
+    {
+        // Recycle the submissions that are already done
+        while (!deviceI->ringSubmissions.empty() && deviceI->ringSubmissions.front().fence->GetCompletedValue() >= deviceI->ringSubmissions.front().fenceValue)
+            retire_ring_submission(deviceI);
+
+        // Everything allocated so far can be recycled once the fence reaches this value, the command buffers
+        // that record bindings are submitted in the order they were recorded
+        DX12RingSubmission submission;
+        submission.csuHead = deviceI->csuRing.head;
+        submission.samplerHead = deviceI->samplerRing.head;
+        submission.fence = fence;
+        submission.fenceValue = fenceValue;
+        deviceI->ringSubmissions.push_back(submission);
+    }
+
+    void flush_descriptor_rings(DX12GraphicsDevice* deviceI)
+    {
+        // The fences of the pending submissions are about to be released
+        while (!deviceI->ringSubmissions.empty())
+            wait_ring_submission(deviceI);
+    }
+
+    static uint32_t allocate_ring_range(DX12GraphicsDevice* deviceI, DX12DescriptorRing& ring, uint32_t count)
+    {
+        assert_msg(count <= ring.capacity, "Descriptor table larger than the descriptor ring.");
+
+        // Tables are contiguous, skip the end of the heap if the range doesn't fit before it
+        uint64_t start = ring.head;
+        const uint64_t offset = start % ring.capacity;
+        if (offset + count > ring.capacity)
+            start += ring.capacity - offset;
+
+        // Wait for the oldest submissions until the range is free
+        while (start + count - ring.tail > ring.capacity)
+        {
+            assert_msg(!deviceI->ringSubmissions.empty(), "Descriptor ring overflow, too many descriptors recorded without a submission.");
+            wait_ring_submission(deviceI);
         }
 
-        // If we're tracking properly the current batch but a new heap is required, we need to allocate it.
-        if (graphicsPipeline->CSUHeaps.size() == graphicsPipeline->nextUsableHeap)
+        ring.head = start + count;
+        return (uint32_t)(start % ring.capacity);
+    }
+
+    static void set_ring_heaps(DX12CommandBuffer* cmdI)
+    {
+        // The device heaps only need to be set once per command list
+        if (!state_tracker::set_descriptor_heaps(cmdI->state))
+            return;
+        ID3D12DescriptorHeap* ppHeaps[] = { cmdI->deviceI->csuRing.descriptorHeap, cmdI->deviceI->samplerRing.descriptorHeap };
+        cmdI->cmdList()->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
+    }
+
+    static void copy_descriptor_tables(DX12CommandBuffer* cmdI, DX12DescriptorHeap& CSUHeap, DX12DescriptorHeap& samplerHeap, uint32_t srvCount, uint32_t uavCount, uint32_t cbvCount, uint32_t samplerCount, DX12DescriptorTables& tables)
+    {
+        // The ranges copied earlier in this recording are still valid if no binding changed since
+        if (!state_tracker::copy_descriptor_tables(cmdI->state, tables.recordingID, CSUHeap.dirty || samplerHeap.dirty))
+            return;
+
+        DX12GraphicsDevice* deviceI = cmdI->deviceI;
+        DX12DescriptorRing& csuRing = deviceI->csuRing;
+        DX12DescriptorRing& samplerRing = deviceI->samplerRing;
+
+        // Copy the staged SRVs, UAVs and CBVs in a new range, the previous ones may still be read by the GPU
+        const uint32_t csuSize = deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV];
+        const uint32_t numDescriptors = srvCount + uavCount + cbvCount;
+        const uint32_t csuIdx = allocate_ring_range(deviceI, csuRing, numDescriptors);
+        D3D12_CPU_DESCRIPTOR_HANDLE csuCPU = csuRing.cpuStart;
+        csuCPU.ptr += (uint64_t)csuIdx * csuSize;
+        deviceI->device->CopyDescriptorsSimple(numDescriptors, csuCPU, CSUHeap.srvCPU, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+        // Evaluate the tables, the SRVs, UAVs and CBVs are contiguous
+        tables.handles[0] = csuRing.gpuStart;
+        tables.handles[0].ptr += (uint64_t)csuIdx * csuSize;
+        tables.handles[1] = tables.handles[0];
+        tables.handles[1].ptr += (uint64_t)srvCount * csuSize;
+        tables.handles[2] = tables.handles[1];
+        tables.handles[2].ptr += (uint64_t)uavCount * csuSize;
+
+        // Same for the samplers
+        tables.handles[3] = {};
+        if (samplerCount > 0)
+        {
+            const uint32_t samplerSize = deviceI->descriptorSize[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER];
+            const uint32_t samplerIdx = allocate_ring_range(deviceI, samplerRing, samplerCount);
+            D3D12_CPU_DESCRIPTOR_HANDLE samplerCPU = samplerRing.cpuStart;
+            samplerCPU.ptr += (uint64_t)samplerIdx * samplerSize;
+            deviceI->device->CopyDescriptorsSimple(samplerCount, samplerCPU, samplerHeap.samplerCPU, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+            tables.handles[3] = samplerRing.gpuStart;
+            tables.handles[3].ptr += (uint64_t)samplerIdx * samplerSize;
+        }
+
+        // The staged descriptors are in sync with the ring
+        CSUHeap.dirty = false;
+        samplerHeap.dirty = false;
+    }
+
+    void bind_compute_shader(DX12CommandBuffer* cmdI, DX12ComputeShader* computeShader)
+    {
+        // Pipeline
+        if (state_tracker::set_pipeline_state(cmdI->state, (uint64_t)computeShader->pipelineStateObject))
+            cmdI->cmdList()->SetPipelineState(computeShader->pipelineStateObject);
+
+        // Root signature, changing it invalidates the bound tables
+        const DX12RootSignature* rootSignature = computeShader->rootSignature;
+        if (state_tracker::set_root_signature(cmdI->state, StateBindPoint::Compute, (uint64_t)rootSignature->rootSignature))
+            cmdI->cmdList()->SetComputeRootSignature(rootSignature->rootSignature);
+
+        // Copy the staged descriptors
+        set_ring_heaps(cmdI);
+        copy_descriptor_tables(cmdI, computeShader->CSUHeap, computeShader->samplerHeap, computeShader->srvCount, computeShader->uavCount, computeShader->cbvCount, computeShader->samplerCount, computeShader->tables);
+
+        // Bind the tables that changed
+        const uint32_t rootIndices[4] = { rootSignature->srvIndex, rootSignature->uavIndex, rootSignature->cbvIndex, rootSignature->samplerIndex };
+        for (uint32_t tableIdx = 0; tableIdx < 4; ++tableIdx)
+        {
+            const uint32_t rootIdx = rootIndices[tableIdx];
+            const D3D12_GPU_DESCRIPTOR_HANDLE handle = computeShader->tables.handles[tableIdx];
+            if (rootIdx != UINT32_MAX && state_tracker::set_root_table(cmdI->state, StateBindPoint::Compute, rootIdx, handle.ptr))
+                cmdI->cmdList()->SetComputeRootDescriptorTable(rootIdx, handle);
+        }
+    }
+
+    void bind_graphics_pipeline(DX12CommandBuffer* cmdI, DX12GraphicsPipeline* graphicsPipeline)
+    {
+        // Pipeline
+        if (state_tracker::set_pipeline_state(cmdI->state, (uint64_t)graphicsPipeline->pipelineStateObject))
+            cmdI->cmdList()->SetPipelineState(graphicsPipeline->pipelineStateObject);
+
+        // Root signature, changing it invalidates the bound tables
+        const DX12RootSignature* rootSignature = graphicsPipeline->rootSignature;
+        if (state_tracker::set_root_signature(cmdI->state, StateBindPoint::Graphics, (uint64_t)rootSignature->rootSignature))
+            cmdI->cmdList()->SetGraphicsRootSignature(rootSignature->rootSignature);
+
+        // Copy the staged descriptors
+        set_ring_heaps(cmdI);
+        copy_descriptor_tables(cmdI, graphicsPipeline->CSUHeap, graphicsPipeline->samplerHeap, graphicsPipeline->srvCount, graphicsPipeline->uavCount, graphicsPipeline->cbvCount, graphicsPipeline->samplerCount, graphicsPipeline->tables);
+
+        // Bind the tables that changed
+        const uint32_t rootIndices[4] = { rootSignature->srvIndex, rootSignature->uavIndex, rootSignature->cbvIndex, rootSignature->samplerIndex };
+        for (uint32_t tableIdx = 0; tableIdx < 4; ++tableIdx)
         {
-            graphicsPipeline->CSUHeaps.push_back(create_descriptor_heap_suc(graphicsPipeline->device, graphicsPipeline->srvCount, graphicsPipeline->uavCount, graphicsPipeline->cbvCount));
-            graphicsPipeline->samplerHeaps.push_back(create_descriptor_heap_sampler(graphicsPipeline->device, std::max(graphicsPipeline->samplerCount, 1u)));
+            const uint32_t rootIdx = rootIndices[tableIdx];
+            const D3D12_GPU_DESCRIPTOR_HANDLE handle = graphicsPipeline->tables.handles[tableIdx];
+            if (rootIdx != UINT32_MAX && state_tracker::set_root_table(cmdI->state, StateBindPoint::Graphics, rootIdx, handle.ptr))
+                cmdI->cmdList()->SetGraphicsRootDescriptorTable(rootIdx, handle);
         }
     }
 
@@ -10,6 +10,7 @@
 #if defined(D3D12_SUPPORTED)
 #include "dx12/dx12_backend.h"
 #endif
+#include "null/null_backend.h"
 #include "tools/security.h"
 
 struct BackendPointers
@@ -43,6 +44,8 @@ struct BackendPointers
     // Generic operations
     void (*__command_buffer__reset)(CommandBuffer commandBuffer) = nullptr;
     void (*__command_buffer__close)(CommandBuffer commandBuffer) = nullptr;
+    const StateStats& (*__command_buffer__state_statistics)(CommandBuffer commandBuffer) = nullptr;
+    void (*__command_buffer__reset_state_statistics)(CommandBuffer commandBuffer) = nullptr;
 
     // Render Texture
     void (*__command_buffer__clear_render_texture)(CommandBuffer, RenderTexture, const float4&) = nullptr;
@@ -80,23 +83,23 @@ struct BackendPointers
     void (*__command_buffer__transition_to_present)(CommandBuffer, RenderTexture) = nullptr;
 
     // Compute Shader
-    void (*__command_buffer__set_compute_shader_cbuffer)(CommandBuffer, ComputeShader, const char*, ConstantBuffer) = nullptr;
-    void (*__command_buffer__set_compute_shader_buffer)(CommandBuffer, ComputeShader, const char*, GraphicsBuffer) = nullptr;
-    void (*__command_buffer__set_compute_shader_texture)(CommandBuffer, ComputeShader, const char*, Texture, uint32_t) = nullptr;
-    void (*__command_buffer__set_compute_shader_render_texture)(CommandBuffer, ComputeShader, const char*, RenderTexture) = nullptr;
-    void (*__command_buffer__set_compute_shader_sampler)(CommandBuffer, ComputeShader, const char*, Sampler) = nullptr;
-    void (*__command_buffer__set_compute_shader_rtas)(CommandBuffer, ComputeShader, const char*, TopLevelAS) = nullptr;
+    void (*__command_buffer__set_compute_shader_cbuffer)(CommandBuffer, ComputeShader, BindingSlot, ConstantBuffer) = nullptr;
+    void (*__command_buffer__set_compute_shader_buffer)(CommandBuffer, ComputeShader, BindingSlot, GraphicsBuffer) = nullptr;
+    void (*__command_buffer__set_compute_shader_texture)(CommandBuffer, ComputeShader, BindingSlot, Texture, uint32_t) = nullptr;
+    void (*__command_buffer__set_compute_shader_render_texture)(CommandBuffer, ComputeShader, BindingSlot, RenderTexture) = nullptr;
+    void (*__command_buffer__set_compute_shader_sampler)(CommandBuffer, ComputeShader, BindingSlot, Sampler) = nullptr;
+    void (*__command_buffer__set_compute_shader_rtas)(CommandBuffer, ComputeShader, BindingSlot, TopLevelAS) = nullptr;
     void (*__command_buffer__dispatch)(CommandBuffer, ComputeShader, uint32_t, uint32_t, uint32_t) = nullptr;
     void (*__command_buffer__dispatch_indirect)(CommandBuffer, ComputeShader, GraphicsBuffer, uint32_t) = nullptr;
 
     // Graphics Pipeline
     void (*__command_buffer__set_viewport)(CommandBuffer, int32_t, int32_t, uint32_t, uint32_t) = nullptr;
-    void (*__command_buffer__set_graphics_pipeline_cbuffer)(CommandBuffer, GraphicsPipeline, const char*, ConstantBuffer) = nullptr;
-    void (*__command_buffer__set_graphics_pipeline_buffer)(CommandBuffer, GraphicsPipeline, const char*, GraphicsBuffer, uint64_t) = nullptr;
-    void (*__command_buffer__set_graphics_pipeline_texture)(CommandBuffer, GraphicsPipeline, const char*, Texture) = nullptr;
-    void (*__command_buffer__set_graphics_pipeline_render_texture)(CommandBuffer, GraphicsPipeline, const char*, RenderTexture) = nullptr;
-    void (*__command_buffer__set_graphics_pipeline_sampler)(CommandBuffer, GraphicsPipeline, const char*, Sampler) = nullptr;
-    void (*__command_buffer__set_graphics_pipeline_rtas)(CommandBuffer, GraphicsPipeline, const char*, TopLevelAS) = nullptr;
+    void (*__command_buffer__set_graphics_pipeline_cbuffer)(CommandBuffer, GraphicsPipeline, BindingSlot, ConstantBuffer) = nullptr;
+    void (*__command_buffer__set_graphics_pipeline_buffer)(CommandBuffer, GraphicsPipeline, BindingSlot, GraphicsBuffer, uint64_t) = nullptr;
+    void (*__command_buffer__set_graphics_pipeline_texture)(CommandBuffer, GraphicsPipeline, BindingSlot, Texture) = nullptr;
+    void (*__command_buffer__set_graphics_pipeline_render_texture)(CommandBuffer, GraphicsPipeline, BindingSlot, RenderTexture) = nullptr;
+    void (*__command_buffer__set_graphics_pipeline_sampler)(CommandBuffer, GraphicsPipeline, BindingSlot, Sampler) = nullptr;
+    void (*__command_buffer__set_graphics_pipeline_rtas)(CommandBuffer, GraphicsPipeline, BindingSlot, TopLevelAS) = nullptr;
     void (*__command_buffer__draw_indexed)(CommandBuffer, GraphicsPipeline, GraphicsBuffer, GraphicsBuffer, uint32_t, uint32_t, DrawPrimitive) = nullptr;
     void (*__command_buffer__draw_procedural)(CommandBuffer, GraphicsPipeline, uint32_t, uint32_t, DrawPrimitive) = nullptr;
     void (*__command_buffer__draw_procedural_indirect)(CommandBuffer, GraphicsPipeline, GraphicsBuffer, uint64_t) = nullptr;
@@ -191,6 +194,14 @@ struct BackendPointers
     uint64_t (*__profiling_scope__get_duration_us) (ProfilingScope profilingScope, CommandQueue cmdQ, CommandBufferType type) = nullptr;
 #pragma endregion
 
+#pragma region fence
+    Fence (*__fence__create_fence)(GraphicsDevice graphicsDevice, uint64_t initialValue) = nullptr;
+    void (*__fence__destroy_fence)(Fence fence) = nullptr;
+    void (*__fence__set_value)(Fence fence, uint64_t value) = nullptr;
+    uint64_t (*__fence__get_value)(Fence fence) = nullptr;
+    void (*__fence__wait_value)(Fence fence, uint64_t value) = nullptr;
+#pragma endregion
+
 #pragma region imgui
     bool (*__imgui__initialize_imgui)(GraphicsDevice device, RenderWindow window, TextureFormat format) = nullptr;
     void (*__imgui__release_imgui)() = nullptr;
@@ -237,6 +248,8 @@ namespace graphics
                 g_Backend.__command_buffer__destroy_command_buffer = d3d12::command_buffer::destroy_command_buffer;
                 g_Backend.__command_buffer__reset = d3d12::command_buffer::reset;
                 g_Backend.__command_buffer__close = d3d12::command_buffer::close;
+                g_Backend.__command_buffer__state_statistics = d3d12::command_buffer::state_statistics;
+                g_Backend.__command_buffer__reset_state_statistics = d3d12::command_buffer::reset_state_statistics;
                 g_Backend.__command_buffer__clear_render_texture = d3d12::command_buffer::clear_render_texture;
                 g_Backend.__command_buffer__clear_depth_texture = d3d12::command_buffer::clear_depth_texture;
                 g_Backend.__command_buffer__clear_depth_stencil_texture = d3d12::command_buffer::clear_depth_stencil_texture;
@@ -352,6 +365,13 @@ namespace graphics
                 g_Backend.__profiling_scope__destroy_profiling_scope = d3d12::profiling_scope::destroy_profiling_scope;
                 g_Backend.__profiling_scope__get_duration_us = d3d12::profiling_scope::get_duration_us;
 
+                // Fence
+                g_Backend.__fence__create_fence = d3d12::fence::create_fence;
+                g_Backend.__fence__destroy_fence = d3d12::fence::destroy_fence;
+                g_Backend.__fence__set_value = d3d12::fence::set_value;
+                g_Backend.__fence__get_value = d3d12::fence::get_value;
+                g_Backend.__fence__wait_value = d3d12::fence::wait_value;
+
                 // IMGUI
                 g_Backend.__imgui__initialize_imgui = d3d12::imgui::initialize_imgui;
                 g_Backend.__imgui__release_imgui = d3d12::imgui::release_imgui;
@@ -367,6 +387,166 @@ namespace graphics
                 printf("DX12 not supported by this build.\n");
 #endif
             break;
+            case GraphicsAPI::Null:
+                // Device
+                g_Backend.__device__enable_experimental_features = null_backend::device::enable_experimental_features;
+                g_Backend.__device__enable_debug_layer = null_backend::device::enable_debug_layer;
+                g_Backend.__device__create_graphics_device = null_backend::device::create_graphics_device;
+                g_Backend.__device__destroy_graphics_device = null_backend::device::destroy_graphics_device;
+                g_Backend.__device__get_gpu_vendor = null_backend::device::get_gpu_vendor;
+                g_Backend.__device__get_device_name = null_backend::device::get_device_name;
+                g_Backend.__device__feature_support = null_backend::device::feature_support;
+                g_Backend.__device__coop_mat_tier = null_backend::device::coop_mat_tier;
+                g_Backend.__device__set_stable_power_state = null_backend::device::set_stable_power_state;
+
+                // Command Queue
+                g_Backend.__command_queue__create_command_queue = null_backend::command_queue::create_command_queue;
+                g_Backend.__command_queue__destroy_command_queue = null_backend::command_queue::destroy_command_queue;
+                g_Backend.__command_queue__execute_command_buffer = null_backend::command_queue::execute_command_buffer;
+                g_Backend.__command_queue__signal = null_backend::command_queue::signal;
+                g_Backend.__command_queue__wait = null_backend::command_queue::wait;
+                g_Backend.__command_queue__flush = null_backend::command_queue::flush;
+
+                // Command Buffer
+                g_Backend.__command_buffer__create_command_buffer = null_backend::command_buffer::create_command_buffer;
+                g_Backend.__command_buffer__destroy_command_buffer = null_backend::command_buffer::destroy_command_buffer;
+                g_Backend.__command_buffer__reset = null_backend::command_buffer::reset;
+                g_Backend.__command_buffer__close = null_backend::command_buffer::close;
+                g_Backend.__command_buffer__state_statistics = null_backend::command_buffer::state_statistics;
+                g_Backend.__command_buffer__reset_state_statistics = null_backend::command_buffer::reset_state_statistics;
+                g_Backend.__command_buffer__clear_render_texture = null_backend::command_buffer::clear_render_texture;
+                g_Backend.__command_buffer__clear_depth_texture = null_backend::command_buffer::clear_depth_texture;
+                g_Backend.__command_buffer__clear_depth_stencil_texture = null_backend::command_buffer::clear_depth_stencil_texture;
+                g_Backend.__command_buffer__clear_stencil_texture = null_backend::command_buffer::clear_stencil_texture;
+                g_Backend.__command_buffer__set_render_texture_1 = null_backend::command_buffer::set_render_texture;
+                g_Backend.__command_buffer__set_render_texture_2 = null_backend::command_buffer::set_render_texture;
+                g_Backend.__command_buffer__set_render_texture_3 = null_backend::command_buffer::set_render_texture;
+                g_Backend.__command_buffer__set_render_texture_4 = null_backend::command_buffer::set_render_texture;
+                g_Backend.__command_buffer__copy_graphics_buffer_1 = null_backend::command_buffer::copy_graphics_buffer;
+                g_Backend.__command_buffer__copy_graphics_buffer_2 = null_backend::command_buffer::copy_graphics_buffer;
+                g_Backend.__command_buffer__upload_constant_buffer_1 = null_backend::command_buffer::upload_constant_buffer;
+                g_Backend.__command_buffer__upload_constant_buffer_2 = null_backend::command_buffer::upload_constant_buffer;
+                g_Backend.__command_buffer__copy_texture_1 = null_backend::command_buffer::copy_texture;
+                g_Backend.__command_buffer__copy_texture_2 = null_backend::command_buffer::copy_texture;
+                g_Backend.__command_buffer__copy_render_texture = null_backend::command_buffer::copy_render_texture;
+                g_Backend.__command_buffer__copy_buffer_into_texture = null_backend::command_buffer::copy_buffer_into_texture;
+                g_Backend.__command_buffer__copy_buffer_into_texture_mip = null_backend::command_buffer::copy_buffer_into_texture_mip;
+                g_Backend.__command_buffer__copy_buffer_into_texture_mips = null_backend::command_buffer::copy_buffer_into_texture_mips;
+                g_Backend.__command_buffer__copy_buffer_into_render_texture = null_backend::command_buffer::copy_buffer_into_render_texture;
+                g_Backend.__command_buffer__copy_texture_into_buffer = null_backend::command_buffer::copy_texture_into_buffer;
+                g_Backend.__command_buffer__copy_render_texture_into_buffer = null_backend::command_buffer::copy_render_texture_into_buffer;
+                g_Backend.__command_buffer__uav_barrier_buffer = null_backend::command_buffer::uav_barrier_buffer;
+                g_Backend.__command_buffer__uav_barrier_texture = null_backend::command_buffer::uav_barrier_texture;
+                g_Backend.__command_buffer__uav_barrier_render_texture = null_backend::command_buffer::uav_barrier_render_texture;
+                g_Backend.__command_buffer__transition_to_common = null_backend::command_buffer::transition_to_common;
+                g_Backend.__command_buffer__transition_to_copy_source = null_backend::command_buffer::transition_to_copy_source;
+                g_Backend.__command_buffer__transition_to_present = null_backend::command_buffer::transition_to_present;
+                g_Backend.__command_buffer__set_compute_shader_cbuffer = null_backend::command_buffer::set_compute_shader_cbuffer;
+                g_Backend.__command_buffer__set_compute_shader_buffer = null_backend::command_buffer::set_compute_shader_buffer;
+                g_Backend.__command_buffer__set_compute_shader_texture = null_backend::command_buffer::set_compute_shader_texture;
+                g_Backend.__command_buffer__set_compute_shader_render_texture = null_backend::command_buffer::set_compute_shader_render_texture;
+                g_Backend.__command_buffer__set_compute_shader_sampler = null_backend::command_buffer::set_compute_shader_sampler;
+                g_Backend.__command_buffer__set_compute_shader_rtas = null_backend::command_buffer::set_compute_shader_rtas;
+                g_Backend.__command_buffer__dispatch = null_backend::command_buffer::dispatch;
+                g_Backend.__command_buffer__dispatch_indirect = null_backend::command_buffer::dispatch_indirect;
+                g_Backend.__command_buffer__set_viewport = null_backend::command_buffer::set_viewport;
+                g_Backend.__command_buffer__set_graphics_pipeline_cbuffer = null_backend::command_buffer::set_graphics_pipeline_cbuffer;
+                g_Backend.__command_buffer__set_graphics_pipeline_buffer = null_backend::command_buffer::set_graphics_pipeline_buffer;
+                g_Backend.__command_buffer__set_graphics_pipeline_texture = null_backend::command_buffer::set_graphics_pipeline_texture;
+                g_Backend.__command_buffer__set_graphics_pipeline_render_texture = null_backend::command_buffer::set_graphics_pipeline_render_texture;
+                g_Backend.__command_buffer__set_graphics_pipeline_sampler = null_backend::command_buffer::set_graphics_pipeline_sampler;
+                g_Backend.__command_buffer__set_graphics_pipeline_rtas = null_backend::command_buffer::set_graphics_pipeline_rtas;
+                g_Backend.__command_buffer__draw_indexed = null_backend::command_buffer::draw_indexed;
+                g_Backend.__command_buffer__draw_procedural = null_backend::command_buffer::draw_procedural;
+                g_Backend.__command_buffer__draw_procedural_indirect = null_backend::command_buffer::draw_procedural_indirect;
+                g_Backend.__command_buffer__build_blas = null_backend::command_buffer::build_blas;
+                g_Backend.__command_buffer__build_tlas = null_backend::command_buffer::build_tlas;
+                g_Backend.__command_buffer__start_section = null_backend::command_buffer::start_section;
+                g_Backend.__command_buffer__end_section = null_backend::command_buffer::end_section;
+                g_Backend.__command_buffer__enable_profiling_scope = null_backend::command_buffer::enable_profiling_scope;
+                g_Backend.__command_buffer__disable_profiling_scope = null_backend::command_buffer::disable_profiling_scope;
+                g_Backend.__command_buffer__convert_mat_32_to_16 = null_backend::command_buffer::convert_mat_32_to_16;
+
+                // Window
+                g_Backend.__window__create_window = null_backend::window::create_window;
+                g_Backend.__window__destroy_window = null_backend::window::destroy_window;
+                g_Backend.__window__viewport_size = null_backend::window::viewport_size;
+                g_Backend.__window__viewport_center = null_backend::window::viewport_center;
+                g_Backend.__window__viewport_bounds = null_backend::window::viewport_bounds;
+                g_Backend.__window__window_size = null_backend::window::window_size;
+                g_Backend.__window__window_center = null_backend::window::window_center;
+                g_Backend.__window__window_bounds = null_backend::window::window_bounds;
+                g_Backend.__window__handle_messages = null_backend::window::handle_messages;
+                g_Backend.__window__show = null_backend::window::show;
+                g_Backend.__window__hide = null_backend::window::hide;
+                g_Backend.__window__set_cursor_visibility = null_backend::window::set_cursor_visibility;
+                g_Backend.__window__set_cursor_pos = null_backend::window::set_cursor_pos;
+
+                // Swap Chain
+                g_Backend.__swap_chain__create_swap_chain = null_backend::swap_chain::create_swap_chain;
+                g_Backend.__swap_chain__destroy_swap_chain = null_backend::swap_chain::destroy_swap_chain;
+                g_Backend.__swap_chain__get_current_render_texture = null_backend::swap_chain::get_current_render_texture;
+                g_Backend.__swap_chain__present = null_backend::swap_chain::present;
+
+                // Graphics Resources
+                g_Backend.__graphics_resources__create_sampler = null_backend::resources::create_sampler;
+                g_Backend.__graphics_resources__destroy_sampler = null_backend::resources::destroy_sampler;
+                g_Backend.__graphics_resources__create_texture_1 = null_backend::resources::create_texture;
+                g_Backend.__graphics_resources__create_texture_2 = null_backend::resources::create_texture;
+                g_Backend.__graphics_resources__destroy_texture = null_backend::resources::destroy_texture;
+                g_Backend.__graphics_resources__texture_dimensions = null_backend::resources::texture_dimensions;
+                g_Backend.__graphics_resources__create_render_texture_1 = null_backend::resources::create_render_texture;
+                g_Backend.__graphics_resources__create_render_texture_2 = null_backend::resources::create_render_texture;
+                g_Backend.__graphics_resources__destroy_render_texture = null_backend::resources::destroy_render_texture;
+                g_Backend.__graphics_resources__render_texture_dimensions = null_backend::resources::render_texture_dimensions;
+                g_Backend.__graphics_resources__create_graphics_buffer = null_backend::resources::create_graphics_buffer;
+                g_Backend.__graphics_resources__destroy_graphics_buffer = null_backend::resources::destroy_graphics_buffer;
+                g_Backend.__graphics_resources__set_buffer_data = null_backend::resources::set_buffer_data;
+                g_Backend.__graphics_resources__allocate_cpu_buffer = null_backend::resources::allocate_cpu_buffer;
+                g_Backend.__graphics_resources__release_cpu_buffer = null_backend::resources::release_cpu_buffer;
+                g_Backend.__graphics_resources__set_buffer_debug_name = null_backend::resources::set_buffer_debug_name;
+                g_Backend.__graphics_resources__create_constant_buffer = null_backend::resources::create_constant_buffer;
+                g_Backend.__graphics_resources__destroy_constant_buffer = null_backend::resources::destroy_constant_buffer;
+                g_Backend.__graphics_resources__set_constant_buffer = null_backend::resources::set_constant_buffer;
+                g_Backend.__graphics_resources__create_blas = null_backend::resources::create_blas;
+                g_Backend.__graphics_resources__destroy_blas = null_backend::resources::destroy_blas;
+                g_Backend.__graphics_resources__create_tlas = null_backend::resources::create_tlas;
+                g_Backend.__graphics_resources__destroy_tlas = null_backend::resources::destroy_tlas;
+                g_Backend.__graphics_resources__set_tlas_instance = null_backend::resources::set_tlas_instance;
+                g_Backend.__graphics_resources__upload_tlas_instance_data = null_backend::resources::upload_tlas_instance_data;
+
+                // Compute shader
+                g_Backend.__compute_shader__create_compute_shader = null_backend::compute_shader::create_compute_shader;
+                g_Backend.__compute_shader__destroy_compute_shader = null_backend::compute_shader::destroy_compute_shader;
+
+                // Graphics Pipeline
+                g_Backend.__graphics_pipeline__create_graphics_pipeline = null_backend::graphics_pipeline::create_graphics_pipeline;
+                g_Backend.__graphics_pipeline__destroy_graphics_pipeline = null_backend::graphics_pipeline::destroy_graphics_pipeline;
+                g_Backend.__graphics_pipeline__set_stencil_ref = null_backend::graphics_pipeline::set_stencil_ref;
+
+                // Profiling scope
+                g_Backend.__profiling_scope__create_profiling_scope = null_backend::profiling_scope::create_profiling_scope;
+                g_Backend.__profiling_scope__destroy_profiling_scope = null_backend::profiling_scope::destroy_profiling_scope;
+                g_Backend.__profiling_scope__get_duration_us = null_backend::profiling_scope::get_duration_us;
+
+                // Fence
+                g_Backend.__fence__create_fence = null_backend::fence::create_fence;
+                g_Backend.__fence__destroy_fence = null_backend::fence::destroy_fence;
+                g_Backend.__fence__set_value = null_backend::fence::set_value;
+                g_Backend.__fence__get_value = null_backend::fence::get_value;
+                g_Backend.__fence__wait_value = null_backend::fence::wait_value;
+
+                // IMGUI
+                g_Backend.__imgui__initialize_imgui = null_backend::imgui::initialize_imgui;
+                g_Backend.__imgui__release_imgui = null_backend::imgui::release_imgui;
+                g_Backend.__imgui__start_frame = null_backend::imgui::start_frame;
+                g_Backend.__imgui__end_frame = null_backend::imgui::end_frame;
+                g_Backend.__imgui__draw_frame = null_backend::imgui::draw_frame;
+                g_Backend.__imgui__handle_input = null_backend::imgui::handle_input;
+
+                // All pointers set, valid state
+                printf("Null API set up.\n");
+                return true;
             default:
                 printf("Unknown graphics API.\n");
         }
@@ -403,6 +583,8 @@ namespace graphics
         void destroy_command_buffer(CommandBuffer command_buffer) { g_Backend.__command_buffer__destroy_command_buffer(command_buffer); }
         void reset(CommandBuffer commandBuffer) { g_Backend.__command_buffer__reset(commandBuffer); }
         void close(CommandBuffer commandBuffer) { g_Backend.__command_buffer__close(commandBuffer); }
+        const StateStats& state_statistics(CommandBuffer commandBuffer) { return g_Backend.__command_buffer__state_statistics(commandBuffer); }
+        void reset_state_statistics(CommandBuffer commandBuffer) { g_Backend.__command_buffer__reset_state_statistics(commandBuffer); }
         void clear_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture, const float4& color) { g_Backend.__command_buffer__clear_render_texture(commandBuffer, renderTexture, color); }
         void clear_depth_texture(CommandBuffer commandBuffer, RenderTexture depthTexture, float value) { g_Backend.__command_buffer__clear_depth_texture(commandBuffer, depthTexture, value); }
         void clear_depth_stencil_texture(CommandBuffer commandBuffer, RenderTexture depthTexture, float depth, uint8_t stencil) { g_Backend.__command_buffer__clear_depth_stencil_texture(commandBuffer, depthTexture, depth, stencil); }
@@ -432,22 +614,34 @@ namespace graphics
         void transition_to_copy_source(CommandBuffer commandBuffer, GraphicsBuffer targetBuffer) { g_Backend.__command_buffer__transition_to_copy_source(commandBuffer, targetBuffer); }
         void transition_to_present(CommandBuffer commandBuffer, RenderTexture renderTexture) { g_Backend.__command_buffer__transition_to_present(commandBuffer, renderTexture); }
         
-        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, ConstantBuffer constantBuffer) { g_Backend.__command_buffer__set_compute_shader_cbuffer(commandBuffer, computeShader, name, constantBuffer); }
-        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, GraphicsBuffer graphicsBuffer) { g_Backend.__command_buffer__set_compute_shader_buffer(commandBuffer, computeShader, name, graphicsBuffer); }
-        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Texture texture, uint32_t mipLevel) { g_Backend.__command_buffer__set_compute_shader_texture(commandBuffer, computeShader, name, texture, mipLevel); }
-        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, RenderTexture texture) { g_Backend.__command_buffer__set_compute_shader_render_texture(commandBuffer, computeShader, name, texture); }
-        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Sampler sampler) { g_Backend.__command_buffer__set_compute_shader_sampler(commandBuffer, computeShader, name, sampler); }
-        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, TopLevelAS rtas) { g_Backend.__command_buffer__set_compute_shader_rtas(commandBuffer, computeShader, name, rtas); }
+        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, ConstantBuffer constantBuffer) { g_Backend.__command_buffer__set_compute_shader_cbuffer(commandBuffer, computeShader, BindingSlot{ binding_hash(name) }, constantBuffer); }
+        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, ConstantBuffer constantBuffer) { g_Backend.__command_buffer__set_compute_shader_cbuffer(commandBuffer, computeShader, slot, constantBuffer); }
+        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, GraphicsBuffer graphicsBuffer) { g_Backend.__command_buffer__set_compute_shader_buffer(commandBuffer, computeShader, BindingSlot{ binding_hash(name) }, graphicsBuffer); }
+        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, GraphicsBuffer graphicsBuffer) { g_Backend.__command_buffer__set_compute_shader_buffer(commandBuffer, computeShader, slot, graphicsBuffer); }
+        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Texture texture, uint32_t mipLevel) { g_Backend.__command_buffer__set_compute_shader_texture(commandBuffer, computeShader, BindingSlot{ binding_hash(name) }, texture, mipLevel); }
+        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Texture texture, uint32_t mipLevel) { g_Backend.__command_buffer__set_compute_shader_texture(commandBuffer, computeShader, slot, texture, mipLevel); }
+        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, RenderTexture texture) { g_Backend.__command_buffer__set_compute_shader_render_texture(commandBuffer, computeShader, BindingSlot{ binding_hash(name) }, texture); }
+        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, RenderTexture texture) { g_Backend.__command_buffer__set_compute_shader_render_texture(commandBuffer, computeShader, slot, texture); }
+        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, Sampler sampler) { g_Backend.__command_buffer__set_compute_shader_sampler(commandBuffer, computeShader, BindingSlot{ binding_hash(name) }, sampler); }
+        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Sampler sampler) { g_Backend.__command_buffer__set_compute_shader_sampler(commandBuffer, computeShader, slot, sampler); }
+        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, const char* name, TopLevelAS rtas) { g_Backend.__command_buffer__set_compute_shader_rtas(commandBuffer, computeShader, BindingSlot{ binding_hash(name) }, rtas); }
+        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, TopLevelAS rtas) { g_Backend.__command_buffer__set_compute_shader_rtas(commandBuffer, computeShader, slot, rtas); }
         void dispatch(CommandBuffer commandBuffer, ComputeShader computeShader, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ) { g_Backend.__command_buffer__dispatch(commandBuffer, computeShader, sizeX, sizeY, sizeZ); }
         void dispatch_indirect(CommandBuffer commandBuffer, ComputeShader computeShader, GraphicsBuffer indirectBuffer, uint32_t offset) { g_Backend.__command_buffer__dispatch_indirect(commandBuffer, computeShader, indirectBuffer, offset); }
         
         void set_viewport(CommandBuffer commandBuffer, int32_t offsetX, int32_t offsetY, uint32_t width, uint32_t height) { g_Backend.__command_buffer__set_viewport(commandBuffer, offsetX, offsetY, width, height); }
-        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, ConstantBuffer constantBuffer) { g_Backend.__command_buffer__set_graphics_pipeline_cbuffer(commandBuffer, graphicsPipeline, name, constantBuffer); }
-        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset) { g_Backend.__command_buffer__set_graphics_pipeline_buffer(commandBuffer, graphicsPipeline, name, graphicsBuffer, bufferOffset); }
-        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Texture texture) { g_Backend.__command_buffer__set_graphics_pipeline_texture(commandBuffer, graphicsPipeline, name, texture); }
-        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, RenderTexture renderTexture) { g_Backend.__command_buffer__set_graphics_pipeline_render_texture(commandBuffer, graphicsPipeline, name, renderTexture); }
-        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Sampler sampler) { g_Backend.__command_buffer__set_graphics_pipeline_sampler(commandBuffer, graphicsPipeline, name, sampler); }
-        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, TopLevelAS rtas) { g_Backend.__command_buffer__set_graphics_pipeline_rtas(commandBuffer, graphicsPipeline, name, rtas); }
+        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, ConstantBuffer constantBuffer) { g_Backend.__command_buffer__set_graphics_pipeline_cbuffer(commandBuffer, graphicsPipeline, BindingSlot{ binding_hash(name) }, constantBuffer); }
+        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, ConstantBuffer constantBuffer) { g_Backend.__command_buffer__set_graphics_pipeline_cbuffer(commandBuffer, graphicsPipeline, slot, constantBuffer); }
+        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset) { g_Backend.__command_buffer__set_graphics_pipeline_buffer(commandBuffer, graphicsPipeline, BindingSlot{ binding_hash(name) }, graphicsBuffer, bufferOffset); }
+        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset) { g_Backend.__command_buffer__set_graphics_pipeline_buffer(commandBuffer, graphicsPipeline, slot, graphicsBuffer, bufferOffset); }
+        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Texture texture) { g_Backend.__command_buffer__set_graphics_pipeline_texture(commandBuffer, graphicsPipeline, BindingSlot{ binding_hash(name) }, texture); }
+        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Texture texture) { g_Backend.__command_buffer__set_graphics_pipeline_texture(commandBuffer, graphicsPipeline, slot, texture); }
+        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, RenderTexture renderTexture) { g_Backend.__command_buffer__set_graphics_pipeline_render_texture(commandBuffer, graphicsPipeline, BindingSlot{ binding_hash(name) }, renderTexture); }
+        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, RenderTexture renderTexture) { g_Backend.__command_buffer__set_graphics_pipeline_render_texture(commandBuffer, graphicsPipeline, slot, renderTexture); }
+        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, Sampler sampler) { g_Backend.__command_buffer__set_graphics_pipeline_sampler(commandBuffer, graphicsPipeline, BindingSlot{ binding_hash(name) }, sampler); }
+        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Sampler sampler) { g_Backend.__command_buffer__set_graphics_pipeline_sampler(commandBuffer, graphicsPipeline, slot, sampler); }
+        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, const char* name, TopLevelAS rtas) { g_Backend.__command_buffer__set_graphics_pipeline_rtas(commandBuffer, graphicsPipeline, BindingSlot{ binding_hash(name) }, rtas); }
+        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, TopLevelAS rtas) { g_Backend.__command_buffer__set_graphics_pipeline_rtas(commandBuffer, graphicsPipeline, slot, rtas); }
         void draw_indexed(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive) { g_Backend.__command_buffer__draw_indexed(commandBuffer, graphicsPipeline, vertexBuffer, indexBuffer, numTriangles, numInstances, primitive); }
         void draw_procedural(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive) { g_Backend.__command_buffer__draw_procedural(commandBuffer, graphicsPipeline, numTriangles, numInstances, primitive); }
         void draw_procedural_indirect(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer indirectBuffer, uint64_t buffeOffset) { g_Backend.__command_buffer__draw_procedural_indirect(commandBuffer, graphicsPipeline, indirectBuffer, buffeOffset); }
@@ -544,6 +738,15 @@ namespace graphics
         uint64_t get_duration_us(ProfilingScope profilingScope, CommandQueue cmdQ, CommandBufferType type) { return g_Backend.__profiling_scope__get_duration_us(profilingScope, cmdQ, type); };
     }
 
+    namespace fence
+    {
+        Fence create_fence(GraphicsDevice graphicsDevice, uint64_t initialValue) { return g_Backend.__fence__create_fence(graphicsDevice, initialValue); }
+        void destroy_fence(Fence fence) { g_Backend.__fence__destroy_fence(fence); }
+        void set_value(Fence fence, uint64_t value) { g_Backend.__fence__set_value(fence, value); }
+        uint64_t get_value(Fence fence) { return g_Backend.__fence__get_value(fence); }
+        void wait_value(Fence fence, uint64_t value) { g_Backend.__fence__wait_value(fence, value); }
+    }
+
     namespace imgui
     {
         bool initialize_imgui(GraphicsDevice device, RenderWindow window, TextureFormat format) { return g_Backend.__imgui__initialize_imgui(device, window, format); }
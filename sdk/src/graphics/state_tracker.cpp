@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "graphics/state_tracker.h"
+#include "tools/security.h"
+
+// System includes
+#include <string.h>
+
+namespace state_tracker
+{
+    void begin_recording(CommandStateTracker& tracker, uint64_t recordingID)
+    {
+        tracker.recordingID = recordingID;
+        invalidate(tracker);
+    }
+
+    void invalidate(CommandStateTracker& tracker)
+    {
+        tracker.heapsSet = false;
+        tracker.pipelineState = 0;
+        memset(tracker.rootSignatures, 0, sizeof(tracker.rootSignatures));
+        memset(tracker.rootTables, 0, sizeof(tracker.rootTables));
+    }
+
+    bool set_pipeline_state(CommandStateTracker& tracker, uint64_t pipelineState)
+    {
+        if (tracker.pipelineState == pipelineState)
+        {
+            tracker.stats.skippedPipelineStates++;
+            return false;
+        }
+        tracker.pipelineState = pipelineState;
+        return true;
+    }
+
+    bool set_root_signature(CommandStateTracker& tracker, StateBindPoint bindPoint, uint64_t rootSignature)
+    {
+        if (tracker.rootSignatures[(uint32_t)bindPoint] == rootSignature)
+        {
+            tracker.stats.skippedRootSignatures++;
+            return false;
+        }
+        tracker.rootSignatures[(uint32_t)bindPoint] = rootSignature;
+        memset(tracker.rootTables[(uint32_t)bindPoint], 0, sizeof(tracker.rootTables[(uint32_t)bindPoint]));
+        return true;
+    }
+
+    bool set_descriptor_heaps(CommandStateTracker& tracker)
+    {
+        if (tracker.heapsSet)
+        {
+            tracker.stats.skippedDescriptorHeaps++;
+            return false;
+        }
+        tracker.heapsSet = true;
+
+        // The tables set with the previous heaps are no longer valid
+        memset(tracker.rootTables, 0, sizeof(tracker.rootTables));
+        return true;
+    }
+
+    bool copy_descriptor_tables(CommandStateTracker& tracker, uint64_t& tablesRecordingID, bool dirty)
+    {
+        // The ranges of an earlier recording may have been recycled by the ring
+        if (tablesRecordingID == tracker.recordingID && !dirty)
+        {
+            tracker.stats.skippedTableCopies++;
+            return false;
+        }
+        tablesRecordingID = tracker.recordingID;
+        return true;
+    }
+
+    bool set_root_table(CommandStateTracker& tracker, StateBindPoint bindPoint, uint32_t rootIndex, uint64_t table)
+    {
+        assert_msg(rootIndex < STATE_TRACKER_MAX_TABLES, "Invalid root table index.");
+        uint64_t& boundTable = tracker.rootTables[(uint32_t)bindPoint][rootIndex];
+        if (boundTable == table)
+        {
+            tracker.stats.skippedRootTables++;
+            return false;
+        }
+        boundTable = table;
+        return true;
+    }
+}
@@ -10,6 +10,7 @@
 
 // System includes
 #include <algorithm>
+#include <string.h>
 
 template <typename IT, typename OT>
 OT sign(IT value) {
@@ -47,6 +48,85 @@ OT sign(IT value) {
     }
 #pragma endregion
 
+#pragma region half
+    float16_t to_half(float v)
+    {
+        // Grab the raw bits
+        uint32_t bits;
+        memcpy(&bits, &v, sizeof(float));
+        uint32_t sign = (bits >> 16) & 0x8000;
+        uint32_t absBits = bits & 0x7fffffff;
+
+        // NaN and infinity
+        if (absBits >= 0x7f800000)
+            return (float16_t)(sign | 0x7c00 | (absBits > 0x7f800000 ? 0x200 : 0));
+
+        // Overflow to infinity
+        if (absBits >= 0x477ff000)
+            return (float16_t)(sign | 0x7c00);
+
+        // Denormals (and zero), rounded to nearest even
+        if (absBits < 0x38800000)
+        {
+            uint32_t shift = 126 - (absBits >> 23);
+            if (shift > 24)
+                return (float16_t)sign;
+            uint32_t mantissa = (absBits & 0x7fffff) | 0x800000;
+            uint32_t halfBits = mantissa >> shift;
+            uint32_t remainder = mantissa & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+            if (remainder > halfway || (remainder == halfway && (halfBits & 1)))
+                halfBits++;
+            return (float16_t)(sign | halfBits);
+        }
+
+        // Normals, rounded to nearest even
+        uint32_t halfBits = ((absBits - 0x38000000) >> 13);
+        uint32_t remainder = absBits & 0x1fff;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (halfBits & 1)))
+            halfBits++;
+        return (float16_t)(sign | halfBits);
+    }
+
+    float to_float(float16_t v)
+    {
+        uint32_t sign = (uint32_t)(v & 0x8000) << 16;
+        uint32_t exponent = (v >> 10) & 0x1f;
+        uint32_t mantissa = v & 0x3ff;
+        uint32_t bits;
+        if (exponent == 0x1f)
+        {
+            // NaN and infinity
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        }
+        else if (exponent != 0)
+        {
+            // Normals
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+        else if (mantissa != 0)
+        {
+            // Denormals, renormalize
+            exponent = 113;
+            while ((mantissa & 0x400) == 0)
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+        }
+        else
+        {
+            // Zero
+            bits = sign;
+        }
+
+        float result;
+        memcpy(&result, &bits, sizeof(float));
+        return result;
+    }
+#pragma endregion
+
 #pragma region float2
     float2 lerp(const float2& v0, const float2& v1, float f)
     {
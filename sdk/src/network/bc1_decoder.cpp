@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/bc1_decoder.h"
+#include "network/latent_space.h"
+#include "tools/cpu_features.h"
+
+// System includes
+#if defined(CPU_X64)
+#include <immintrin.h>
+#endif
+
+namespace bc1_decoder
+{
+    BC1DecodeLevel best_decode_level()
+    {
+        const CPUFeatures& features = cpu_features();
+        if (features.avx2)
+            return BC1DecodeLevel::AVX2;
+        if (features.sse42)
+            return BC1DecodeLevel::SSE42;
+        return BC1DecodeLevel::Scalar;
+    }
+
+    void decode_blocks_scalar(const uint8_t* blocks, uint64_t blockCount, float* output)
+    {
+        for (uint64_t blockIdx = 0; blockIdx < blockCount; ++blockIdx)
+        {
+            const uint8_t* block = blocks + 8 * blockIdx;
+            float* decoded = output + BC1_DECODED_BLOCK_SIZE * blockIdx;
+            for (uint32_t t = 0; t < 16; ++t)
+            {
+                float3 texel = latent_space::decode_bc1_texel(block, t & 0x3, t >> 2);
+                decoded[t] = texel.x;
+                decoded[16 + t] = texel.y;
+                decoded[32 + t] = texel.z;
+            }
+        }
+    }
+
+#if defined(CPU_X64)
+    // Byte shuffles that expand a row of 4 indices (one byte of the block) to the matching palette floats
+    struct ShuffleTable
+    {
+        alignas(16) uint8_t masks[256][16];
+    };
+
+    constexpr ShuffleTable build_shuffle_table()
+    {
+        ShuffleTable table = {};
+        for (uint32_t row = 0; row < 256; ++row)
+        {
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                const uint32_t index = (row >> (2 * x)) & 0x3;
+                for (uint32_t b = 0; b < 4; ++b)
+                    table.masks[row][4 * x + b] = (uint8_t)(4 * index + b);
+            }
+        }
+        return table;
+    }
+
+    static constexpr ShuffleTable shuffleTable = build_shuffle_table();
+
+    // Palette of the block transposed to one register per channel (R, G, B and padding), same operations as decode_bc1_texel
+    TARGET_SSE42 inline void build_palette(const uint8_t* block, __m128& paletteR, __m128& paletteG, __m128& paletteB)
+    {
+        const int32_t c0 = block[0] | (block[1] << 8);
+        const int32_t c1 = block[2] | (block[3] << 8);
+        const __m128i channelMask = _mm_set_epi32(0, 0x1f, 0x3f, 0x1f);
+        const __m128 channelScale = _mm_set_ps(1.0f, 31.0f, 63.0f, 31.0f);
+        __m128 e0 = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_set_epi32(0, c0, c0 >> 5, c0 >> 11), channelMask)), channelScale);
+        __m128 e1 = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_set_epi32(0, c1, c1 >> 5, c1 >> 11), channelMask)), channelScale);
+
+        // Four color mode if c0 > c1, three colors and black otherwise
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 three = _mm_set1_ps(3.0f);
+        const __m128 fourColors = _mm_castsi128_ps(_mm_set1_epi32(c0 > c1 ? -1 : 0));
+        __m128 e2 = _mm_blendv_ps(_mm_mul_ps(_mm_add_ps(e0, e1), _mm_set1_ps(0.5f)), _mm_div_ps(_mm_add_ps(_mm_mul_ps(e0, two), e1), three), fourColors);
+        __m128 e3 = _mm_and_ps(_mm_div_ps(_mm_add_ps(e0, _mm_mul_ps(e1, two)), three), fourColors);
+
+        _MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+        paletteR = e0;
+        paletteG = e1;
+        paletteB = e2;
+    }
+
+    TARGET_SSE42 void decode_blocks_sse42(const uint8_t* blocks, uint64_t blockCount, float* output)
+    {
+        for (uint64_t blockIdx = 0; blockIdx < blockCount; ++blockIdx)
+        {
+            const uint8_t* block = blocks + 8 * blockIdx;
+            float* decoded = output + BC1_DECODED_BLOCK_SIZE * blockIdx;
+            __m128 palette[3];
+            build_palette(block, palette[0], palette[1], palette[2]);
+
+            // One row of 4 texels per shuffle
+            for (uint32_t y = 0; y < 4; ++y)
+            {
+                const __m128i mask = _mm_load_si128((const __m128i*)shuffleTable.masks[block[4 + y]]);
+                for (uint32_t c = 0; c < 3; ++c)
+                    _mm_storeu_ps(decoded + 16 * c + 4 * y, _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(palette[c]), mask)));
+            }
+        }
+    }
+
+    // Division by a small constant: reciprocal and one FMA correction step.
+    // Exhaustively checked to match the division for the endpoints (x / 31 and x / 63) and the interpolated entries (x / 3).
+    TARGET_AVX2 inline __m256 divide_avx2(__m256 numerator, __m256 divisor, __m256 reciprocal)
+    {
+        const __m256 quotient = _mm256_mul_ps(numerator, reciprocal);
+        const __m256 residual = _mm256_fnmadd_ps(quotient, divisor, numerator);
+        return _mm256_fmadd_ps(residual, reciprocal, quotient);
+    }
+
+    // Same as build_palette without the divisions, both endpoints (and both interpolated entries) share a register
+    TARGET_AVX2 inline void build_palette_avx2(const uint8_t* block, __m128& paletteR, __m128& paletteG, __m128& paletteB)
+    {
+        // Both endpoints are extracted from the first 32 bits of the block (c0 in the low half)
+        const uint32_t endpoints = (uint32_t)block[0] | ((uint32_t)block[1] << 8) | ((uint32_t)block[2] << 16) | ((uint32_t)block[3] << 24);
+        const __m256i channelShift = _mm256_set_epi32(0, 16, 21, 27, 0, 0, 5, 11);
+        const __m256i channelMask = _mm256_set_epi32(0, 0x1f, 0x3f, 0x1f, 0, 0x1f, 0x3f, 0x1f);
+        const __m256 channelScale = _mm256_set_ps(1.0f, 31.0f, 63.0f, 31.0f, 1.0f, 31.0f, 63.0f, 31.0f);
+        const __m256 channelRcp = _mm256_set_ps(1.0f, 1.0f / 31.0f, 1.0f / 63.0f, 1.0f / 31.0f, 1.0f, 1.0f / 31.0f, 1.0f / 63.0f, 1.0f / 31.0f);
+        const __m256i channels = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32((int32_t)endpoints), channelShift), channelMask);
+        const __m256 e01 = divide_avx2(_mm256_cvtepi32_ps(channels), channelScale, channelRcp);
+        const __m256 e10 = _mm256_permute2f128_ps(e01, e01, 1);
+
+        // (2 * e0 + e1) / 3 and (e0 + 2 * e1) / 3 in four color mode, (e0 + e1) / 2 and black otherwise
+        const __m256 fourColors = divide_avx2(_mm256_add_ps(_mm256_mul_ps(e01, _mm256_set1_ps(2.0f)), e10), _mm256_set1_ps(3.0f), _mm256_set1_ps(1.0f / 3.0f));
+        const __m256 threeColors = _mm256_mul_ps(_mm256_add_ps(e01, e10), _mm256_set_ps(0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.5f, 0.5f, 0.5f));
+        const __m256 fourColorMode = _mm256_castsi256_ps(_mm256_set1_epi32((endpoints & 0xffff) > (endpoints >> 16) ? -1 : 0));
+        const __m256 e23 = _mm256_blendv_ps(threeColors, fourColors, fourColorMode);
+
+        __m128 e0 = _mm256_castps256_ps128(e01);
+        __m128 e1 = _mm256_extractf128_ps(e01, 1);
+        __m128 e2 = _mm256_castps256_ps128(e23);
+        __m128 e3 = _mm256_extractf128_ps(e23, 1);
+        _MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+        paletteR = e0;
+        paletteG = e1;
+        paletteB = e2;
+    }
+
+    TARGET_AVX2 void decode_blocks_avx2(const uint8_t* blocks, uint64_t blockCount, float* output)
+    {
+        for (uint64_t blockIdx = 0; blockIdx < blockCount; ++blockIdx)
+        {
+            const uint8_t* block = blocks + 8 * blockIdx;
+            float* decoded = output + BC1_DECODED_BLOCK_SIZE * blockIdx;
+            __m128 palette[3];
+            build_palette_avx2(block, palette[0], palette[1], palette[2]);
+
+            // Two rows per shuffle (the shuffle works on each 128 bit lane)
+            const __m256i mask01 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_load_si128((const __m128i*)shuffleTable.masks[block[4]])), _mm_load_si128((const __m128i*)shuffleTable.masks[block[5]]), 1);
+            const __m256i mask23 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_load_si128((const __m128i*)shuffleTable.masks[block[6]])), _mm_load_si128((const __m128i*)shuffleTable.masks[block[7]]), 1);
+            UNROLL_LOOP
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                const __m256i paletteC = _mm256_broadcastsi128_si256(_mm_castps_si128(palette[c]));
+                _mm256_storeu_ps(decoded + 16 * c, _mm256_castsi256_ps(_mm256_shuffle_epi8(paletteC, mask01)));
+                _mm256_storeu_ps(decoded + 16 * c + 8, _mm256_castsi256_ps(_mm256_shuffle_epi8(paletteC, mask23)));
+            }
+        }
+    }
+#endif
+
+    void decode_blocks(const uint8_t* blocks, uint64_t blockCount, float* output, BC1DecodeLevel level)
+    {
+#if defined(CPU_X64)
+        if (level == BC1DecodeLevel::AVX2)
+            return decode_blocks_avx2(blocks, blockCount, output);
+        if (level == BC1DecodeLevel::SSE42)
+            return decode_blocks_sse42(blocks, blockCount, output);
+#endif
+        decode_blocks_scalar(blocks, blockCount, output);
+    }
+}
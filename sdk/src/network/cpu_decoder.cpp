@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/cpu_decoder.h"
+#include "network/mlp_int8.h"
+#include "network/mlp_simd.h"
+#include "network/tsnc_container.h"
+#include "math/operators.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <string.h>
+#include <thread>
+
+namespace cpu_decoder
+{
+    void load_network(const std::string& modelDir, uint32_t numSets, std::vector<CPUMLP>& mlpArray, std::vector<CPULatentTexture>& latentArray)
+    {
+        // Single file container, the set count is stored in it
+        if (tsnc_container::is_container(modelDir))
+        {
+            ContainerHeader header;
+            assert_msg(tsnc_container::load(modelDir.c_str(), mlpArray, latentArray, header), "Invalid container\n");
+            for (CPUMLP& mlp : mlpArray)
+            {
+                mlp::align_dimensions(mlp);
+                mlp::repack(mlp);
+            }
+            return;
+        }
+
+        mlpArray.resize(numSets);
+        latentArray.resize(4 * numSets);
+
+        // Forward slashes are accepted on every platform
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            // Read the MLP in place and adjust
+            mlp::load_file((modelDir + "/mlp_" + std::to_string(setIdx) + ".bin").c_str(), mlpArray[setIdx]);
+            mlp::align_dimensions(mlpArray[setIdx]);
+            mlp::repack(mlpArray[setIdx]);
+
+            // Load the latent textures
+            for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+                latent_space::load_bc1((modelDir + "/tex" + std::to_string(texIdx) + "_" + std::to_string(setIdx) + ".bc1").c_str(), latentArray[4 * setIdx + texIdx]);
+        }
+    }
+
+    uint32_t scratch_size(const CPUMLP& mlp)
+    {
+        return mlp.mlp0Width + mlp.mlp1Width;
+    }
+
+    template<typename Texture>
+    void sample_latent_space_internal(const Texture* latentSet, float2 uv, float2 uvDX, float2 uvDY, float* input)
+    {
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+        {
+            const Texture& latentTex = latentSet[texIdx];
+            float3 lsD = latent_space::sample_grad(latentTex, uv + latentTex.uvOffset, uvDX, uvDY);
+            input[3 * texIdx + 0] = lsD.x;
+            input[3 * texIdx + 1] = lsD.y;
+            input[3 * texIdx + 2] = lsD.z;
+        }
+    }
+
+    void sample_latent_space(const CPULatentTexture* latentSet, float2 uv, float2 uvDX, float2 uvDY, float* input)
+    {
+        sample_latent_space_internal(latentSet, uv, uvDX, uvDY, input);
+    }
+
+    void sample_latent_space(const DecodedLatentTexture* latentSet, float2 uv, float2 uvDX, float2 uvDY, float* input)
+    {
+        sample_latent_space_internal(latentSet, uv, uvDX, uvDY, input);
+    }
+
+    void evaluate_layer(const float* input, const float* layerBuffer, uint32_t width, uint32_t height, bool relu, float* output)
+    {
+        // Do the mat mul (row by row to keep the weight reads contiguous)
+        for (uint32_t x = 0; x < width; ++x)
+            output[x] = 0.0f;
+        for (uint32_t l = 0; l < height; ++l)
+        {
+            const float inputValue = input[l];
+            const float* weightRow = layerBuffer + width * l;
+            for (uint32_t x = 0; x < width; ++x)
+                output[x] += inputValue * weightRow[x];
+        }
+
+        // Add the bias and apply the activation
+        const float* bias = layerBuffer + width * height;
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            float acc = output[x] + bias[x];
+            output[x] = relu ? std::max(acc, 0.0f) : acc;
+        }
+    }
+
+    void evaluate_mlp(const CPUMLP& mlp, const float* input, float* output, float* scratch)
+    {
+        float* pongMemoryA = scratch;
+        float* pongMemoryB = scratch + mlp.mlp0Width;
+        evaluate_layer(input, mlp.mlp0Buffer.data(), mlp.mlp0Width, mlp.mlp0Height, true, pongMemoryA);
+        evaluate_layer(pongMemoryA, mlp.mlp1Buffer.data(), mlp.mlp1Width, mlp.mlp1Height, true, pongMemoryB);
+        evaluate_layer(pongMemoryB, mlp.mlp2Buffer.data(), mlp.mlp2Width, mlp.mlp2Height, false, output);
+    }
+
+    void store_channel(float value, float& target)
+    {
+        target = value;
+    }
+
+    void store_channel(float value, float16_t& target)
+    {
+        target = to_half(value);
+    }
+
+    template<typename T>
+    void decode_texture_set_internal(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, uint32_t channelMask, const FP16Network* fp16Network, FP16MulAdd fp16Mode, uint32_t& width, uint32_t& height, uint32_t& channelCount, std::vector<T>& data, uint32_t numThreads)
+    {
+        assert_msg(setIdx < mlpArray.size() && 4 * setIdx + 3 < latentArray.size(), "Invalid texture set index\n");
+        const CPUMLP& cpuMLP = mlpArray[setIdx];
+
+        // Decode the blocks once instead of for every fetch
+        DecodedLatentTexture latentSet[4];
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+            latent_space::decode(latentArray[4 * setIdx + texIdx], latentSet[texIdx]);
+
+        // The sampled resolution is the one of the first latent texture
+        const uint32_t texWidth = latentSet[0].width;
+        const uint32_t texHeight = latentSet[0].height;
+        width = std::max(texWidth >> mipIdx, 1u);
+        height = std::max(texHeight >> mipIdx, 1u);
+        // Channels past the last layer's width don't exist
+        const uint32_t validMask = cpuMLP.mlp2Width >= 32 ? MLP_ALL_CHANNELS : (1u << cpuMLP.mlp2Width) - 1;
+        channelMask &= validMask;
+        assert_msg(channelMask != 0, "The channel mask doesn't select any channel\n");
+        const bool allChannels = channelMask == validMask;
+        assert_msg(fp16Network == nullptr || allChannels, "The fp16 emulation decodes all the channels\n");
+        // Channels past the mask's 32 bits are always decoded, like in the kernel
+        channelCount = (uint32_t)std::popcount(channelMask) + (cpuMLP.mlp2Width > 32 ? cpuMLP.mlp2Width - 32 : 0);
+        data.resize((uint64_t)width * height * channelCount);
+
+        // One texel footprint at this mip
+        const float2 uvDX = { 1.0f / width, 0.0f };
+        const float2 uvDY = { 0.0f, 1.0f / height };
+
+        // Equivalent of compute_lod with filtering enabled
+        float lodLevel = std::min(log2f(std::max(uvDX.x * texWidth, uvDY.y * texHeight)), 15.0f);
+        const float lodInput = clamp(lodLevel / log2f((float)texWidth), 0.0f, 1.0f);
+
+        // Int8 networks go through the integer kernels, which evaluate every channel of the last layer
+        const bool int8Weights = fp16Network == nullptr && cpuMLP.weightFormat == MLPWeightFormat::Int8;
+        Int8Network int8Network;
+        std::vector<uint32_t> int8Channels;
+        if (int8Weights)
+        {
+            mlp_int8::prepare(cpuMLP, int8Network);
+            for (uint32_t c = 0; c < cpuMLP.mlp2Width; ++c)
+                if (c >= 32 || (channelMask & (1u << c)) != 0)
+                    int8Channels.push_back(c);
+        }
+
+        // Rows are distributed dynamically across the threads and evaluated in batches
+        const SIMDLevel simdLevel = mlp_simd::best_simd_level();
+        const MLPKernelFunction mlpKernel = mlp_simd::select_kernel(cpuMLP);
+        const uint32_t batchSize = MLP_BATCH_SIZE_MAX;
+        std::atomic<uint32_t> nextRow(0);
+        auto decode_rows = [&]()
+        {
+            // Channel major batch memory
+            std::vector<float> input(cpuMLP.mlp0Height * batchSize, 0.0f);
+            std::vector<float> output(channelCount * batchSize);
+            std::vector<float> int8Output(int8Weights ? cpuMLP.mlp2Width * batchSize : 0);
+            std::vector<float> scratch(fp16Network != nullptr ? mlp_fp16::scratch_size(*fp16Network, batchSize)
+                : int8Weights ? mlp_int8::scratch_size(int8Network, batchSize) : mlp_simd::scratch_size(cpuMLP, batchSize));
+
+            // The LOD and the zero padding are shared by the whole texture
+            for (uint32_t t = 0; t < batchSize; ++t)
+                input[12 * batchSize + t] = lodInput;
+
+            float latentValues[12];
+            for (uint32_t y = nextRow++; y < height; y = nextRow++)
+            {
+                T* rowData = data.data() + (uint64_t)y * width * channelCount;
+                for (uint32_t x0 = 0; x0 < width; x0 += batchSize)
+                {
+                    // Sample the compressed latent space
+                    const uint32_t texelCount = std::min(batchSize, width - x0);
+                    for (uint32_t t = 0; t < texelCount; ++t)
+                    {
+                        float2 uv = { (x0 + t + 0.5f) / width, (y + 0.5f) / height };
+                        sample_latent_space(latentSet, uv, uvDX, uvDY, latentValues);
+                        for (uint32_t c = 0; c < 12; ++c)
+                            input[c * batchSize + t] = latentValues[c];
+                    }
+
+                    // Do the MLP Evaluation (the last layer is restricted to the requested channels)
+                    if (fp16Network != nullptr)
+                        mlp_fp16::evaluate_batch(*fp16Network, input.data(), output.data(), scratch.data(), batchSize, fp16Mode, simdLevel);
+                    else if (int8Weights)
+                    {
+                        mlp_int8::evaluate_batch(int8Network, input.data(), int8Output.data(), scratch.data(), batchSize, simdLevel);
+                        for (uint32_t c = 0; c < channelCount; ++c)
+                            memcpy(output.data() + c * batchSize, int8Output.data() + int8Channels[c] * batchSize, batchSize * sizeof(float));
+                    }
+                    else if (allChannels)
+                        mlpKernel(cpuMLP, input.data(), output.data(), scratch.data(), batchSize, simdLevel);
+                    else
+                        mlp_simd::evaluate_batch_channels(cpuMLP, channelMask, input.data(), output.data(), scratch.data(), batchSize, simdLevel);
+                    for (uint32_t t = 0; t < texelCount; ++t)
+                    {
+                        for (uint32_t c = 0; c < channelCount; ++c)
+                            store_channel(output[c * batchSize + t], rowData[(x0 + t) * channelCount + c]);
+                    }
+                }
+            }
+        };
+
+        // Fan out on all the cores
+        uint32_t threadCount = numThreads != 0 ? numThreads : std::max(std::thread::hardware_concurrency(), 1u);
+        threadCount = std::min(threadCount, height);
+        std::vector<std::thread> workers;
+        for (uint32_t threadIdx = 1; threadIdx < threadCount; ++threadIdx)
+            workers.emplace_back(decode_rows);
+        decode_rows();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, DecodedTextureSet& output, uint32_t numThreads)
+    {
+        decode_texture_set_internal(mlpArray, latentArray, setIdx, mipIdx, MLP_ALL_CHANNELS, nullptr, FP16MulAdd::Fused, output.width, output.height, output.channelCount, output.data, numThreads);
+    }
+
+    void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, DecodedTextureSetHalf& output, uint32_t numThreads)
+    {
+        decode_texture_set_internal(mlpArray, latentArray, setIdx, mipIdx, MLP_ALL_CHANNELS, nullptr, FP16MulAdd::Fused, output.width, output.height, output.channelCount, output.data, numThreads);
+    }
+
+    void decode_channels(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, uint32_t channelMask, DecodedTextureSet& output, uint32_t numThreads)
+    {
+        decode_texture_set_internal(mlpArray, latentArray, setIdx, mipIdx, channelMask, nullptr, FP16MulAdd::Fused, output.width, output.height, output.channelCount, output.data, numThreads);
+    }
+
+    void decode_channels(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, uint32_t channelMask, DecodedTextureSetHalf& output, uint32_t numThreads)
+    {
+        decode_texture_set_internal(mlpArray, latentArray, setIdx, mipIdx, channelMask, nullptr, FP16MulAdd::Fused, output.width, output.height, output.channelCount, output.data, numThreads);
+    }
+
+    void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, uint32_t mipIdx, FP16MulAdd mode, DecodedTextureSetHalf& output, uint32_t numThreads)
+    {
+        assert_msg(setIdx < mlpArray.size(), "Invalid texture set index\n");
+        FP16Network fp16Network;
+        mlp_fp16::prepare(mlpArray[setIdx], fp16Network);
+        decode_texture_set_internal(mlpArray, latentArray, setIdx, mipIdx, MLP_ALL_CHANNELS, &fp16Network, mode, output.width, output.height, output.channelCount, output.data, numThreads);
+    }
+}
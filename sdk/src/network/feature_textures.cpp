@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/feature_textures.h"
+#include "network/mlp_simd.h"
+#include "math/operators.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace feature_textures
+{
+    uint64_t mip_offset(const CPUFeatureTexture& texture, uint32_t mipIdx)
+    {
+        uint64_t offset = 0;
+        for (uint32_t m = 0; m < mipIdx; ++m)
+            offset += (uint64_t)std::max(texture.width >> m, 1u) * std::max(texture.height >> m, 1u) * texture.featureCount;
+        return offset;
+    }
+
+    void bake(const CPUMLP& mlp, const CPULatentTexture& latentTex, uint32_t texIdx, CPUFeatureTexture& featureTex)
+    {
+        assert_msg(texIdx < 4, "Invalid latent texture index\n");
+        assert_msg((mlp.mlp0Width % 4) == 0, "The first layer's width must be a multiple of 4\n");
+        featureTex.width = latentTex.width;
+        featureTex.height = latentTex.height;
+        featureTex.mipCount = latentTex.mipCount;
+        featureTex.featureCount = mlp.mlp0Width;
+        featureTex.uvOffset = latentTex.uvOffset;
+        featureTex.data.resize(mip_offset(featureTex, featureTex.mipCount));
+
+        // Rows of the first layer that consume this texture
+        const uint32_t featureCount = featureTex.featureCount;
+        const float* weightRow0 = mlp.mlp0Buffer.data() + (3 * texIdx + 0) * featureCount;
+        const float* weightRow1 = mlp.mlp0Buffer.data() + (3 * texIdx + 1) * featureCount;
+        const float* weightRow2 = mlp.mlp0Buffer.data() + (3 * texIdx + 2) * featureCount;
+
+        float16_t* features = featureTex.data.data();
+        for (uint32_t mipIdx = 0; mipIdx < featureTex.mipCount; ++mipIdx)
+        {
+            const int32_t mipWidth = (int32_t)std::max(featureTex.width >> mipIdx, 1u);
+            const int32_t mipHeight = (int32_t)std::max(featureTex.height >> mipIdx, 1u);
+            for (int32_t y = 0; y < mipHeight; ++y)
+            {
+                for (int32_t x = 0; x < mipWidth; ++x)
+                {
+                    float3 latent = latent_space::fetch(latentTex, mipIdx, x, y);
+                    for (uint32_t f = 0; f < featureCount; ++f)
+                        *(features++) = to_half(latent.x * weightRow0[f] + latent.y * weightRow1[f] + latent.z * weightRow2[f]);
+                }
+            }
+        }
+    }
+
+    void bake_network(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, std::vector<CPUFeatureTexture>& featureArray)
+    {
+        assert_msg(latentArray.size() == 4 * mlpArray.size(), "Every set needs 4 latent textures\n");
+        featureArray.resize(latentArray.size());
+        for (uint32_t texIdx = 0; texIdx < (uint32_t)latentArray.size(); ++texIdx)
+            bake(mlpArray[texIdx / 4], latentArray[texIdx], texIdx % 4, featureArray[texIdx]);
+    }
+
+    void accumulate_bilinear(const CPUFeatureTexture& texture, uint32_t mipIdx, float2 uv, float weight, float* output)
+    {
+        // Texel space coordinates
+        int32_t mipWidth = (int32_t)std::max(texture.width >> mipIdx, 1u);
+        int32_t mipHeight = (int32_t)std::max(texture.height >> mipIdx, 1u);
+        float tx = uv.x * mipWidth - 0.5f;
+        float ty = uv.y * mipHeight - 0.5f;
+        float fx = floorf(tx);
+        float fy = floorf(ty);
+        float wx = tx - fx;
+        float wy = ty - fy;
+
+        // Clamp addressing
+        int32_t x0 = clamp((int32_t)fx, 0, mipWidth - 1);
+        int32_t y0 = clamp((int32_t)fy, 0, mipHeight - 1);
+        int32_t x1 = clamp((int32_t)fx + 1, 0, mipWidth - 1);
+        int32_t y1 = clamp((int32_t)fy + 1, 0, mipHeight - 1);
+
+        // Blend the 4 texels
+        const uint32_t featureCount = texture.featureCount;
+        const float16_t* mipData = texture.data.data() + mip_offset(texture, mipIdx);
+        const float16_t* texel00 = mipData + ((uint64_t)y0 * mipWidth + x0) * featureCount;
+        const float16_t* texel10 = mipData + ((uint64_t)y0 * mipWidth + x1) * featureCount;
+        const float16_t* texel01 = mipData + ((uint64_t)y1 * mipWidth + x0) * featureCount;
+        const float16_t* texel11 = mipData + ((uint64_t)y1 * mipWidth + x1) * featureCount;
+        const float w00 = weight * (1.0f - wx) * (1.0f - wy);
+        const float w10 = weight * wx * (1.0f - wy);
+        const float w01 = weight * (1.0f - wx) * wy;
+        const float w11 = weight * wx * wy;
+        for (uint32_t f = 0; f < featureCount; ++f)
+            output[f] += w00 * to_float(texel00[f]) + w10 * to_float(texel10[f]) + w01 * to_float(texel01[f]) + w11 * to_float(texel11[f]);
+    }
+
+    void sample_grad(const CPUFeatureTexture& texture, float2 uv, float2 uvDX, float2 uvDY, float* output)
+    {
+        // Evaluate the LOD from the texel space derivatives (see latent_space::sample_grad)
+        float2 texSize = { (float)texture.width, (float)texture.height };
+        float2 dx = { uvDX.x * texSize.x, uvDX.y * texSize.y };
+        float2 dy = { uvDY.x * texSize.x, uvDY.y * texSize.y };
+        float lod = log2f(std::max(length(dx), length(dy)));
+        lod = clamp(lod, 0.0f, std::min(15.0f, (float)(texture.mipCount - 1)));
+
+        // Blend the two closest mips
+        uint32_t mipLo = (uint32_t)lod;
+        uint32_t mipHi = std::min(mipLo + 1, texture.mipCount - 1);
+        float mipFactor = lod - (float)mipLo;
+        if (mipFactor == 0.0f || mipHi == mipLo)
+            return accumulate_bilinear(texture, mipLo, uv, 1.0f, output);
+        accumulate_bilinear(texture, mipLo, uv, 1.0f - mipFactor, output);
+        accumulate_bilinear(texture, mipHi, uv, mipFactor, output);
+    }
+
+    void evaluate_first_layer(const CPUMLP& mlp, const CPUFeatureTexture* featureSet, float2 uv, float2 uvDX, float2 uvDY, float lodInput, float* hidden)
+    {
+        // Sum the contributions of the 4 latent textures
+        const uint32_t featureCount = mlp.mlp0Width;
+        for (uint32_t f = 0; f < featureCount; ++f)
+            hidden[f] = 0.0f;
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+        {
+            const CPUFeatureTexture& featureTex = featureSet[texIdx];
+            sample_grad(featureTex, uv + featureTex.uvOffset, uvDX, uvDY, hidden);
+        }
+
+        // The LOD is the only input left, then bias and RELU
+        const float* lodRow = mlp.mlp0Buffer.data() + 12 * featureCount;
+        const float* bias = mlp.mlp0Buffer.data() + mlp.mlp0Height * featureCount;
+        for (uint32_t f = 0; f < featureCount; ++f)
+            hidden[f] = std::max(hidden[f] + lodInput * lodRow[f] + bias[f], 0.0f);
+    }
+
+    void decode_texture_set(const std::vector<CPUMLP>& mlpArray, const std::vector<CPUFeatureTexture>& featureArray, uint32_t setIdx, uint32_t mipIdx, DecodedTextureSet& output, uint32_t numThreads)
+    {
+        assert_msg(setIdx < mlpArray.size() && 4 * setIdx + 3 < featureArray.size(), "Invalid texture set index\n");
+        const CPUMLP& cpuMLP = mlpArray[setIdx];
+        const CPUFeatureTexture* featureSet = featureArray.data() + 4 * setIdx;
+
+        // The sampled resolution is the one of the first latent texture
+        const uint32_t texWidth = featureSet[0].width;
+        const uint32_t texHeight = featureSet[0].height;
+        const uint32_t width = std::max(texWidth >> mipIdx, 1u);
+        const uint32_t height = std::max(texHeight >> mipIdx, 1u);
+        const uint32_t channelCount = cpuMLP.mlp2Width;
+        output.width = width;
+        output.height = height;
+        output.channelCount = channelCount;
+        output.data.resize((uint64_t)width * height * channelCount);
+
+        // One texel footprint at this mip
+        const float2 uvDX = { 1.0f / width, 0.0f };
+        const float2 uvDY = { 0.0f, 1.0f / height };
+
+        // Equivalent of compute_lod with filtering enabled
+        float lodLevel = std::min(log2f(std::max(uvDX.x * texWidth, uvDY.y * texHeight)), 15.0f);
+        const float lodInput = clamp(lodLevel / log2f((float)texWidth), 0.0f, 1.0f);
+
+        // Rows are distributed dynamically across the threads, only the last two layers go through the SIMD kernels
+        const SIMDLevel simdLevel = mlp_simd::best_simd_level();
+        const uint32_t batchSize = MLP_BATCH_SIZE_MAX;
+        const uint32_t hiddenCount = cpuMLP.mlp0Width;
+        std::atomic<uint32_t> nextRow(0);
+        auto decode_rows = [&]()
+        {
+            // Channel major batch memory
+            std::vector<float> hidden(hiddenCount * batchSize, 0.0f);
+            std::vector<float> result(channelCount * batchSize);
+            std::vector<float> scratch(cpuMLP.mlp1Width * batchSize);
+            std::vector<float> texelHidden(hiddenCount);
+            for (uint32_t y = nextRow++; y < height; y = nextRow++)
+            {
+                float* rowData = output.data.data() + (uint64_t)y * width * channelCount;
+                for (uint32_t x0 = 0; x0 < width; x0 += batchSize)
+                {
+                    // Sample the feature textures
+                    const uint32_t texelCount = std::min(batchSize, width - x0);
+                    for (uint32_t t = 0; t < texelCount; ++t)
+                    {
+                        float2 uv = { (x0 + t + 0.5f) / width, (y + 0.5f) / height };
+                        evaluate_first_layer(cpuMLP, featureSet, uv, uvDX, uvDY, lodInput, texelHidden.data());
+                        for (uint32_t f = 0; f < hiddenCount; ++f)
+                            hidden[f * batchSize + t] = texelHidden[f];
+                    }
+
+                    // Do the remaining layers
+                    mlp_simd::evaluate_hidden_batch(cpuMLP, hidden.data(), result.data(), scratch.data(), batchSize, simdLevel);
+                    for (uint32_t t = 0; t < texelCount; ++t)
+                    {
+                        for (uint32_t c = 0; c < channelCount; ++c)
+                            rowData[(x0 + t) * channelCount + c] = result[c * batchSize + t];
+                    }
+                }
+            }
+        };
+
+        // Fan out on all the cores
+        uint32_t threadCount = numThreads != 0 ? numThreads : std::max(std::thread::hardware_concurrency(), 1u);
+        threadCount = std::min(threadCount, height);
+        std::vector<std::thread> workers;
+        for (uint32_t threadIdx = 1; threadIdx < threadCount; ++threadIdx)
+            workers.emplace_back(decode_rows);
+        decode_rows();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    double elapsed_ms(std::chrono::high_resolution_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    void benchmark(const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, uint32_t setIdx, FeatureTextureBenchmark& result, uint32_t numThreads)
+    {
+        assert_msg(setIdx < mlpArray.size() && 4 * setIdx + 3 < latentArray.size(), "Invalid texture set index\n");
+        const CPUMLP& cpuMLP = mlpArray[setIdx];
+
+        // Bake the features of the set
+        std::vector<CPUMLP> mlpSet(1, cpuMLP);
+        std::vector<CPULatentTexture> latentSet(latentArray.begin() + 4 * setIdx, latentArray.begin() + 4 * setIdx + 4);
+        std::vector<CPUFeatureTexture> featureSet;
+        auto start = std::chrono::high_resolution_clock::now();
+        bake_network(mlpSet, latentSet, featureSet);
+        result.bakeTime = elapsed_ms(start);
+
+        // Memory footprints
+        result.latentSize = 0;
+        result.featureSize = 0;
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+        {
+            result.latentSize += latentSet[texIdx].data.size();
+            result.featureSize += featureSet[texIdx].data.size() * sizeof(float16_t);
+        }
+
+        // ALU, the first layer is reduced to the LOD input
+        const uint32_t hiddenMACs = cpuMLP.mlp1Width * cpuMLP.mlp1Height + cpuMLP.mlp2Width * cpuMLP.mlp2Height;
+        result.latentMACs = cpuMLP.mlp0Width * cpuMLP.mlp0Height + hiddenMACs;
+        result.featureMACs = cpuMLP.mlp0Width + hiddenMACs;
+
+        // Both modes take 8 trilinear taps per texture, but the features filter every hidden channel instead of the 3 latent ones
+        const uint32_t trilinearTaps = 8;
+        result.latentFilterMACs = 4 * trilinearTaps * 3;
+        result.featureFilterMACs = 4 * trilinearTaps * cpuMLP.mlp0Width;
+
+        // Decode both ways
+        DecodedTextureSet latentDecode, featureDecode;
+        start = std::chrono::high_resolution_clock::now();
+        cpu_decoder::decode_texture_set(mlpSet, latentSet, 0, 0, latentDecode, numThreads);
+        result.latentDecodeTime = elapsed_ms(start);
+        start = std::chrono::high_resolution_clock::now();
+        decode_texture_set(mlpSet, featureSet, 0, 0, featureDecode, numThreads);
+        result.featureDecodeTime = elapsed_ms(start);
+
+        // The features are stored in fp16, the rest is identical
+        result.maxError = 0.0f;
+        for (uint64_t i = 0; i < latentDecode.data.size(); ++i)
+            result.maxError = std::max(result.maxError, fabsf(latentDecode.data[i] - featureDecode.data[i]));
+    }
+}
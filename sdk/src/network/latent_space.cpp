@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/latent_space.h"
+#include "network/bc1_decoder.h"
+#include "math/operators.h"
+#include "tools/security.h"
+#include "tools/stream.h"
+
+// System includes
+#include <algorithm>
+#include <string.h>
+
+namespace latent_space
+{
+    void load_bc1(const char* texturePath, CPULatentTexture& texture)
+    {
+        // Map the file
+        std::shared_ptr<FileView> file = std::make_shared<FileView>();
+        assert_msg(file->open(texturePath), "Failed to open latent texture\n");
+
+        // Read the header (blocks x, blocks y, mip count, uv offset)
+        StreamReader reader(file->data(), file->size());
+        uint32_t blocksX = 0, blocksY = 0, mipCount = 0;
+        reader.read_bytes(blocksX);
+        reader.read_bytes(blocksY);
+        reader.read_bytes(mipCount);
+        reader.read_bytes(texture.uvOffset.x);
+        reader.read_bytes(texture.uvOffset.y);
+        assert_msg(!reader.failed(), "Invalid latent texture\n");
+        texture.width = blocksX * 4;
+        texture.height = blocksY * 4;
+        texture.mipCount = std::max(1, (int32_t)mipCount - 2);
+
+        // The blocks stay in the mapping
+        texture.data = std::span<const uint8_t>((const uint8_t*)reader.cursor(), reader.remaining());
+        texture.file = file;
+        assert_msg(mip_offset(texture, texture.mipCount) <= texture.data.size(), "Truncated latent texture\n");
+    }
+
+    uint64_t mip_size(const CPULatentTexture& texture, uint32_t mipIdx)
+    {
+        uint32_t blocksX = std::max((texture.width >> mipIdx) / 4, 1u);
+        uint32_t blocksY = std::max((texture.height >> mipIdx) / 4, 1u);
+        return blocksX * blocksY * 8ull;
+    }
+
+    uint64_t mip_offset(const CPULatentTexture& texture, uint32_t mipIdx)
+    {
+        uint64_t offset = 0;
+        for (uint32_t prevIdx = 0; prevIdx < mipIdx; ++prevIdx)
+            offset += mip_size(texture, prevIdx);
+        return offset;
+    }
+
+    float3 unpack_565(uint16_t color)
+    {
+        return { ((color >> 11) & 0x1f) / 31.0f, ((color >> 5) & 0x3f) / 63.0f, (color & 0x1f) / 31.0f };
+    }
+
+    float3 decode_bc1_texel(const uint8_t* block, uint32_t texelX, uint32_t texelY)
+    {
+        // Endpoints and indices
+        uint16_t c0 = (uint16_t)(block[0] | (block[1] << 8));
+        uint16_t c1 = (uint16_t)(block[2] | (block[3] << 8));
+        uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | ((uint32_t)block[7] << 24);
+        uint32_t index = (indices >> (2 * (4 * texelY + texelX))) & 0x3;
+
+        // Evaluate the palette entry
+        float3 e0 = unpack_565(c0);
+        float3 e1 = unpack_565(c1);
+        switch (index)
+        {
+            case 0:
+                return e0;
+            case 1:
+                return e1;
+            case 2:
+                return c0 > c1 ? (e0 * 2.0f + e1) / 3.0f : (e0 + e1) * 0.5f;
+            default:
+                return c0 > c1 ? (e0 + e1 * 2.0f) / 3.0f : float3({ 0.0f, 0.0f, 0.0f });
+        }
+    }
+
+    const uint8_t* mip_data(const CPULatentTexture& texture, uint32_t mipIdx)
+    {
+        return texture.data.data() + mip_offset(texture, mipIdx);
+    }
+
+    const float* mip_data(const DecodedLatentTexture& texture, uint32_t mipIdx)
+    {
+        // Every 8 byte block is expanded to BC1_DECODED_BLOCK_SIZE floats
+        uint64_t blockOffset = 0;
+        for (uint32_t prevIdx = 0; prevIdx < mipIdx; ++prevIdx)
+            blockOffset += std::max((texture.width >> prevIdx) / 4, 1u) * std::max((texture.height >> prevIdx) / 4, 1u);
+        return texture.data.data() + blockOffset * BC1_DECODED_BLOCK_SIZE;
+    }
+
+    float3 fetch_texel(const uint8_t* mipData, uint32_t blockIdx, uint32_t texelX, uint32_t texelY)
+    {
+        return decode_bc1_texel(mipData + blockIdx * 8, texelX, texelY);
+    }
+
+    float3 fetch_texel(const float* mipData, uint32_t blockIdx, uint32_t texelX, uint32_t texelY)
+    {
+        const float* block = mipData + blockIdx * BC1_DECODED_BLOCK_SIZE;
+        const uint32_t t = 4 * texelY + texelX;
+        return { block[t], block[16 + t], block[32 + t] };
+    }
+
+    template<typename Texture, typename Data>
+    float3 fetch_mip(const Texture& texture, const Data* mipData, uint32_t mipIdx, int32_t x, int32_t y)
+    {
+        // Clamp addressing
+        int32_t mipWidth = (int32_t)std::max(texture.width >> mipIdx, 1u);
+        int32_t mipHeight = (int32_t)std::max(texture.height >> mipIdx, 1u);
+        x = clamp(x, 0, mipWidth - 1);
+        y = clamp(y, 0, mipHeight - 1);
+
+        // Locate the block
+        uint32_t blocksX = std::max((uint32_t)mipWidth / 4, 1u);
+        return fetch_texel(mipData, (y / 4) * blocksX + (x / 4), x & 0x3, y & 0x3);
+    }
+
+    float3 fetch(const CPULatentTexture& texture, uint32_t mipIdx, int32_t x, int32_t y)
+    {
+        return fetch_mip(texture, mip_data(texture, mipIdx), mipIdx, x, y);
+    }
+
+    float3 fetch(const DecodedLatentTexture& texture, uint32_t mipIdx, int32_t x, int32_t y)
+    {
+        return fetch_mip(texture, mip_data(texture, mipIdx), mipIdx, x, y);
+    }
+
+    template<typename Texture>
+    float3 sample_bilinear(const Texture& texture, uint32_t mipIdx, float2 uv)
+    {
+        // Texel space coordinates
+        float mipWidth = (float)std::max(texture.width >> mipIdx, 1u);
+        float mipHeight = (float)std::max(texture.height >> mipIdx, 1u);
+        float tx = uv.x * mipWidth - 0.5f;
+        float ty = uv.y * mipHeight - 0.5f;
+        float fx = floorf(tx);
+        float fy = floorf(ty);
+        int32_t x0 = (int32_t)fx;
+        int32_t y0 = (int32_t)fy;
+        float wx = tx - fx;
+        float wy = ty - fy;
+
+        // Blend the 4 texels
+        const auto* mipData = mip_data(texture, mipIdx);
+        float3 top = lerp(fetch_mip(texture, mipData, mipIdx, x0, y0), fetch_mip(texture, mipData, mipIdx, x0 + 1, y0), wx);
+        float3 bottom = lerp(fetch_mip(texture, mipData, mipIdx, x0, y0 + 1), fetch_mip(texture, mipData, mipIdx, x0 + 1, y0 + 1), wx);
+        return lerp(top, bottom, wy);
+    }
+
+    template<typename Texture>
+    float3 sample_grad_internal(const Texture& texture, float2 uv, float2 uvDX, float2 uvDY)
+    {
+        // Evaluate the LOD from the texel space derivatives
+        float2 texSize = { (float)texture.width, (float)texture.height };
+        float2 dx = { uvDX.x * texSize.x, uvDX.y * texSize.y };
+        float2 dy = { uvDY.x * texSize.x, uvDY.y * texSize.y };
+        float lod = log2f(std::max(length(dx), length(dy)));
+
+        // Clamp to the sampler's range (min LOD 0, max LOD 15) and the available mips
+        lod = clamp(lod, 0.0f, std::min(15.0f, (float)(texture.mipCount - 1)));
+
+        // Blend the two closest mips
+        uint32_t mipLo = (uint32_t)lod;
+        uint32_t mipHi = std::min(mipLo + 1, texture.mipCount - 1);
+        float mipFactor = lod - (float)mipLo;
+        float3 valueLo = sample_bilinear(texture, mipLo, uv);
+        if (mipFactor == 0.0f || mipHi == mipLo)
+            return valueLo;
+        return lerp(valueLo, sample_bilinear(texture, mipHi, uv), mipFactor);
+    }
+
+    float3 sample_grad(const CPULatentTexture& texture, float2 uv, float2 uvDX, float2 uvDY)
+    {
+        return sample_grad_internal(texture, uv, uvDX, uvDY);
+    }
+
+    float3 sample_grad(const DecodedLatentTexture& texture, float2 uv, float2 uvDX, float2 uvDY)
+    {
+        return sample_grad_internal(texture, uv, uvDX, uvDY);
+    }
+
+    void decode(const CPULatentTexture& texture, DecodedLatentTexture& decoded)
+    {
+        decoded.width = texture.width;
+        decoded.height = texture.height;
+        decoded.mipCount = texture.mipCount;
+        decoded.uvOffset = texture.uvOffset;
+
+        // The mips are contiguous, decode them in one go
+        const uint64_t blockCount = mip_offset(texture, texture.mipCount) / 8;
+        decoded.data.resize(blockCount * BC1_DECODED_BLOCK_SIZE);
+        bc1_decoder::decode_blocks(texture.data.data(), blockCount, decoded.data.data(), bc1_decoder::best_decode_level());
+    }
+}
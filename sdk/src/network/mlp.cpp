@@ -8,47 +8,74 @@
 // Includes
 #include "network/mlp.h"
 #include "graphics/backend.h"
+#include "tools/file_view.h"
+#include "tools/security.h"
 #include "tools/stream.h"
-#include "tools/gpu_helpers.h"
+
+// System includes
+#include <algorithm>
+#include <math.h>
+#include <string.h>
 
 namespace mlp
 {
+    GraphicsBuffer create_weight_buffer(GraphicsDevice device, const CPUMLP& cpuMLP, uint32_t width, uint32_t height, uint64_t numMLPs)
+    {
+        // Int8 weights are read as uints by the shader
+        if (cpuMLP.weightFormat == MLPWeightFormat::Int8)
+            return graphics::resources::create_graphics_buffer(device, int8_layer_size(width, height) * numMLPs, sizeof(uint32_t), GraphicsBufferType::Default);
+        return graphics::resources::create_graphics_buffer(device, width * height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
+    }
+
+    GraphicsBuffer create_optimal_buffer(GraphicsDevice device, uint32_t width, uint32_t height, uint64_t numMLPs, bool allocate)
+    {
+        if (!allocate)
+            return 0;
+        return graphics::resources::create_graphics_buffer(device, width * height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
+    }
+
     void allocate_gpu_mlp(GraphicsDevice device, const CPUMLP& cpuMLP, GPUMLP& gpuMLP)
     {
+        // The int8 path never reads the fp16 optimal layout
+        const bool optimalWeights = cpuMLP.weightFormat != MLPWeightFormat::Int8;
+
         // Layer 0
-        gpuMLP.weight0Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp0Width * cpuMLP.mlp0Height * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
-        gpuMLP.weight0OptimalBuffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp0Width * cpuMLP.mlp0Height * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
+        gpuMLP.weight0Buffer = create_weight_buffer(device, cpuMLP, cpuMLP.mlp0Width, cpuMLP.mlp0Height, 1);
+        gpuMLP.weight0OptimalBuffer = create_optimal_buffer(device, cpuMLP.mlp0Width, cpuMLP.mlp0Height, 1, optimalWeights);
         gpuMLP.bias0Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp0Width * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
 
         // Layer 1
-        gpuMLP.weight1Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp1Width * cpuMLP.mlp1Height * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
-        gpuMLP.weight1OptimalBuffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp1Width * cpuMLP.mlp1Height * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
+        gpuMLP.weight1Buffer = create_weight_buffer(device, cpuMLP, cpuMLP.mlp1Width, cpuMLP.mlp1Height, 1);
+        gpuMLP.weight1OptimalBuffer = create_optimal_buffer(device, cpuMLP.mlp1Width, cpuMLP.mlp1Height, 1, optimalWeights);
         gpuMLP.bias1Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp1Width * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
 
         // Layer 2
-        gpuMLP.weight2Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp2Width * cpuMLP.mlp2Height * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
-        gpuMLP.weight2OptimalBuffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp2Width * cpuMLP.mlp2Height * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
+        gpuMLP.weight2Buffer = create_weight_buffer(device, cpuMLP, cpuMLP.mlp2Width, cpuMLP.mlp2Height, 1);
+        gpuMLP.weight2OptimalBuffer = create_optimal_buffer(device, cpuMLP.mlp2Width, cpuMLP.mlp2Height, 1, optimalWeights);
         gpuMLP.bias2Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp2Width * sizeof(float16_t), sizeof(float16_t), GraphicsBufferType::Default);
     }
 
-    void allocate_gpu_mlp_array(GraphicsDevice device, const std::vector<CPUMLP>& cpuMLPArray, GPUMLP& gpuMLP)
+    void allocate_gpu_mlp_array(GraphicsDevice device, const std::vector<CPUMLP>& cpuMLPArray, bool cooperativeVectors, GPUMLP& gpuMLP)
     {
         const CPUMLP& cpuMLP = cpuMLPArray[0];
         uint64_t numMLPs = cpuMLPArray.size();
 
+        // Only the cooperative vector shaders read the fp16 optimal layout of int8 networks
+        const bool optimalWeights = cpuMLP.weightFormat != MLPWeightFormat::Int8 || cooperativeVectors;
+
         // Layer 0
-        gpuMLP.weight0Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp0Width * cpuMLP.mlp0Height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
-        gpuMLP.weight0OptimalBuffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp0Width * cpuMLP.mlp0Height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
+        gpuMLP.weight0Buffer = create_weight_buffer(device, cpuMLP, cpuMLP.mlp0Width, cpuMLP.mlp0Height, numMLPs);
+        gpuMLP.weight0OptimalBuffer = create_optimal_buffer(device, cpuMLP.mlp0Width, cpuMLP.mlp0Height, numMLPs, optimalWeights);
         gpuMLP.bias0Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp0Width * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
 
         // Layer 1
-        gpuMLP.weight1Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp1Width * cpuMLP.mlp1Height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
-        gpuMLP.weight1OptimalBuffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp1Width * cpuMLP.mlp1Height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
+        gpuMLP.weight1Buffer = create_weight_buffer(device, cpuMLP, cpuMLP.mlp1Width, cpuMLP.mlp1Height, numMLPs);
+        gpuMLP.weight1OptimalBuffer = create_optimal_buffer(device, cpuMLP.mlp1Width, cpuMLP.mlp1Height, numMLPs, optimalWeights);
         gpuMLP.bias1Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp1Width * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
 
         // Layer 2
-        gpuMLP.weight2Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp2Width * cpuMLP.mlp2Height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
-        gpuMLP.weight2OptimalBuffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp2Width * cpuMLP.mlp2Height * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
+        gpuMLP.weight2Buffer = create_weight_buffer(device, cpuMLP, cpuMLP.mlp2Width, cpuMLP.mlp2Height, numMLPs);
+        gpuMLP.weight2OptimalBuffer = create_optimal_buffer(device, cpuMLP.mlp2Width, cpuMLP.mlp2Height, numMLPs, optimalWeights);
         gpuMLP.bias2Buffer = graphics::resources::create_graphics_buffer(device, cpuMLP.mlp2Width * sizeof(float16_t) * numMLPs, sizeof(float16_t), GraphicsBufferType::Default);
     }
 
@@ -68,6 +95,16 @@ namespace mlp
             // Copy the bias
             memcpy((char*)&data[mlp.mlp0Width * newHeight], (char*)&mlp.mlp0Buffer[mlp.mlp0Width * mlp.mlp0Height], sizeof(float) * mlp.mlp0Width);
 
+            // The new rows are set to the zero point of their column
+            if (mlp.weightFormat == MLPWeightFormat::Int8)
+            {
+                QuantizedLayer& layer = mlp.mlp0Int8;
+                layer.weights.resize(mlp.mlp0Width * newHeight);
+                for (uint32_t l = mlp.mlp0Height; l < newHeight; ++l)
+                    for (uint32_t x = 0; x < mlp.mlp0Width; ++x)
+                        layer.weights[mlp.mlp0Width * l + x] = (int8_t)layer.zeroPoint[x];
+            }
+
             // Assign
             mlp.mlp0Height = newHeight;
             mlp.mlp0Buffer = data;
@@ -86,6 +123,18 @@ namespace mlp
                 memcpy((char*)&data[targetWidth * y], (char*)&mlp.mlp2Buffer[mlp.mlp2Width * y], sizeof(float) * mlp.mlp2Width);
             memcpy((char*)&data[targetWidth * mlp.mlp2Height], (char*)&mlp.mlp2Buffer[mlp.mlp2Width * mlp.mlp2Height], sizeof(float) * mlp.mlp2Width);
 
+            // The new columns are zeros with a unit scale
+            if (mlp.weightFormat == MLPWeightFormat::Int8)
+            {
+                QuantizedLayer& layer = mlp.mlp2Int8;
+                std::vector<int8_t> weights(mlp.mlp2Height * targetWidth, 0);
+                for (uint32_t y = 0; y < mlp.mlp2Height; ++y)
+                    memcpy(&weights[targetWidth * y], &layer.weights[mlp.mlp2Width * y], mlp.mlp2Width);
+                layer.weights = weights;
+                layer.scale.resize(targetWidth, 1.0f);
+                layer.zeroPoint.resize(targetWidth, 0);
+            }
+
             // Update the sizes
             mlp.mlp2Width = targetWidth;
             mlp.mlp2Buffer = data;
@@ -93,54 +142,103 @@ namespace mlp
         }
     }
 
-    void upload_and_convert_matrices(GraphicsDevice device, CommandQueue queue, CommandBuffer cmdB, const char* buffer, uint32_t matrixWidth, uint32_t matrixHeight, GraphicsBuffer mainBuffer, GraphicsBuffer optimalBuffer, uint64_t offsetBuffer)
+    void quantize_layer(std::vector<float>& buffer, uint32_t width, uint32_t height, QuantizedLayer& layer)
     {
-        // Input buffer size
-        const uint32_t bufferSize = matrixWidth * matrixHeight * sizeof(float);
-
-        // Create the graphics buffer to upload, process and readback the bitfield buffer
-        GraphicsBuffer uploadBuffer = graphics::resources::create_graphics_buffer(device, bufferSize, sizeof(float), GraphicsBufferType::Upload);
-        GraphicsBuffer tmpBuffer = graphics::resources::create_graphics_buffer(device, bufferSize, sizeof(float), GraphicsBufferType::Default);
-
-        // Upload the initial bitfield
-        graphics::resources::set_buffer_data(uploadBuffer, buffer, bufferSize);
+        layer.weights.resize(width * height);
+        layer.scale.resize(width);
+        layer.zeroPoint.resize(width);
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            // Range of the output channel, zero needs to be exactly representable
+            float minValue = 0.0f, maxValue = 0.0f;
+            for (uint32_t l = 0; l < height; ++l)
+            {
+                minValue = std::min(minValue, buffer[width * l + x]);
+                maxValue = std::max(maxValue, buffer[width * l + x]);
+            }
+
+            // Asymmetric mapping of [min, max] to [-128, 127]
+            const float scale = maxValue > minValue ? (maxValue - minValue) / 255.0f : 1.0f;
+            const int32_t zeroPoint = std::clamp((int32_t)lroundf(-128.0f - minValue / scale), -128, 127);
+            layer.scale[x] = scale;
+            layer.zeroPoint[x] = zeroPoint;
+
+            // Quantize and replace by the dequantized value
+            for (uint32_t l = 0; l < height; ++l)
+            {
+                const int32_t q = std::clamp((int32_t)lroundf(buffer[width * l + x] / scale) + zeroPoint, -128, 127);
+                layer.weights[width * l + x] = (int8_t)q;
+                buffer[width * l + x] = scale * (float)(q - zeroPoint);
+            }
+        }
+    }
 
-        // Reset the command buffer
-        graphics::command_buffer::reset(cmdB);
+    void quantize_int8(CPUMLP& mlp)
+    {
+        quantize_layer(mlp.mlp0Buffer, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Int8);
+        quantize_layer(mlp.mlp1Buffer, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Int8);
+        quantize_layer(mlp.mlp2Buffer, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Int8);
+        mlp.weightFormat = MLPWeightFormat::Int8;
+
+        // Keep the CPU layout in sync with the new weights
+        if (!mlp.repacked.layers[0].data.empty())
+            repack(mlp);
+    }
 
-        graphics::command_buffer::copy_graphics_buffer(cmdB, uploadBuffer, tmpBuffer);
-        if (optimalBuffer != 0)
-            graphics::command_buffer::convert_mat_32_to_16(cmdB, tmpBuffer, 0, optimalBuffer, offsetBuffer, matrixWidth, matrixHeight, true);
-        if (mainBuffer != 0)
-            graphics::command_buffer::convert_mat_32_to_16(cmdB, tmpBuffer, 0, mainBuffer, offsetBuffer, matrixWidth, matrixHeight, false);
+    uint64_t int8_weights_padding(uint32_t width, uint32_t height)
+    {
+        // The int8 weights of a file are followed by fp32 biases, padding them to a multiple of 4 bytes keeps the biases mappable
+        return (4 - ((uint64_t)width * height) % 4) % 4;
+    }
 
-        // Close the command buffer
-        graphics::command_buffer::close(cmdB);
+    uint64_t int8_layer_size(uint32_t width, uint32_t height)
+    {
+        return (2 * (uint64_t)width + ((uint64_t)width * height + 3) / 4) * sizeof(uint32_t);
+    }
 
-        // Execute the command buffer in the command queue
-        graphics::command_queue::execute_command_buffer(queue, cmdB);
+    void pack_int8_layer(std::vector<char>& buffer, const QuantizedLayer& layer, uint32_t width, uint32_t height)
+    {
+        const size_t start = buffer.size();
+        pack_buffer(buffer, width * sizeof(float), (const char*)layer.scale.data());
+        pack_buffer(buffer, width * sizeof(int32_t), (const char*)layer.zeroPoint.data());
+        pack_buffer(buffer, (size_t)width * height, (const char*)layer.weights.data());
 
-        // Flush the queue
-        graphics::command_queue::flush(queue);
+        // Pad the weights to a full uint
+        buffer.resize(start + int8_layer_size(width, height), 0);
+    }
 
-        // Make sure to free the graphics buffer
-        graphics::resources::destroy_graphics_buffer(uploadBuffer);
-        graphics::resources::destroy_graphics_buffer(tmpBuffer);
+    void upload_int8_weights(UploadManager& uploadManager, const QuantizedLayer& layer, uint32_t width, uint32_t height, GraphicsBuffer targetBuffer)
+    {
+        std::vector<char> layerData;
+        pack_int8_layer(layerData, layer, width, height);
+        uploadManager.upload_buffer(layerData.data(), layerData.size(), targetBuffer);
     }
 
-    void upload(GraphicsDevice device, CommandQueue cmdQ, CommandBuffer cmdB, ComputeShader fp32tofp16CS, const CPUMLP& cpuMLP, GPUMLP& gpuMLP)
+    void upload(UploadManager& uploadManager, ComputeShader fp32tofp16CS, const CPUMLP& cpuMLP, GPUMLP& gpuMLP)
     {
+        // Int8 weights go to the main buffers as is, they have no optimal copy
+        const bool int8Weights = cpuMLP.weightFormat == MLPWeightFormat::Int8;
+
         // MLP0
-        upload_and_convert_matrices(device, cmdQ, cmdB, (char*)cpuMLP.mlp0Buffer.data(), cpuMLP.mlp0Width, cpuMLP.mlp0Height, gpuMLP.weight0Buffer, gpuMLP.weight0OptimalBuffer, 0);
-        sync_convert_and_upload_buffer_to_gpu(device, cmdQ, cmdB, fp32tofp16CS, (char*)(cpuMLP.mlp0Buffer.data() + cpuMLP.mlp0Width * cpuMLP.mlp0Height), cpuMLP.mlp0Width * sizeof(float), sizeof(float), gpuMLP.bias0Buffer);
+        if (int8Weights)
+            upload_int8_weights(uploadManager, cpuMLP.mlp0Int8, cpuMLP.mlp0Width, cpuMLP.mlp0Height, gpuMLP.weight0Buffer);
+        else
+            uploadManager.convert_and_upload_matrix((char*)cpuMLP.mlp0Buffer.data(), cpuMLP.mlp0Width, cpuMLP.mlp0Height, gpuMLP.weight0Buffer, gpuMLP.weight0OptimalBuffer, 0);
+        uploadManager.convert_and_upload_buffer(fp32tofp16CS, (char*)(cpuMLP.mlp0Buffer.data() + cpuMLP.mlp0Width * cpuMLP.mlp0Height), cpuMLP.mlp0Width * sizeof(float), sizeof(float), gpuMLP.bias0Buffer);
 
         // MLP1
-        upload_and_convert_matrices(device, cmdQ, cmdB, (char*)cpuMLP.mlp1Buffer.data(), cpuMLP.mlp1Width, cpuMLP.mlp1Height, gpuMLP.weight1Buffer, gpuMLP.weight1OptimalBuffer, 0);
-        sync_convert_and_upload_buffer_to_gpu(device, cmdQ, cmdB, fp32tofp16CS, (char*)(cpuMLP.mlp1Buffer.data() + cpuMLP.mlp1Width * cpuMLP.mlp1Height), cpuMLP.mlp1Width * sizeof(float), sizeof(float), gpuMLP.bias1Buffer);
+        if (int8Weights)
+            upload_int8_weights(uploadManager, cpuMLP.mlp1Int8, cpuMLP.mlp1Width, cpuMLP.mlp1Height, gpuMLP.weight1Buffer);
+        else
+            uploadManager.convert_and_upload_matrix((char*)cpuMLP.mlp1Buffer.data(), cpuMLP.mlp1Width, cpuMLP.mlp1Height, gpuMLP.weight1Buffer, gpuMLP.weight1OptimalBuffer, 0);
+        uploadManager.convert_and_upload_buffer(fp32tofp16CS, (char*)(cpuMLP.mlp1Buffer.data() + cpuMLP.mlp1Width * cpuMLP.mlp1Height), cpuMLP.mlp1Width * sizeof(float), sizeof(float), gpuMLP.bias1Buffer);
 
         // MLP2
-        upload_and_convert_matrices(device, cmdQ, cmdB, (char*)cpuMLP.mlp2Buffer.data(), cpuMLP.mlp2Width, cpuMLP.mlp2Height, gpuMLP.weight2Buffer, gpuMLP.weight2OptimalBuffer, 0);
-        sync_convert_and_upload_buffer_to_gpu(device, cmdQ, cmdB, fp32tofp16CS, (char*)(cpuMLP.mlp2Buffer.data() + cpuMLP.mlp2Width * cpuMLP.mlp2Height), cpuMLP.mlp2Width * sizeof(float), sizeof(float), gpuMLP.bias2Buffer);
+        if (int8Weights)
+            upload_int8_weights(uploadManager, cpuMLP.mlp2Int8, cpuMLP.mlp2Width, cpuMLP.mlp2Height, gpuMLP.weight2Buffer);
+        else
+            uploadManager.convert_and_upload_matrix((char*)cpuMLP.mlp2Buffer.data(), cpuMLP.mlp2Width, cpuMLP.mlp2Height, gpuMLP.weight2Buffer, gpuMLP.weight2OptimalBuffer, 0);
+        uploadManager.convert_and_upload_buffer(fp32tofp16CS, (char*)(cpuMLP.mlp2Buffer.data() + cpuMLP.mlp2Width * cpuMLP.mlp2Height), cpuMLP.mlp2Width * sizeof(float), sizeof(float), gpuMLP.bias2Buffer);
     }
 
     // Free the allocated memory
@@ -164,31 +262,171 @@ namespace mlp
     }
 }
 
-void unpack_type(const char*& stream, CPUMLP& mlp)
+void pack_layer(std::vector<char>& buffer, const CPUMLP& mlp, uint32_t width, uint32_t height, const std::vector<float>& layerBuffer, const QuantizedLayer& layer)
+{
+    pack_bytes<uint32_t>(buffer, width);
+    pack_bytes<uint32_t>(buffer, height);
+    if (mlp.weightFormat == MLPWeightFormat::Int8)
+    {
+        // Scales, zero points, weights (padded to 4 bytes) and the bias in fp32
+        pack_buffer(buffer, width * sizeof(float), (const char*)layer.scale.data());
+        pack_buffer(buffer, width * sizeof(int32_t), (const char*)layer.zeroPoint.data());
+        pack_buffer(buffer, (size_t)width * height, (const char*)layer.weights.data());
+        buffer.resize(buffer.size() + mlp::int8_weights_padding(width, height), 0);
+        pack_buffer(buffer, width * sizeof(float), (const char*)(layerBuffer.data() + width * height));
+    }
+    else
+        pack_buffer(buffer, ((size_t)width * height + width) * sizeof(float), (const char*)layerBuffer.data());
+}
+
+void pack_type(std::vector<char>& buffer, const CPUMLP& mlp)
+{
+    // MLP data
+    if (mlp.weightFormat == MLPWeightFormat::Int8)
+        pack_bytes<uint32_t>(buffer, MLP_INT8_FORMAT_TAG);
+    pack_bytes<uint32_t>(buffer, mlp.nbMlp);
+    pack_bytes<uint32_t>(buffer, mlp.finalChannelCount);
+    pack_bytes<uint32_t>(buffer, mlp.finalBlockWidth);
+
+    // MLP layers
+    pack_layer(buffer, mlp, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer, mlp.mlp0Int8);
+    pack_layer(buffer, mlp, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer, mlp.mlp1Int8);
+    pack_layer(buffer, mlp, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer, mlp.mlp2Int8);
+}
+
+bool pack_layer(StreamWriter& writer, const CPUMLP& mlp, uint32_t width, uint32_t height, const std::vector<float>& layerBuffer, const QuantizedLayer& layer)
+{
+    // Same layout as the buffer variant
+    bool success = writer.write_bytes<uint32_t>(width) && writer.write_bytes<uint32_t>(height);
+    if (mlp.weightFormat == MLPWeightFormat::Int8)
+    {
+        const char padding[4] = { 0, 0, 0, 0 };
+        return success
+            && writer.write_buffer(width * sizeof(float), (const char*)layer.scale.data())
+            && writer.write_buffer(width * sizeof(int32_t), (const char*)layer.zeroPoint.data())
+            && writer.write_buffer((uint64_t)width * height, (const char*)layer.weights.data())
+            && writer.write_buffer(mlp::int8_weights_padding(width, height), padding)
+            && writer.write_buffer(width * sizeof(float), (const char*)(layerBuffer.data() + width * height));
+    }
+    return success && writer.write_buffer(((uint64_t)width * height + width) * sizeof(float), (const char*)layerBuffer.data());
+}
+
+bool pack_type(StreamWriter& writer, const CPUMLP& mlp)
 {
     // MLP data
-    unpack_bytes<uint32_t>(stream, mlp.nbMlp);
-    unpack_bytes<uint32_t>(stream, mlp.finalChannelCount);
-    unpack_bytes<uint32_t>(stream, mlp.finalBlockWidth);
-
-    // MLP layer 0
-    unpack_bytes<uint32_t>(stream, mlp.mlp0Width);
-    unpack_bytes<uint32_t>(stream, mlp.mlp0Height);
-    const uint32_t mlp0Size = mlp.mlp0Width * mlp.mlp0Height + mlp.mlp0Width;
-    mlp.mlp0Buffer.resize(mlp0Size);
-    unpack_buffer(stream, mlp0Size * sizeof(float), (char*)mlp.mlp0Buffer.data());
-
-    // MLP layer 1
-    unpack_bytes<uint32_t>(stream, mlp.mlp1Width);
-    unpack_bytes<uint32_t>(stream, mlp.mlp1Height);
-    const uint32_t mlp1Size = mlp.mlp1Width * mlp.mlp1Height + mlp.mlp1Width;
-    mlp.mlp1Buffer.resize(mlp1Size);
-    unpack_buffer(stream, mlp1Size * sizeof(float), (char*)mlp.mlp1Buffer.data());
-
-    // MLP layer 2
-    unpack_bytes<uint32_t>(stream, mlp.mlp2Width);
-    unpack_bytes<uint32_t>(stream, mlp.mlp2Height);
-    const uint32_t mlp2Size = mlp.mlp2Width * mlp.mlp2Height + mlp.mlp2Width;
-    mlp.mlp2Buffer.resize(mlp2Size);
-    unpack_buffer(stream, mlp2Size * sizeof(float), (char*)mlp.mlp2Buffer.data());
+    bool success = true;
+    if (mlp.weightFormat == MLPWeightFormat::Int8)
+        success = writer.write_bytes<uint32_t>(MLP_INT8_FORMAT_TAG);
+    success = success
+        && writer.write_bytes<uint32_t>(mlp.nbMlp)
+        && writer.write_bytes<uint32_t>(mlp.finalChannelCount)
+        && writer.write_bytes<uint32_t>(mlp.finalBlockWidth);
+
+    // MLP layers
+    return success
+        && pack_layer(writer, mlp, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer, mlp.mlp0Int8)
+        && pack_layer(writer, mlp, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer, mlp.mlp1Int8)
+        && pack_layer(writer, mlp, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer, mlp.mlp2Int8);
+}
+
+void dequantize_layer(const QuantizedLayer& layer, uint32_t width, uint32_t height, std::vector<float>& layerBuffer)
+{
+    for (uint32_t l = 0; l < height; ++l)
+        for (uint32_t x = 0; x < width; ++x)
+            layerBuffer[width * l + x] = layer.scale[x] * (float)(layer.weights[width * l + x] - layer.zeroPoint[x]);
+}
+
+namespace mlp
+{
+    bool map_layer(StreamReader& reader, MLPWeightFormat weightFormat, MLPLayerView& layer)
+    {
+        // The spans point inside the file, the writer pads the int8 weights so that the bias stays aligned
+        reader.read_bytes<uint32_t>(layer.width);
+        reader.read_bytes<uint32_t>(layer.height);
+        const uint64_t weightCount = (uint64_t)layer.width * layer.height;
+        if (weightFormat == MLPWeightFormat::Int8)
+        {
+            return reader.map_span(layer.width, layer.scale)
+                && reader.map_span(layer.width, layer.zeroPoint)
+                && reader.map_span(weightCount, layer.weights)
+                && reader.skip(int8_weights_padding(layer.width, layer.height))
+                && reader.map_span(layer.width, layer.bias);
+        }
+        return reader.map_span(weightCount + layer.width, layer.buffer);
+    }
+
+    bool map_view(const char* data, uint64_t size, CPUMLPView& view)
+    {
+        // Files written by mlp::save_file end with a checksum
+        StreamReader reader(data, size);
+        if (!reader.verify_checksum())
+            return false;
+
+        // The int8 variant is tagged, legacy files start directly with the MLP count
+        uint32_t tag = 0;
+        memcpy(&tag, data, std::min<uint64_t>(size, sizeof(uint32_t)));
+        view.weightFormat = MLPWeightFormat::Float32;
+        if (tag == MLP_INT8_FORMAT_TAG)
+        {
+            reader.skip(sizeof(uint32_t));
+            view.weightFormat = MLPWeightFormat::Int8;
+        }
+
+        // MLP data
+        reader.read_bytes<uint32_t>(view.nbMlp);
+        reader.read_bytes<uint32_t>(view.finalChannelCount);
+        reader.read_bytes<uint32_t>(view.finalBlockWidth);
+
+        // MLP layers
+        for (uint32_t layerIdx = 0; layerIdx < 3; ++layerIdx)
+            map_layer(reader, view.weightFormat, view.layers[layerIdx]);
+        return !reader.failed();
+    }
+
+    void load_layer(const MLPLayerView& layerView, MLPWeightFormat weightFormat, uint32_t& width, uint32_t& height, std::vector<float>& layerBuffer, QuantizedLayer& layer)
+    {
+        width = layerView.width;
+        height = layerView.height;
+        if (weightFormat == MLPWeightFormat::Int8)
+        {
+            layer.scale.assign(layerView.scale.begin(), layerView.scale.end());
+            layer.zeroPoint.assign(layerView.zeroPoint.begin(), layerView.zeroPoint.end());
+            layer.weights.assign(layerView.weights.begin(), layerView.weights.end());
+            layerBuffer.resize((size_t)width * height + width);
+            memcpy(layerBuffer.data() + (size_t)width * height, layerView.bias.data(), width * sizeof(float));
+            dequantize_layer(layer, width, height, layerBuffer);
+        }
+        else
+            layerBuffer.assign(layerView.buffer.begin(), layerView.buffer.end());
+    }
+
+    void load_view(const CPUMLPView& view, CPUMLP& mlp)
+    {
+        mlp.weightFormat = view.weightFormat;
+        mlp.nbMlp = view.nbMlp;
+        mlp.finalChannelCount = view.finalChannelCount;
+        mlp.finalBlockWidth = view.finalBlockWidth;
+        load_layer(view.layers[0], view.weightFormat, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer, mlp.mlp0Int8);
+        load_layer(view.layers[1], view.weightFormat, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer, mlp.mlp1Int8);
+        load_layer(view.layers[2], view.weightFormat, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer, mlp.mlp2Int8);
+    }
+
+    void load_file(const char* mlpPath, CPUMLP& mlp)
+    {
+        FileView file;
+        assert_msg(file.open(mlpPath), "Failed to open the MLP file\n");
+        CPUMLPView view;
+        assert_msg(map_view(file.data(), file.size(), view), "Invalid MLP file\n");
+        load_view(view, mlp);
+    }
+
+    void save_file(const char* mlpPath, const CPUMLP& mlp)
+    {
+        // Streamed to the file, the writer stages it in chunks and checksums it on the way
+        StreamWriter writer;
+        assert_msg(writer.open(mlpPath), "Failed to create the MLP file\n");
+        pack_type(writer, mlp);
+        writer.write_checksum();
+        assert_msg(writer.close(), "Failed to write the MLP file\n");
+    }
 }
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/mlp_fp16.h"
+#include "math/operators.h"
+#include "tools/cpu_features.h"
+#include "tools/security.h"
+
+// System includes
+#include <string.h>
+#if defined(CPU_X64)
+#include <immintrin.h>
+#endif
+
+namespace mlp_fp16
+{
+    void round_buffer(const std::vector<float>& buffer, std::vector<float>& rounded)
+    {
+        rounded.resize(buffer.size());
+        for (size_t i = 0; i < buffer.size(); ++i)
+            rounded[i] = to_float(to_half(buffer[i]));
+    }
+
+    void prepare(const CPUMLP& mlp, FP16Network& network)
+    {
+        std::vector<float> rounded;
+        round_buffer(mlp.mlp0Buffer, rounded);
+        mlp::repack_layer(rounded.data(), mlp.mlp0Width, mlp.mlp0Height, network.layers.layers[0]);
+        round_buffer(mlp.mlp1Buffer, rounded);
+        mlp::repack_layer(rounded.data(), mlp.mlp1Width, mlp.mlp1Height, network.layers.layers[1]);
+        round_buffer(mlp.mlp2Buffer, rounded);
+        mlp::repack_layer(rounded.data(), mlp.mlp2Width, mlp.mlp2Height, network.layers.layers[2]);
+    }
+
+    float round_half(float value)
+    {
+        return to_float(to_half(value));
+    }
+
+    // Operands and result are fp16 values stored as float
+    float fma_half(float a, float b, float c, FP16MulAdd mode)
+    {
+        // The product of two fp16 values is exact in fp32
+        const float product = a * b;
+        if (mode == FP16MulAdd::Separate)
+        {
+            // The sum of two fp16 values rounded to fp32 then fp16 is correctly rounded
+            return round_half(round_half(product) + c);
+        }
+
+        // Recover the exact error of the fp32 sum (TwoSum)
+        float sum = product + c;
+        const float bv = sum - product;
+        const float error = (product - (sum - bv)) + (c - bv);
+
+        // Round to odd (truncate and set the last bit if inexact), 24 bits being more than 11 + 2 the rounding to fp16 is then exact
+        if (error != 0.0f)
+        {
+            uint32_t bits;
+            memcpy(&bits, &sum, sizeof(float));
+            if ((error < 0.0f) != (sum < 0.0f))
+                bits -= 1;
+            bits |= 1;
+            memcpy(&sum, &bits, sizeof(float));
+        }
+        return round_half(sum);
+    }
+
+    float16_t fma(float16_t a, float16_t b, float16_t c, FP16MulAdd mode)
+    {
+        return to_half(fma_half(to_float(a), to_float(b), to_float(c), mode));
+    }
+
+    float16_t add(float16_t a, float16_t b)
+    {
+        return to_half(to_float(a) + to_float(b));
+    }
+
+    uint32_t scratch_size(const FP16Network& network, uint32_t batchSize)
+    {
+        // Rounded input and the two hidden layers
+        const RepackedLayer* layers = network.layers.layers;
+        return (layers[0].height + layers[0].width + layers[1].width) * batchSize;
+    }
+
+    void evaluate_layer_scalar(const float* input, const RepackedLayer& layer, bool relu, float* output, uint32_t batchSize, FP16MulAdd mode)
+    {
+        for (uint32_t x = 0; x < layer.width; ++x)
+        {
+            const float* panel = mlp::panel_column(layer, x);
+            for (uint32_t t = 0; t < batchSize; ++t)
+            {
+                // Same order as the shader, the bias comes last
+                float acc = 0.0f;
+                for (uint32_t l = 0; l < layer.height; ++l)
+                    acc = fma_half(input[l * batchSize + t], panel[(l + 1) * MLP_PANEL_WIDTH], acc, mode);
+                acc = round_half(acc + panel[0]);
+                output[x * batchSize + t] = relu ? (acc > 0.0f ? acc : 0.0f) : acc;
+            }
+        }
+    }
+
+#if defined(CPU_X64)
+    TARGET_AVX2 inline __m256 round_half_avx2(__m256 value)
+    {
+        return _mm256_cvtph_ps(_mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    template<bool Fused>
+    TARGET_AVX2 inline __m256 fma_half_avx2(__m256 a, __m256 b, __m256 c)
+    {
+        // See fma_half
+        const __m256 product = _mm256_mul_ps(a, b);
+        if (!Fused)
+            return round_half_avx2(_mm256_add_ps(round_half_avx2(product), c));
+
+        const __m256 sum = _mm256_add_ps(product, c);
+        const __m256 bv = _mm256_sub_ps(sum, product);
+        const __m256 error = _mm256_add_ps(_mm256_sub_ps(product, _mm256_sub_ps(sum, bv)), _mm256_sub_ps(c, bv));
+
+        // Step toward zero when the error has the opposite sign (mask = -1), then set the sticky bit
+        const __m256i inexact = _mm256_castps_si256(_mm256_cmp_ps(error, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+        const __m256i opposite = _mm256_srai_epi32(_mm256_castps_si256(_mm256_xor_ps(error, sum)), 31);
+        __m256i bits = _mm256_add_epi32(_mm256_castps_si256(sum), _mm256_and_si256(inexact, opposite));
+        bits = _mm256_or_si256(bits, _mm256_and_si256(inexact, _mm256_set1_epi32(1)));
+        return round_half_avx2(_mm256_castsi256_ps(bits));
+    }
+
+    // Evaluates XT outputs for NV vectors of 8 texels (the emulation needs temporaries, XT * NV is kept at 4)
+    template<uint32_t NV, uint32_t XT, bool Fused>
+    TARGET_AVX2 void evaluate_tile_avx2(const float* input, const float* panel, uint32_t height, bool relu, float* output, uint32_t x)
+    {
+        const uint32_t batchSize = NV * 8;
+        __m256 acc[XT][NV];
+        UNROLL_LOOP
+        for (uint32_t j = 0; j < XT; ++j)
+        {
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                acc[j][v] = _mm256_setzero_ps();
+        }
+
+        for (uint32_t l = 0; l < height; ++l)
+        {
+            __m256 inputV[NV];
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                inputV[v] = _mm256_loadu_ps(input + l * batchSize + 8 * v);
+
+            const float* weightRow = panel + (l + 1) * MLP_PANEL_WIDTH;
+            UNROLL_LOOP
+            for (uint32_t j = 0; j < XT; ++j)
+            {
+                __m256 weightV = _mm256_broadcast_ss(weightRow + j);
+                UNROLL_LOOP
+                for (uint32_t v = 0; v < NV; ++v)
+                    acc[j][v] = fma_half_avx2<Fused>(inputV[v], weightV, acc[j][v]);
+            }
+        }
+
+        // Bias then activation
+        const __m256 zero = _mm256_setzero_ps();
+        UNROLL_LOOP
+        for (uint32_t j = 0; j < XT; ++j)
+        {
+            __m256 biasV = _mm256_broadcast_ss(panel + j);
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+            {
+                __m256 result = round_half_avx2(_mm256_add_ps(acc[j][v], biasV));
+                _mm256_storeu_ps(output + (x + j) * batchSize + 8 * v, relu ? _mm256_max_ps(result, zero) : result);
+            }
+        }
+    }
+
+    template<uint32_t NV, bool Fused>
+    TARGET_AVX2 void evaluate_layer_avx2(const float* input, const RepackedLayer& layer, bool relu, float* output)
+    {
+        constexpr uint32_t XT = 4 / NV;
+        uint32_t x = 0;
+        for (; x + XT <= layer.width; x += XT)
+            evaluate_tile_avx2<NV, XT, Fused>(input, mlp::panel_column(layer, x), layer.height, relu, output, x);
+        for (; x < layer.width; ++x)
+            evaluate_tile_avx2<NV, 1, Fused>(input, mlp::panel_column(layer, x), layer.height, relu, output, x);
+    }
+
+    template<bool Fused>
+    void evaluate_layer_avx2(const float* input, const RepackedLayer& layer, bool relu, float* output, uint32_t batchSize)
+    {
+        if (batchSize == 8)
+            return evaluate_layer_avx2<1, Fused>(input, layer, relu, output);
+        if (batchSize == 16)
+            return evaluate_layer_avx2<2, Fused>(input, layer, relu, output);
+        evaluate_layer_avx2<4, Fused>(input, layer, relu, output);
+    }
+
+    TARGET_AVX2 void round_input_f16c(const float* input, float* output, uint32_t count)
+    {
+        uint32_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(output + i, round_half_avx2(_mm256_loadu_ps(input + i)));
+        for (; i < count; ++i)
+            output[i] = round_half(input[i]);
+    }
+#endif
+
+    void evaluate_layer(const float* input, const RepackedLayer& layer, bool relu, float* output, uint32_t batchSize, FP16MulAdd mode, SIMDLevel level)
+    {
+#if defined(CPU_X64)
+        // The emulation relies on F16C, AVX-512 uses the same kernels
+        if (level != SIMDLevel::Scalar)
+        {
+            if (mode == FP16MulAdd::Fused)
+                return evaluate_layer_avx2<true>(input, layer, relu, output, batchSize);
+            return evaluate_layer_avx2<false>(input, layer, relu, output, batchSize);
+        }
+#endif
+        evaluate_layer_scalar(input, layer, relu, output, batchSize, mode);
+    }
+
+    void evaluate_batch(const FP16Network& network, const float* input, float* output, float* scratch, uint32_t batchSize, FP16MulAdd mode, SIMDLevel level)
+    {
+        assert_msg(batchSize == 8 || batchSize == 16 || batchSize == 32, "Unsupported MLP batch size\n");
+        const RepackedLayer* layers = network.layers.layers;
+        float* roundedInput = scratch;
+        float* pongMemoryA = roundedInput + layers[0].height * batchSize;
+        float* pongMemoryB = pongMemoryA + layers[0].width * batchSize;
+
+        // The shader converts the latents and the LOD to fp16
+        const uint32_t inputCount = layers[0].height * batchSize;
+#if defined(CPU_X64)
+        if (level != SIMDLevel::Scalar)
+            round_input_f16c(input, roundedInput, inputCount);
+        else
+#endif
+        {
+            for (uint32_t i = 0; i < inputCount; ++i)
+                roundedInput[i] = round_half(input[i]);
+        }
+
+        evaluate_layer(roundedInput, layers[0], true, pongMemoryA, batchSize, mode, level);
+        evaluate_layer(pongMemoryA, layers[1], true, pongMemoryB, batchSize, mode, level);
+        evaluate_layer(pongMemoryB, layers[2], false, output, batchSize, mode, level);
+    }
+}
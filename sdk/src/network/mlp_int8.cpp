@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/mlp_int8.h"
+#include "tools/cpu_features.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+#if defined(CPU_X64)
+#include <immintrin.h>
+#endif
+
+// Largest quantized activation, keeps the pairwise sums of _mm256_maddubs_epi16 from saturating
+#define MLP_INT8_ACTIVATION_MAX 127
+
+namespace mlp_int8
+{
+    uint32_t group_count(const Int8Layer& layer)
+    {
+        return (layer.height + 3) / 4;
+    }
+
+    void prepare_layer(const std::vector<float>& layerBuffer, const QuantizedLayer& quantized, uint32_t width, uint32_t height, Int8Layer& layer)
+    {
+        assert_msg(quantized.weights.size() == (size_t)width * height, "The MLP has no int8 weights\n");
+
+        // Pad the inputs to a multiple of 4 with the zero points
+        layer.width = width;
+        layer.height = height;
+        const uint32_t paddedHeight = group_count(layer) * 4;
+        layer.weights.resize((size_t)width * paddedHeight);
+        for (uint32_t l = 0; l < paddedHeight; ++l)
+        {
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const int8_t weight = l < height ? quantized.weights[width * l + x] : (int8_t)quantized.zeroPoint[x];
+                layer.weights[((l / 4) * width + x) * 4 + (l % 4)] = weight;
+            }
+        }
+        layer.scale = quantized.scale;
+        layer.zeroPoint = quantized.zeroPoint;
+        layer.bias.assign(layerBuffer.begin() + width * height, layerBuffer.begin() + width * height + width);
+    }
+
+    void prepare(const CPUMLP& mlp, Int8Network& network)
+    {
+        assert_msg(mlp.weightFormat == MLPWeightFormat::Int8, "The MLP has no int8 weights\n");
+        prepare_layer(mlp.mlp0Buffer, mlp.mlp0Int8, mlp.mlp0Width, mlp.mlp0Height, network.layers[0]);
+        prepare_layer(mlp.mlp1Buffer, mlp.mlp1Int8, mlp.mlp1Width, mlp.mlp1Height, network.layers[1]);
+        prepare_layer(mlp.mlp2Buffer, mlp.mlp2Int8, mlp.mlp2Width, mlp.mlp2Height, network.layers[2]);
+    }
+
+    uint32_t scratch_size(const Int8Network& network, uint32_t batchSize)
+    {
+        // Texel major copies of the input, the hidden layers and the output, then the quantized activations, their scale and sum
+        const Int8Layer* layers = network.layers;
+        uint32_t maxGroups = 0;
+        for (const Int8Layer& layer : network.layers)
+            maxGroups = std::max(maxGroups, group_count(layer));
+        return (layers[0].height + layers[0].width + layers[1].width + layers[2].width + maxGroups + 2) * batchSize;
+    }
+
+    // Per texel quantization to [0, MLP_INT8_ACTIVATION_MAX], the activations are texel major ([t][4 * groupCount])
+    void quantize_activations(const Int8Layer& layer, const float* input, uint8_t* activations, float* activationScale, int32_t* activationSum, uint32_t batchSize)
+    {
+        const uint32_t groupCount = group_count(layer);
+        for (uint32_t t = 0; t < batchSize; ++t)
+        {
+            const float* texelInput = input + t * layer.height;
+            float maxValue = 0.0f;
+            for (uint32_t l = 0; l < layer.height; ++l)
+                maxValue = std::max(maxValue, texelInput[l]);
+            const float invScale = maxValue > 0.0f ? MLP_INT8_ACTIVATION_MAX / maxValue : 0.0f;
+
+            uint8_t* texelActivations = activations + t * groupCount * 4;
+            int32_t sum = 0;
+            for (uint32_t l = 0; l < layer.height; ++l)
+            {
+                const uint8_t q = (uint8_t)(std::max(texelInput[l], 0.0f) * invScale + 0.5f);
+                texelActivations[l] = q;
+                sum += q;
+            }
+            for (uint32_t l = layer.height; l < groupCount * 4; ++l)
+                texelActivations[l] = 0;
+            activationScale[t] = maxValue / MLP_INT8_ACTIVATION_MAX;
+            activationSum[t] = sum;
+        }
+    }
+
+#if defined(CPU_X64)
+    // Same as quantize_activations for a height multiple of 8
+    TARGET_AVX2 void quantize_activations_avx2(const Int8Layer& layer, const float* input, uint8_t* activations, float* activationScale, int32_t* activationSum, uint32_t batchSize)
+    {
+        const uint32_t groupCount = group_count(layer);
+        for (uint32_t t = 0; t < batchSize; ++t)
+        {
+            const float* texelInput = input + t * layer.height;
+            __m256 maxV = _mm256_setzero_ps();
+            for (uint32_t l = 0; l < layer.height; l += 8)
+                maxV = _mm256_max_ps(maxV, _mm256_loadu_ps(texelInput + l));
+            __m128 max4 = _mm_max_ps(_mm256_castps256_ps128(maxV), _mm256_extractf128_ps(maxV, 1));
+            max4 = _mm_max_ps(max4, _mm_movehl_ps(max4, max4));
+            max4 = _mm_max_ss(max4, _mm_shuffle_ps(max4, max4, 1));
+            const float maxValue = _mm_cvtss_f32(max4);
+            const float invScale = maxValue > 0.0f ? MLP_INT8_ACTIVATION_MAX / maxValue : 0.0f;
+
+            // Truncation of value + 0.5 to match the scalar rounding
+            uint8_t* texelActivations = activations + t * groupCount * 4;
+            const __m256 invScaleV = _mm256_set1_ps(invScale);
+            const __m256 half = _mm256_set1_ps(0.5f);
+            __m256i sumV = _mm256_setzero_si256();
+            for (uint32_t l = 0; l < layer.height; l += 8)
+            {
+                const __m256 value = _mm256_max_ps(_mm256_loadu_ps(texelInput + l), _mm256_setzero_ps());
+                const __m256i q = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, invScaleV), half));
+                sumV = _mm256_add_epi32(sumV, q);
+                const __m128i q16 = _mm_packus_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+                _mm_storel_epi64((__m128i*)(texelActivations + l), _mm_packus_epi16(q16, q16));
+            }
+            __m128i sum4 = _mm_add_epi32(_mm256_castsi256_si128(sumV), _mm256_extracti128_si256(sumV, 1));
+            sum4 = _mm_add_epi32(sum4, _mm_unpackhi_epi64(sum4, sum4));
+            sum4 = _mm_add_epi32(sum4, _mm_shuffle_epi32(sum4, 1));
+            activationScale[t] = maxValue / MLP_INT8_ACTIVATION_MAX;
+            activationSum[t] = _mm_cvtsi128_si32(sum4);
+        }
+    }
+#endif
+
+    // Integer dot products, then the zero points are removed, the result rescaled and the bias added. The output is texel major ([t][width])
+    void evaluate_layer_scalar(const Int8Layer& layer, const uint8_t* activations, const float* activationScale, const int32_t* activationSum, float* output, uint32_t batchSize, bool relu)
+    {
+        const uint32_t groupCount = group_count(layer);
+        for (uint32_t t = 0; t < batchSize; ++t)
+        {
+            const uint8_t* texelActivations = activations + t * groupCount * 4;
+            for (uint32_t x = 0; x < layer.width; ++x)
+            {
+                int32_t dot = 0;
+                for (uint32_t g = 0; g < groupCount; ++g)
+                {
+                    const int8_t* weights = layer.weights.data() + ((size_t)g * layer.width + x) * 4;
+                    for (uint32_t k = 0; k < 4; ++k)
+                        dot += texelActivations[4 * g + k] * weights[k];
+                }
+                const float value = (float)(dot - layer.zeroPoint[x] * activationSum[t]) * (layer.scale[x] * activationScale[t]) + layer.bias[x];
+                output[t * layer.width + x] = relu ? std::max(value, 0.0f) : value;
+            }
+        }
+    }
+
+#if defined(CPU_X64)
+    // u8 x s8 products summed by pairs in 16 bits, then by 4 in 32 bits. NT texels share each weight load and keep independent accumulators.
+    template<uint32_t NT>
+    TARGET_AVX2 void evaluate_block_avx2(const Int8Layer& layer, const uint8_t* activations, const float* activationScale, const int32_t* activationSum, float* output, bool relu)
+    {
+        const uint32_t groupCount = group_count(layer);
+        const __m256i ones = _mm256_set1_epi16(1);
+        for (uint32_t x = 0; x < layer.width; x += 8)
+        {
+            __m256i acc[NT];
+            UNROLL_LOOP
+            for (uint32_t t = 0; t < NT; ++t)
+                acc[t] = _mm256_setzero_si256();
+            for (uint32_t g = 0; g < groupCount; ++g)
+            {
+                const __m256i weights = _mm256_loadu_si256((const __m256i*)(layer.weights.data() + ((size_t)g * layer.width + x) * 4));
+                UNROLL_LOOP
+                for (uint32_t t = 0; t < NT; ++t)
+                {
+                    int32_t activationGroup;
+                    memcpy(&activationGroup, activations + (t * groupCount + g) * 4, sizeof(int32_t));
+                    const __m256i pairs = _mm256_maddubs_epi16(_mm256_set1_epi32(activationGroup), weights);
+                    acc[t] = _mm256_add_epi32(acc[t], _mm256_madd_epi16(pairs, ones));
+                }
+            }
+
+            const __m256i zeroPoint = _mm256_loadu_si256((const __m256i*)(layer.zeroPoint.data() + x));
+            const __m256 scale = _mm256_loadu_ps(layer.scale.data() + x);
+            const __m256 bias = _mm256_loadu_ps(layer.bias.data() + x);
+            UNROLL_LOOP
+            for (uint32_t t = 0; t < NT; ++t)
+            {
+                const __m256i dot = _mm256_sub_epi32(acc[t], _mm256_mullo_epi32(zeroPoint, _mm256_set1_epi32(activationSum[t])));
+                __m256 value = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(dot), _mm256_mul_ps(scale, _mm256_set1_ps(activationScale[t]))), bias);
+                if (relu)
+                    value = _mm256_max_ps(value, _mm256_setzero_ps());
+                _mm256_storeu_ps(output + t * layer.width + x, value);
+            }
+        }
+    }
+
+    TARGET_AVX2 void evaluate_layer_avx2(const Int8Layer& layer, const uint8_t* activations, const float* activationScale, const int32_t* activationSum, float* output, uint32_t batchSize, bool relu)
+    {
+        const uint32_t groupCount = group_count(layer);
+        uint32_t t = 0;
+        for (; t + 4 <= batchSize; t += 4)
+            evaluate_block_avx2<4>(layer, activations + t * groupCount * 4, activationScale + t, activationSum + t, output + t * layer.width, relu);
+        for (; t < batchSize; ++t)
+            evaluate_block_avx2<1>(layer, activations + t * groupCount * 4, activationScale + t, activationSum + t, output + t * layer.width, relu);
+    }
+
+    // Same as evaluate_block_avx2 with the 4-way u8 x s8 dot products of VNNI
+    template<uint32_t NT>
+    TARGET_AVX512VNNI void evaluate_block_avx512vnni(const Int8Layer& layer, const uint8_t* activations, const float* activationScale, const int32_t* activationSum, float* output, bool relu)
+    {
+        const uint32_t groupCount = group_count(layer);
+        for (uint32_t x = 0; x < layer.width; x += 16)
+        {
+            __m512i acc[NT];
+            UNROLL_LOOP
+            for (uint32_t t = 0; t < NT; ++t)
+                acc[t] = _mm512_setzero_si512();
+            for (uint32_t g = 0; g < groupCount; ++g)
+            {
+                const __m512i weights = _mm512_loadu_si512((const void*)(layer.weights.data() + ((size_t)g * layer.width + x) * 4));
+                UNROLL_LOOP
+                for (uint32_t t = 0; t < NT; ++t)
+                {
+                    int32_t activationGroup;
+                    memcpy(&activationGroup, activations + (t * groupCount + g) * 4, sizeof(int32_t));
+                    acc[t] = _mm512_dpbusd_epi32(acc[t], _mm512_set1_epi32(activationGroup), weights);
+                }
+            }
+
+            // Zero masking forms with a full mask, the unmasked intrinsics merge into an undefined register that GCC reports as uninitialized
+            const __m512i zeroPoint = _mm512_loadu_si512((const void*)(layer.zeroPoint.data() + x));
+            const __m512 scale = _mm512_loadu_ps(layer.scale.data() + x);
+            const __m512 bias = _mm512_loadu_ps(layer.bias.data() + x);
+            UNROLL_LOOP
+            for (uint32_t t = 0; t < NT; ++t)
+            {
+                const __m512i dot = _mm512_sub_epi32(acc[t], _mm512_mullo_epi32(zeroPoint, _mm512_set1_epi32(activationSum[t])));
+                __m512 value = _mm512_add_ps(_mm512_mul_ps(_mm512_maskz_cvtepi32_ps(0xFFFF, dot), _mm512_mul_ps(scale, _mm512_set1_ps(activationScale[t]))), bias);
+                if (relu)
+                    value = _mm512_maskz_max_ps(0xFFFF, value, _mm512_setzero_ps());
+                _mm512_storeu_ps(output + t * layer.width + x, value);
+            }
+        }
+    }
+
+    TARGET_AVX512VNNI void evaluate_layer_avx512vnni(const Int8Layer& layer, const uint8_t* activations, const float* activationScale, const int32_t* activationSum, float* output, uint32_t batchSize, bool relu)
+    {
+        const uint32_t groupCount = group_count(layer);
+        uint32_t t = 0;
+        for (; t + 4 <= batchSize; t += 4)
+            evaluate_block_avx512vnni<4>(layer, activations + t * groupCount * 4, activationScale + t, activationSum + t, output + t * layer.width, relu);
+        for (; t < batchSize; ++t)
+            evaluate_block_avx512vnni<1>(layer, activations + t * groupCount * 4, activationScale + t, activationSum + t, output + t * layer.width, relu);
+    }
+#endif
+
+    void evaluate_layer(const Int8Layer& layer, const float* input, float* output, float* scratch, uint32_t batchSize, bool relu, SIMDLevel level)
+    {
+        uint8_t* activations = (uint8_t*)scratch;
+        float* activationScale = scratch + group_count(layer) * batchSize;
+        int32_t* activationSum = (int32_t*)(activationScale + batchSize);
+#if defined(CPU_X64)
+        if (level >= SIMDLevel::AVX2 && layer.height % 8 == 0)
+            quantize_activations_avx2(layer, input, activations, activationScale, activationSum, batchSize);
+        else
+            quantize_activations(layer, input, activations, activationScale, activationSum, batchSize);
+
+        if (level == SIMDLevel::AVX512 && cpu_features().avx512vnni && layer.width % 16 == 0)
+        {
+            evaluate_layer_avx512vnni(layer, activations, activationScale, activationSum, output, batchSize, relu);
+            return;
+        }
+        if (level >= SIMDLevel::AVX2 && layer.width % 8 == 0)
+        {
+            evaluate_layer_avx2(layer, activations, activationScale, activationSum, output, batchSize, relu);
+            return;
+        }
+#else
+        (void)level;
+        quantize_activations(layer, input, activations, activationScale, activationSum, batchSize);
+#endif
+        evaluate_layer_scalar(layer, activations, activationScale, activationSum, output, batchSize, relu);
+    }
+
+    void evaluate_batch(const Int8Network& network, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+    {
+        // Texel major copy of the input
+        const Int8Layer* layers = network.layers;
+        float* inputMemory = scratch;
+        float* pongMemoryA = inputMemory + layers[0].height * batchSize;
+        float* pongMemoryB = pongMemoryA + layers[0].width * batchSize;
+        float* outputMemory = pongMemoryB + layers[1].width * batchSize;
+        float* layerMemory = outputMemory + layers[2].width * batchSize;
+        for (uint32_t l = 0; l < layers[0].height; ++l)
+            for (uint32_t t = 0; t < batchSize; ++t)
+                inputMemory[t * layers[0].height + l] = input[l * batchSize + t];
+
+        evaluate_layer(layers[0], inputMemory, pongMemoryA, layerMemory, batchSize, true, level);
+        evaluate_layer(layers[1], pongMemoryA, pongMemoryB, layerMemory, batchSize, true, level);
+        evaluate_layer(layers[2], pongMemoryB, outputMemory, layerMemory, batchSize, false, level);
+
+        // Back to channel major
+        for (uint32_t x = 0; x < layers[2].width; ++x)
+            for (uint32_t t = 0; t < batchSize; ++t)
+                output[x * batchSize + t] = outputMemory[t * layers[2].width + x];
+    }
+
+    float max_difference(const DecodedTextureSet& decodeA, const DecodedTextureSet& decodeB)
+    {
+        float maxError = 0.0f;
+        for (uint64_t i = 0; i < decodeA.data.size(); ++i)
+            maxError = std::max(maxError, fabsf(decodeA.data[i] - decodeB.data[i]));
+        return maxError;
+    }
+
+    void quantize_network(std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, Int8Report& report)
+    {
+        const uint32_t numSets = (uint32_t)mlpArray.size();
+        std::vector<DecodedTextureSet> reference(numSets);
+        report.floatSize = 0;
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            std::vector<char> buffer;
+            pack_type(buffer, mlpArray[setIdx]);
+            report.floatSize += buffer.size();
+            cpu_decoder::decode_texture_set(mlpArray, latentArray, setIdx, 0, reference[setIdx]);
+        }
+
+        // The float weights become the dequantized ones, which is what the shader reads
+        for (CPUMLP& mlp : mlpArray)
+            mlp::quantize_int8(mlp);
+        std::vector<CPUMLP> dequantized = mlpArray;
+        for (CPUMLP& mlp : dequantized)
+            mlp.weightFormat = MLPWeightFormat::Float32;
+
+        report.int8Size = 0;
+        report.maxError = 0.0f;
+        report.maxKernelError = 0.0f;
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            std::vector<char> buffer;
+            pack_type(buffer, mlpArray[setIdx]);
+            report.int8Size += buffer.size();
+
+            DecodedTextureSet int8Decode, shaderDecode;
+            cpu_decoder::decode_texture_set(mlpArray, latentArray, setIdx, 0, int8Decode);
+            cpu_decoder::decode_texture_set(dequantized, latentArray, setIdx, 0, shaderDecode);
+            report.maxError = std::max(report.maxError, max_difference(int8Decode, reference[setIdx]));
+            report.maxKernelError = std::max(report.maxKernelError, max_difference(int8Decode, shaderDecode));
+        }
+    }
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/mlp_pruning.h"
+#include "math/operators.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include <numeric>
+#include <string.h>
+
+namespace mlp_pruning
+{
+    // Calls func with the MLP input of every sampled texel (same inputs as cpu_decoder::decode_texture_set)
+    template<typename Func>
+    void for_each_sample(const CPUMLP& mlp, const CPULatentTexture* latentSet, uint32_t sampleStride, Func func)
+    {
+        const uint32_t texWidth = latentSet[0].width;
+        const uint32_t texHeight = latentSet[0].height;
+        std::vector<float> input(mlp.mlp0Height, 0.0f);
+        for (uint32_t mipIdx = 0; mipIdx < latentSet[0].mipCount; ++mipIdx)
+        {
+            const uint32_t width = std::max(texWidth >> mipIdx, 1u);
+            const uint32_t height = std::max(texHeight >> mipIdx, 1u);
+            const float2 uvDX = { 1.0f / width, 0.0f };
+            const float2 uvDY = { 0.0f, 1.0f / height };
+            float lodLevel = std::min(log2f(std::max(uvDX.x * texWidth, uvDY.y * texHeight)), 15.0f);
+            input[12] = clamp(lodLevel / log2f((float)texWidth), 0.0f, 1.0f);
+
+            for (uint32_t y = 0; y < height; y += sampleStride)
+            {
+                for (uint32_t x = 0; x < width; x += sampleStride)
+                {
+                    float2 uv = { (x + 0.5f) / width, (y + 0.5f) / height };
+                    cpu_decoder::sample_latent_space(latentSet, uv, uvDX, uvDY, input.data());
+                    func(input.data());
+                }
+            }
+        }
+    }
+
+    void collect_statistics(const CPUMLP& mlp, const CPULatentTexture* latentSet, uint32_t sampleStride, NeuronStatistics& statistics)
+    {
+        assert_msg(sampleStride != 0, "Invalid sample stride\n");
+        const uint32_t widths[2] = { mlp.mlp0Width, mlp.mlp1Width };
+        std::vector<double> sum[2];
+        for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+        {
+            sum[layerIdx].assign(widths[layerIdx], 0.0);
+            statistics.minimum[layerIdx].assign(widths[layerIdx], FLT_MAX);
+            statistics.maximum[layerIdx].assign(widths[layerIdx], 0.0f);
+        }
+        statistics.sampleCount = 0;
+
+        // The hidden layers are left in the scratch memory by evaluate_mlp
+        std::vector<float> output(mlp.mlp2Width);
+        std::vector<float> scratch(cpu_decoder::scratch_size(mlp));
+        for_each_sample(mlp, latentSet, sampleStride, [&](const float* input)
+        {
+            cpu_decoder::evaluate_mlp(mlp, input, output.data(), scratch.data());
+            const float* hidden[2] = { scratch.data(), scratch.data() + mlp.mlp0Width };
+            for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+            {
+                for (uint32_t n = 0; n < widths[layerIdx]; ++n)
+                {
+                    const float value = hidden[layerIdx][n];
+                    sum[layerIdx][n] += value;
+                    statistics.minimum[layerIdx][n] = std::min(statistics.minimum[layerIdx][n], value);
+                    statistics.maximum[layerIdx][n] = std::max(statistics.maximum[layerIdx][n], value);
+                }
+            }
+            statistics.sampleCount++;
+        });
+
+        for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+        {
+            statistics.mean[layerIdx].resize(widths[layerIdx]);
+            for (uint32_t n = 0; n < widths[layerIdx]; ++n)
+                statistics.mean[layerIdx][n] = (float)(sum[layerIdx][n] / std::max(statistics.sampleCount, 1u));
+        }
+    }
+
+    // Largest change of the next layer's input that removing a neuron can cause (once its mean is folded in the bias)
+    void contribution_scores(const NeuronStatistics& statistics, uint32_t layerIdx, const std::vector<float>& nextBuffer, uint32_t nextWidth, std::vector<float>& scores)
+    {
+        const uint32_t neuronCount = (uint32_t)statistics.mean[layerIdx].size();
+        scores.resize(neuronCount);
+        for (uint32_t n = 0; n < neuronCount; ++n)
+        {
+            float maxWeight = 0.0f;
+            for (uint32_t x = 0; x < nextWidth; ++x)
+                maxWeight = std::max(maxWeight, fabsf(nextBuffer[nextWidth * n + x]));
+            scores[n] = (statistics.maximum[layerIdx][n] - statistics.minimum[layerIdx][n]) * maxWeight;
+        }
+    }
+
+    // Only keep the output columns listed in kept (bias included)
+    void remove_columns(std::vector<float>& buffer, QuantizedLayer& int8Layer, bool int8Weights, uint32_t& width, uint32_t height, const std::vector<uint32_t>& kept)
+    {
+        const uint32_t newWidth = (uint32_t)kept.size();
+        std::vector<float> data((size_t)newWidth * height + newWidth);
+
+        // The bias is the row past the last weight row
+        for (uint32_t l = 0; l <= height; ++l)
+            for (uint32_t k = 0; k < newWidth; ++k)
+                data[newWidth * l + k] = buffer[width * l + kept[k]];
+
+        if (int8Weights)
+        {
+            QuantizedLayer layer;
+            layer.weights.resize((size_t)newWidth * height);
+            layer.scale.resize(newWidth);
+            layer.zeroPoint.resize(newWidth);
+            for (uint32_t k = 0; k < newWidth; ++k)
+            {
+                for (uint32_t l = 0; l < height; ++l)
+                    layer.weights[newWidth * l + k] = int8Layer.weights[width * l + kept[k]];
+                layer.scale[k] = int8Layer.scale[kept[k]];
+                layer.zeroPoint[k] = int8Layer.zeroPoint[kept[k]];
+            }
+            int8Layer = layer;
+        }
+
+        buffer = data;
+        width = newWidth;
+    }
+
+    // Only keep the input rows listed in kept, the mean contribution of the others is added to the bias
+    void remove_rows(std::vector<float>& buffer, QuantizedLayer& int8Layer, bool int8Weights, uint32_t width, uint32_t& height, const std::vector<uint32_t>& kept, const std::vector<float>& mean)
+    {
+        const uint32_t newHeight = (uint32_t)kept.size();
+        std::vector<float> data((size_t)width * newHeight + width);
+        for (uint32_t k = 0; k < newHeight; ++k)
+            memcpy(&data[width * k], &buffer[width * kept[k]], width * sizeof(float));
+
+        // Fold the removed neurons
+        float* bias = data.data() + width * newHeight;
+        memcpy(bias, &buffer[width * height], width * sizeof(float));
+        std::vector<bool> keptRow(height, false);
+        for (uint32_t l : kept)
+            keptRow[l] = true;
+        for (uint32_t l = 0; l < height; ++l)
+        {
+            if (keptRow[l])
+                continue;
+            for (uint32_t x = 0; x < width; ++x)
+                bias[x] += mean[l] * buffer[width * l + x];
+        }
+
+        // Per column quantization, the kept rows are still valid
+        if (int8Weights)
+        {
+            std::vector<int8_t> weights((size_t)width * newHeight);
+            for (uint32_t k = 0; k < newHeight; ++k)
+                memcpy(&weights[width * k], &int8Layer.weights[width * kept[k]], width);
+            int8Layer.weights = weights;
+        }
+
+        buffer = data;
+        height = newHeight;
+    }
+
+    void prune_network(std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, const PruningSettings& settings, PruningReport& report)
+    {
+        const uint32_t numSets = (uint32_t)mlpArray.size();
+        assert_msg(numSets != 0 && latentArray.size() >= 4 * numSets, "Invalid network\n");
+        const std::vector<CPUMLP> sourceArray = mlpArray;
+        report.sourceWidth[0] = mlpArray[0].mlp0Width;
+        report.sourceWidth[1] = mlpArray[0].mlp1Width;
+
+        // Score the neurons of every set
+        std::vector<NeuronStatistics> statistics(numSets);
+        std::vector<float> scores[2];
+        std::vector<std::vector<uint32_t>> ranking[2];
+        uint32_t survivorCount[2] = { 0, 0 };
+        report.deadNeurons[0] = report.deadNeurons[1] = 0;
+        for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+            ranking[layerIdx].resize(numSets);
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            const CPUMLP& mlp = mlpArray[setIdx];
+            assert_msg(mlp.mlp0Width == report.sourceWidth[0] && mlp.mlp1Width == report.sourceWidth[1], "The sets must share the same dimensions\n");
+            collect_statistics(mlp, latentArray.data() + 4 * setIdx, settings.sampleStride, statistics[setIdx]);
+            contribution_scores(statistics[setIdx], 0, mlp.mlp1Buffer, mlp.mlp1Width, scores[0]);
+            contribution_scores(statistics[setIdx], 1, mlp.mlp2Buffer, mlp.mlp2Width, scores[1]);
+
+            for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+            {
+                const std::vector<float>& layerScores = scores[layerIdx];
+                const float maxScore = *std::max_element(layerScores.begin(), layerScores.end());
+                uint32_t survivors = 0;
+                for (uint32_t n = 0; n < (uint32_t)layerScores.size(); ++n)
+                {
+                    survivors += layerScores[n] > settings.threshold * maxScore ? 1 : 0;
+                    report.deadNeurons[layerIdx] += statistics[setIdx].maximum[layerIdx][n] <= 0.0f ? 1 : 0;
+                }
+                survivorCount[layerIdx] = std::max(survivorCount[layerIdx], survivors);
+
+                // Most important neurons first
+                std::vector<uint32_t>& order = ranking[layerIdx][setIdx];
+                order.resize(layerScores.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return layerScores[a] > layerScores[b]; });
+            }
+        }
+
+        // Common widths, rounded up to 16 by keeping the next best neurons
+        for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+        {
+            uint32_t width = std::max((survivorCount[layerIdx] + 15) / 16 * 16, 16u);
+            if (settings.maxWidth[layerIdx] != 0)
+            {
+                assert_msg((settings.maxWidth[layerIdx] % 16) == 0, "The hidden widths must be multiples of 16\n");
+                width = std::min(width, settings.maxWidth[layerIdx]);
+            }
+            report.prunedWidth[layerIdx] = std::min(width, report.sourceWidth[layerIdx]);
+        }
+
+        // Rebuild the layers
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            CPUMLP& mlp = mlpArray[setIdx];
+            const bool int8Weights = mlp.weightFormat == MLPWeightFormat::Int8;
+            std::vector<uint32_t> kept[2];
+            for (uint32_t layerIdx = 0; layerIdx < 2; ++layerIdx)
+            {
+                const std::vector<uint32_t>& order = ranking[layerIdx][setIdx];
+                kept[layerIdx].assign(order.begin(), order.begin() + report.prunedWidth[layerIdx]);
+                std::sort(kept[layerIdx].begin(), kept[layerIdx].end());
+            }
+
+            remove_columns(mlp.mlp0Buffer, mlp.mlp0Int8, int8Weights, mlp.mlp0Width, mlp.mlp0Height, kept[0]);
+            remove_rows(mlp.mlp1Buffer, mlp.mlp1Int8, int8Weights, mlp.mlp1Width, mlp.mlp1Height, kept[0], statistics[setIdx].mean[0]);
+            remove_columns(mlp.mlp1Buffer, mlp.mlp1Int8, int8Weights, mlp.mlp1Width, mlp.mlp1Height, kept[1]);
+            remove_rows(mlp.mlp2Buffer, mlp.mlp2Int8, int8Weights, mlp.mlp2Width, mlp.mlp2Height, kept[1], statistics[setIdx].mean[1]);
+
+            // Keep the input and output alignment and the CPU layout in sync
+            mlp::align_dimensions(mlp);
+            if (!mlp.repacked.layers[0].data.empty())
+                mlp::repack(mlp);
+        }
+
+        // Measure the damage on the sampled texels
+        report.maxError = 0.0f;
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            const CPUMLP& sourceMLP = sourceArray[setIdx];
+            const CPUMLP& prunedMLP = mlpArray[setIdx];
+            std::vector<float> sourceOutput(sourceMLP.mlp2Width), prunedOutput(prunedMLP.mlp2Width);
+            std::vector<float> sourceScratch(cpu_decoder::scratch_size(sourceMLP)), prunedScratch(cpu_decoder::scratch_size(prunedMLP));
+            for_each_sample(sourceMLP, latentArray.data() + 4 * setIdx, settings.sampleStride, [&](const float* input)
+            {
+                cpu_decoder::evaluate_mlp(sourceMLP, input, sourceOutput.data(), sourceScratch.data());
+                cpu_decoder::evaluate_mlp(prunedMLP, input, prunedOutput.data(), prunedScratch.data());
+                for (uint32_t c = 0; c < std::min(sourceMLP.mlp2Width, prunedMLP.mlp2Width); ++c)
+                    report.maxError = std::max(report.maxError, fabsf(sourceOutput[c] - prunedOutput[c]));
+            });
+        }
+    }
+
+    void save_network(const std::string& modelDir, const std::vector<CPUMLP>& mlpArray)
+    {
+        for (uint32_t setIdx = 0; setIdx < (uint32_t)mlpArray.size(); ++setIdx)
+            mlp::save_file((modelDir + "/mlp_" + std::to_string(setIdx) + ".bin").c_str(), mlpArray[setIdx]);
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/mlp.h"
+#include "network/mlp_repack.h"
+
+namespace mlp
+{
+    void repack_layer(const float* layerBuffer, uint32_t width, uint32_t height, RepackedLayer& layer)
+    {
+        layer.width = width;
+        layer.height = height;
+        layer.panelCount = (width + MLP_PANEL_WIDTH - 1) / MLP_PANEL_WIDTH;
+        layer.data.assign((size_t)layer.panelCount * panel_stride(layer), 0.0f);
+
+        const float* bias = layerBuffer + width * height;
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            float* panel = layer.data.data() + (x / MLP_PANEL_WIDTH) * panel_stride(layer) + (x % MLP_PANEL_WIDTH);
+            panel[0] = bias[x];
+            for (uint32_t l = 0; l < height; ++l)
+                panel[(l + 1) * MLP_PANEL_WIDTH] = layerBuffer[width * l + x];
+        }
+    }
+
+    void repack(CPUMLP& mlp)
+    {
+        repack_layer(mlp.mlp0Buffer.data(), mlp.mlp0Width, mlp.mlp0Height, mlp.repacked.layers[0]);
+        repack_layer(mlp.mlp1Buffer.data(), mlp.mlp1Width, mlp.mlp1Height, mlp.repacked.layers[1]);
+        repack_layer(mlp.mlp2Buffer.data(), mlp.mlp2Width, mlp.mlp2Height, mlp.repacked.layers[2]);
+    }
+}
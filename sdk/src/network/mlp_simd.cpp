@@ -0,0 +1,424 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/mlp_simd.h"
+#include "math/operators.h"
+#include "tools/cpu_features.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#if defined(CPU_X64)
+#include <immintrin.h>
+#endif
+
+namespace mlp_simd
+{
+    SIMDLevel best_simd_level()
+    {
+        const CPUFeatures& features = cpu_features();
+        if (features.avx512)
+            return SIMDLevel::AVX512;
+        if (features.avx2)
+            return SIMDLevel::AVX2;
+        return SIMDLevel::Scalar;
+    }
+
+    uint32_t scratch_size(const CPUMLP& mlp, uint32_t batchSize)
+    {
+        // Input copy, two hidden layers and the output copy (for the half variant)
+        return (mlp.mlp0Height + mlp.mlp0Width + mlp.mlp1Width + mlp.mlp2Width) * batchSize;
+    }
+
+    // Width, Height and BatchSize are compile time dimensions, 0 means they are provided at runtime
+    template<uint32_t Width, uint32_t Height, uint32_t BatchSize>
+    void evaluate_layer_scalar(const float* input, const RepackedLayer& layer, bool relu, float* output, uint32_t batchSize)
+    {
+        const uint32_t width = Width != 0 ? Width : layer.width;
+        const uint32_t height = Height != 0 ? Height : layer.height;
+        batchSize = BatchSize != 0 ? BatchSize : batchSize;
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            // Accumulate locally so the compiler doesn't have to care about aliasing
+            const float* panel = mlp::panel_column(layer, x);
+            float acc[MLP_BATCH_SIZE_MAX];
+            for (uint32_t t = 0; t < batchSize; ++t)
+                acc[t] = panel[0];
+            for (uint32_t l = 0; l < height; ++l)
+            {
+                const float weight = panel[(l + 1) * MLP_PANEL_WIDTH];
+                const float* inputRow = input + l * batchSize;
+                for (uint32_t t = 0; t < batchSize; ++t)
+                    acc[t] += inputRow[t] * weight;
+            }
+
+            float* outputRow = output + x * batchSize;
+            for (uint32_t t = 0; t < batchSize; ++t)
+                outputRow[t] = relu ? std::max(acc[t], 0.0f) : acc[t];
+        }
+    }
+
+#if defined(CPU_X64)
+    // Evaluates XT outputs for NV vectors of 8 texels, each broadcast weight stays in a register while it is applied to the whole batch
+    // The XT columns live in the same panel, the weights are read one cache line after the other
+    template<uint32_t NV, uint32_t XT, uint32_t Height>
+    TARGET_AVX2 void evaluate_tile_avx2(const float* input, const float* panel, uint32_t height, bool relu, float* output, uint32_t x)
+    {
+        height = Height != 0 ? Height : height;
+        const uint32_t batchSize = NV * 8;
+        __m256 acc[XT][NV] = {};
+        UNROLL_LOOP
+        for (uint32_t j = 0; j < XT; ++j)
+        {
+            __m256 biasV = _mm256_broadcast_ss(panel + j);
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                acc[j][v] = biasV;
+        }
+
+        for (uint32_t l = 0; l < height; ++l)
+        {
+            __m256 inputV[NV];
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                inputV[v] = _mm256_loadu_ps(input + l * batchSize + 8 * v);
+
+            const float* weightRow = panel + (l + 1) * MLP_PANEL_WIDTH;
+            UNROLL_LOOP
+            for (uint32_t j = 0; j < XT; ++j)
+            {
+                __m256 weightV = _mm256_broadcast_ss(weightRow + j);
+                UNROLL_LOOP
+                for (uint32_t v = 0; v < NV; ++v)
+                    acc[j][v] = _mm256_fmadd_ps(inputV[v], weightV, acc[j][v]);
+            }
+        }
+
+        const __m256 zero = _mm256_setzero_ps();
+        UNROLL_LOOP
+        for (uint32_t j = 0; j < XT; ++j)
+        {
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                _mm256_storeu_ps(output + (x + j) * batchSize + 8 * v, relu ? _mm256_max_ps(acc[j][v], zero) : acc[j][v]);
+        }
+    }
+
+    template<uint32_t NV, uint32_t Width, uint32_t Height>
+    TARGET_AVX2 void evaluate_layer_avx2(const float* input, const RepackedLayer& layer, bool relu, float* output)
+    {
+        const uint32_t width = Width != 0 ? Width : layer.width;
+        // Keep the accumulators within the 16 ymm registers (XT divides the panel width so a tile never straddles two panels)
+        constexpr uint32_t XT = NV == 1 ? 8 : (NV == 2 ? 4 : 2);
+        uint32_t x = 0;
+        for (; x + XT <= width; x += XT)
+            evaluate_tile_avx2<NV, XT, Height>(input, mlp::panel_column(layer, x), layer.height, relu, output, x);
+        for (; x < width; ++x)
+            evaluate_tile_avx2<NV, 1, Height>(input, mlp::panel_column(layer, x), layer.height, relu, output, x);
+    }
+
+    template<uint32_t NV, uint32_t XT, uint32_t Height>
+    TARGET_AVX512 void evaluate_tile_avx512(const float* input, const float* panel, uint32_t height, bool relu, float* output, uint32_t x)
+    {
+        height = Height != 0 ? Height : height;
+        const uint32_t batchSize = NV * 16;
+        __m512 acc[XT][NV] = {};
+        UNROLL_LOOP
+        for (uint32_t j = 0; j < XT; ++j)
+        {
+            __m512 biasV = _mm512_set1_ps(panel[j]);
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                acc[j][v] = biasV;
+        }
+
+        for (uint32_t l = 0; l < height; ++l)
+        {
+            __m512 inputV[NV];
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                inputV[v] = _mm512_loadu_ps(input + l * batchSize + 16 * v);
+
+            const float* weightRow = panel + (l + 1) * MLP_PANEL_WIDTH;
+            UNROLL_LOOP
+            for (uint32_t j = 0; j < XT; ++j)
+            {
+                __m512 weightV = _mm512_set1_ps(weightRow[j]);
+                UNROLL_LOOP
+                for (uint32_t v = 0; v < NV; ++v)
+                    acc[j][v] = _mm512_fmadd_ps(inputV[v], weightV, acc[j][v]);
+            }
+        }
+
+        // The zero masking form with a full mask is the same instruction, the unmasked intrinsic merges into an undefined register that GCC reports as uninitialized
+        const __m512 zero = _mm512_setzero_ps();
+        UNROLL_LOOP
+        for (uint32_t j = 0; j < XT; ++j)
+        {
+            UNROLL_LOOP
+            for (uint32_t v = 0; v < NV; ++v)
+                _mm512_storeu_ps(output + (x + j) * batchSize + 16 * v, relu ? _mm512_maskz_max_ps(0xFFFF, acc[j][v], zero) : acc[j][v]);
+        }
+    }
+
+    template<uint32_t NV, uint32_t Width, uint32_t Height>
+    TARGET_AVX512 void evaluate_layer_avx512(const float* input, const RepackedLayer& layer, bool relu, float* output)
+    {
+        const uint32_t width = Width != 0 ? Width : layer.width;
+        // 16 accumulators out of the 32 zmm registers
+        constexpr uint32_t XT = NV == 1 ? 16 : 8;
+        uint32_t x = 0;
+        for (; x + XT <= width; x += XT)
+            evaluate_tile_avx512<NV, XT, Height>(input, mlp::panel_column(layer, x), layer.height, relu, output, x);
+        for (; x < width; ++x)
+            evaluate_tile_avx512<NV, 1, Height>(input, mlp::panel_column(layer, x), layer.height, relu, output, x);
+    }
+
+    TARGET_AVX2 void convert_to_float_f16c(const float16_t* input, float* output, uint32_t count)
+    {
+        uint32_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(output + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(input + i))));
+        for (; i < count; ++i)
+            output[i] = to_float(input[i]);
+    }
+
+    TARGET_AVX2 void convert_to_half_f16c(const float* input, float16_t* output, uint32_t count)
+    {
+        uint32_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm_storeu_si128((__m128i*)(output + i), _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT));
+        for (; i < count; ++i)
+            output[i] = to_half(input[i]);
+    }
+#endif
+
+    template<uint32_t Width, uint32_t Height, uint32_t BatchSize>
+    void evaluate_layer(const float* input, const RepackedLayer& layer, bool relu, float* output, uint32_t batchSize, SIMDLevel level)
+    {
+#if defined(CPU_X64)
+        // Batches of 8 texels don't fill a zmm register
+        if (level == SIMDLevel::AVX512 && batchSize >= 16)
+        {
+            if (batchSize == 16)
+                return evaluate_layer_avx512<1, Width, Height>(input, layer, relu, output);
+            return evaluate_layer_avx512<2, Width, Height>(input, layer, relu, output);
+        }
+        if (level != SIMDLevel::Scalar)
+        {
+            if (batchSize == 8)
+                return evaluate_layer_avx2<1, Width, Height>(input, layer, relu, output);
+            if (batchSize == 16)
+                return evaluate_layer_avx2<2, Width, Height>(input, layer, relu, output);
+            return evaluate_layer_avx2<4, Width, Height>(input, layer, relu, output);
+        }
+#endif
+        evaluate_layer_scalar<Width, Height, BatchSize>(input, layer, relu, output, batchSize);
+    }
+
+    void evaluate_batch_generic(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+    {
+        assert_msg(batchSize == 8 || batchSize == 16 || batchSize == 32, "Unsupported MLP batch size\n");
+        assert_msg(mlp.repacked.layers[2].width == mlp.mlp2Width, "The MLP needs to be repacked\n");
+        const RepackedLayer* layers = mlp.repacked.layers;
+        float* pongMemoryA = scratch + mlp.mlp0Height * batchSize;
+        float* pongMemoryB = pongMemoryA + mlp.mlp0Width * batchSize;
+        evaluate_layer<0, 0, 0>(input, layers[0], true, pongMemoryA, batchSize, level);
+        evaluate_layer<0, 0, 0>(pongMemoryA, layers[1], true, pongMemoryB, batchSize, level);
+        evaluate_layer<0, 0, 0>(pongMemoryB, layers[2], false, output, batchSize, level);
+    }
+
+    void evaluate_layer_channels(const float* input, const RepackedLayer& layer, uint32_t channelMask, float* output, uint32_t batchSize, SIMDLevel level)
+    {
+        // Each selected column is a single column tile, the others are never read.
+        // The mask only has 32 bits, channels past that are always selected (matches the decoder's guard)
+        uint32_t outputIdx = 0;
+        for (uint32_t x = 0; x < layer.width; ++x)
+        {
+            if (x < 32 && (channelMask & (1u << x)) == 0)
+                continue;
+            const float* panel = mlp::panel_column(layer, x);
+            float* outputRow = output + (outputIdx++) * batchSize;
+#if defined(CPU_X64)
+            if (level == SIMDLevel::AVX512 && batchSize >= 16)
+            {
+                if (batchSize == 16)
+                    evaluate_tile_avx512<1, 1, 0>(input, panel, layer.height, false, outputRow, 0);
+                else
+                    evaluate_tile_avx512<2, 1, 0>(input, panel, layer.height, false, outputRow, 0);
+                continue;
+            }
+            if (level != SIMDLevel::Scalar)
+            {
+                if (batchSize == 8)
+                    evaluate_tile_avx2<1, 1, 0>(input, panel, layer.height, false, outputRow, 0);
+                else if (batchSize == 16)
+                    evaluate_tile_avx2<2, 1, 0>(input, panel, layer.height, false, outputRow, 0);
+                else
+                    evaluate_tile_avx2<4, 1, 0>(input, panel, layer.height, false, outputRow, 0);
+                continue;
+            }
+#endif
+            for (uint32_t t = 0; t < batchSize; ++t)
+                outputRow[t] = panel[0];
+            for (uint32_t l = 0; l < layer.height; ++l)
+            {
+                const float weight = panel[(l + 1) * MLP_PANEL_WIDTH];
+                const float* inputRow = input + l * batchSize;
+                for (uint32_t t = 0; t < batchSize; ++t)
+                    outputRow[t] += inputRow[t] * weight;
+            }
+        }
+    }
+
+    void evaluate_batch_channels(const CPUMLP& mlp, uint32_t channelMask, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+    {
+        assert_msg(batchSize == 8 || batchSize == 16 || batchSize == 32, "Unsupported MLP batch size\n");
+        assert_msg(mlp.repacked.layers[2].width == mlp.mlp2Width, "The MLP needs to be repacked\n");
+        const RepackedLayer* layers = mlp.repacked.layers;
+        float* pongMemoryA = scratch + mlp.mlp0Height * batchSize;
+        float* pongMemoryB = pongMemoryA + mlp.mlp0Width * batchSize;
+        evaluate_layer<0, 0, 0>(input, layers[0], true, pongMemoryA, batchSize, level);
+        evaluate_layer<0, 0, 0>(pongMemoryA, layers[1], true, pongMemoryB, batchSize, level);
+        evaluate_layer_channels(pongMemoryB, layers[2], channelMask, output, batchSize, level);
+    }
+
+    void evaluate_hidden_batch(const CPUMLP& mlp, const float* hidden, float* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+    {
+        assert_msg(batchSize == 8 || batchSize == 16 || batchSize == 32, "Unsupported MLP batch size\n");
+        assert_msg(mlp.repacked.layers[2].width == mlp.mlp2Width, "The MLP needs to be repacked\n");
+        const RepackedLayer* layers = mlp.repacked.layers;
+        evaluate_layer<0, 0, 0>(hidden, layers[1], true, scratch, batchSize, level);
+        evaluate_layer<0, 0, 0>(scratch, layers[2], false, output, batchSize, level);
+    }
+}
+
+template<uint32_t In, uint32_t H0, uint32_t H1, uint32_t Out>
+template<uint32_t BatchSize>
+void MLPKernel<In, H0, H1, Out>::evaluate(const CPUMLP& mlp, const float* input, float* output, float* scratch, SIMDLevel level)
+{
+    assert_msg(mlp.repacked.layers[2].width == Out, "The MLP needs to be repacked\n");
+    const RepackedLayer* layers = mlp.repacked.layers;
+    float* pongMemoryA = scratch + In * BatchSize;
+    float* pongMemoryB = pongMemoryA + H0 * BatchSize;
+    mlp_simd::evaluate_layer<H0, In, BatchSize>(input, layers[0], true, pongMemoryA, BatchSize, level);
+    mlp_simd::evaluate_layer<H1, H0, BatchSize>(pongMemoryA, layers[1], true, pongMemoryB, BatchSize, level);
+    mlp_simd::evaluate_layer<Out, H1, BatchSize>(pongMemoryB, layers[2], false, output, BatchSize, level);
+}
+
+template<uint32_t In, uint32_t H0, uint32_t H1, uint32_t Out>
+void MLPKernel<In, H0, H1, Out>::evaluate_batch(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+{
+    switch (batchSize)
+    {
+        case 8:
+            evaluate<8>(mlp, input, output, scratch, level);
+            break;
+        case 16:
+            evaluate<16>(mlp, input, output, scratch, level);
+            break;
+        case 32:
+            evaluate<32>(mlp, input, output, scratch, level);
+            break;
+        default:
+            assert_fail_msg("Unsupported MLP batch size\n");
+            break;
+    }
+}
+
+namespace mlp_simd
+{
+    // Shapes that have a specialized kernel
+    struct MLPKernelEntry
+    {
+        uint32_t inDim;
+        uint32_t hidden0Dim;
+        uint32_t hidden1Dim;
+        uint32_t outDim;
+        MLPKernelFunction function;
+    };
+
+    #define MLP_KERNEL_ENTRY(IN, H0, H1, OUT) { IN, H0, H1, OUT, &MLPKernel<IN, H0, H1, OUT>::evaluate_batch }
+    static const MLPKernelEntry g_KernelTable[] =
+    {
+        MLP_KERNEL_ENTRY(16, 16, 16, 16),
+        MLP_KERNEL_ENTRY(16, 16, 32, 16),
+        MLP_KERNEL_ENTRY(16, 16, 48, 16),
+        MLP_KERNEL_ENTRY(16, 16, 64, 16),
+        MLP_KERNEL_ENTRY(16, 32, 16, 16),
+        MLP_KERNEL_ENTRY(16, 32, 32, 16),
+        MLP_KERNEL_ENTRY(16, 32, 48, 16),
+        MLP_KERNEL_ENTRY(16, 32, 64, 16),
+        MLP_KERNEL_ENTRY(16, 48, 16, 16),
+        MLP_KERNEL_ENTRY(16, 48, 32, 16),
+        MLP_KERNEL_ENTRY(16, 48, 48, 16),
+        MLP_KERNEL_ENTRY(16, 48, 64, 16),
+        MLP_KERNEL_ENTRY(16, 64, 16, 16),
+        MLP_KERNEL_ENTRY(16, 64, 32, 16),
+        MLP_KERNEL_ENTRY(16, 64, 48, 16),
+        MLP_KERNEL_ENTRY(16, 64, 64, 16),
+    };
+    #undef MLP_KERNEL_ENTRY
+
+    MLPKernelFunction find_kernel(const CPUMLP& mlp)
+    {
+        // The layers need to be chained for the shape to be valid
+        if (mlp.mlp1Height != mlp.mlp0Width || mlp.mlp2Height != mlp.mlp1Width)
+            return nullptr;
+
+        for (const MLPKernelEntry& entry : g_KernelTable)
+        {
+            if (entry.inDim == mlp.mlp0Height && entry.hidden0Dim == mlp.mlp0Width && entry.hidden1Dim == mlp.mlp1Width && entry.outDim == mlp.mlp2Width)
+                return entry.function;
+        }
+        return nullptr;
+    }
+
+    MLPKernelFunction select_kernel(const CPUMLP& mlp)
+    {
+        MLPKernelFunction kernel = find_kernel(mlp);
+        return kernel != nullptr ? kernel : evaluate_batch_generic;
+    }
+
+    void evaluate_batch(const CPUMLP& mlp, const float* input, float* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+    {
+        select_kernel(mlp)(mlp, input, output, scratch, batchSize, level);
+    }
+
+    void evaluate_batch(const CPUMLP& mlp, const float16_t* input, float16_t* output, float* scratch, uint32_t batchSize, SIMDLevel level)
+    {
+        // Convert the input to the beginning of the scratch memory
+        const uint32_t inputCount = mlp.mlp0Height * batchSize;
+        const uint32_t outputCount = mlp.mlp2Width * batchSize;
+        float* inputFloat = scratch;
+        float* outputFloat = scratch + (mlp.mlp0Height + mlp.mlp0Width + mlp.mlp1Width) * batchSize;
+#if defined(CPU_X64)
+        if (level != SIMDLevel::Scalar)
+            convert_to_float_f16c(input, inputFloat, inputCount);
+        else
+#endif
+        {
+            for (uint32_t i = 0; i < inputCount; ++i)
+                inputFloat[i] = to_float(input[i]);
+        }
+
+        // Evaluate in fp32
+        evaluate_batch(mlp, inputFloat, outputFloat, scratch, batchSize, level);
+
+        // Convert the output back
+#if defined(CPU_X64)
+        if (level != SIMDLevel::Scalar)
+            convert_to_half_f16c(outputFloat, output, outputCount);
+        else
+#endif
+        {
+            for (uint32_t i = 0; i < outputCount; ++i)
+                output[i] = to_half(outputFloat[i]);
+        }
+    }
+}
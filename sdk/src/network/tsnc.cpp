@@ -11,12 +11,17 @@
 #include "math/operators.h"
 
 #include "tools/directory_utilities.h"
-#include "tools/gpu_helpers.h"
 #include "tools/security.h"
 #include "tools/shader_utils.h"
 #include "tools/stream.h"
 #include "tools/texture_utils.h"
 
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <string.h>
+#include <thread>
+
 TSNC::TSNC()
 {
 }
@@ -25,11 +30,12 @@ TSNC::~TSNC()
 {
 }
 
-void TSNC::initialize(GraphicsDevice device, bool cvs)
+void TSNC::initialize(GraphicsDevice device, bool cvs, bool featureTextures)
 {
     // Keep track of the device
     m_Device = device;
     m_CVS = cvs;
+    m_FeatureTextures = featureTextures;
 }
 
 void TSNC::release()
@@ -40,6 +46,16 @@ void TSNC::release()
     graphics::resources::destroy_texture(m_Nwk.tex2);
     graphics::resources::destroy_texture(m_Nwk.tex3);
     graphics::resources::destroy_graphics_buffer(m_UVOffsetBuffer);
+
+    // Feature textures
+    if (m_FeatureTextures)
+    {
+        graphics::resources::destroy_texture(m_Nwk.feature0);
+        graphics::resources::destroy_texture(m_Nwk.feature1);
+        graphics::resources::destroy_texture(m_Nwk.feature2);
+        graphics::resources::destroy_texture(m_Nwk.feature3);
+        graphics::resources::destroy_graphics_buffer(m_Nwk.featureLayer0Buffer);
+    }
     
     // MLP
     mlp::destroy_gpu_mlp(m_Nwk.mlp);
@@ -48,37 +64,102 @@ void TSNC::release()
     graphics::compute_shader::destroy_compute_shader(m_FP32toFP16CS);
 }
 
-void TSNC::reload_network(const std::string& modelDir, uint32_t numSets)
+void TSNC::reload_network(const std::string& modelPath, uint32_t numSets)
+{
+    load_cpu_network(modelPath, numSets, 0);
+    create_gpu_network();
+}
+
+std::future<void> TSNC::reload_network_async(const std::string& modelPath, uint32_t numSets, uint32_t numThreads)
+{
+    return std::async(std::launch::async, [this, modelPath, numSets, numThreads]() { load_cpu_network(modelPath, numSets, numThreads); });
+}
+
+void TSNC::finish_reload_network()
 {
-    // Load the bc1 textures
+    create_gpu_network();
+}
+
+void TSNC::load_cpu_network(const std::string& modelPath, uint32_t numSets, uint32_t numThreads)
+{
+    // A container holds every set in a single mapping, only the MLP adjustments are left
+    const bool container = tsnc_container::is_container(modelPath);
+    if (container)
+    {
+        ContainerHeader header;
+        assert_msg(tsnc_container::load(modelPath.c_str(), m_MLPArray, m_LatentArray, header), "Invalid container\n");
+        m_Metadata = header.metadata;
+        numSets = header.numSets;
+    }
+    else
+    {
+        m_MLPArray.resize(numSets);
+        m_LatentArray.resize(4 * numSets);
+    }
     m_NumSets = numSets;
-    m_TexData.resize(4 * numSets);
-    m_UVOffset.resize(4 * numSets);
-    m_MLPArray.resize(numSets);
 
-    // Copy all the sets
-    for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+    // One task per file (the MLP then the four latent textures of each set), distributed dynamically across the threads
+    const uint32_t taskCount = 5 * numSets;
+    std::atomic<uint32_t> nextTask(0);
+    auto load_files = [&]()
     {
-        // Read the file to a buffer
-        std::vector<char> mlpBuffer;
-        load_file_to_array((modelDir + "\\mlp_" + std::to_string(setIdx) +".bin").c_str(), mlpBuffer);
-
-        // Unpack the MLP and adjust
-        const char* rawData = (const char*)mlpBuffer.data();
-        unpack_type(rawData, m_MLPArray[setIdx]);
-        mlp::align_dimensions(m_MLPArray[setIdx]);
-
-        // Load the textures
-        m_TexData[4 * setIdx + 0].texBuffer = load_bc1_to_graphics_buffer(m_Device, (modelDir + "\\tex0_" + std::to_string(setIdx) + ".bc1").c_str(), m_TexData[4 * setIdx + 0].texSize, m_UVOffset[4 * setIdx + 0]);
-        m_TexData[4 * setIdx + 1].texBuffer = load_bc1_to_graphics_buffer(m_Device, (modelDir + "\\tex1_" + std::to_string(setIdx) + ".bc1").c_str(), m_TexData[4 * setIdx + 1].texSize, m_UVOffset[4 * setIdx + 1]);
-        m_TexData[4 * setIdx + 2].texBuffer = load_bc1_to_graphics_buffer(m_Device, (modelDir + "\\tex2_" + std::to_string(setIdx) + ".bc1").c_str(), m_TexData[4 * setIdx + 2].texSize, m_UVOffset[4 * setIdx + 2]);
-        m_TexData[4 * setIdx + 3].texBuffer = load_bc1_to_graphics_buffer(m_Device, (modelDir + "\\tex3_" + std::to_string(setIdx) + ".bc1").c_str(), m_TexData[4 * setIdx + 3].texSize, m_UVOffset[4 * setIdx + 3]);
+        for (uint32_t taskIdx = nextTask++; taskIdx < taskCount; taskIdx = nextTask++)
+        {
+            const uint32_t setIdx = taskIdx / 5;
+            const uint32_t fileIdx = taskIdx % 5;
+            if (fileIdx == 0)
+            {
+                // Read the MLP in place and adjust
+                if (!container)
+                    mlp::load_file((modelPath + "\\mlp_" + std::to_string(setIdx) + ".bin").c_str(), m_MLPArray[setIdx]);
+                mlp::align_dimensions(m_MLPArray[setIdx]);
+                mlp::repack(m_MLPArray[setIdx]);
+            }
+            else if (!container)
+            {
+                const uint32_t texIdx = fileIdx - 1;
+                latent_space::load_bc1((modelPath + "\\tex" + std::to_string(texIdx) + "_" + std::to_string(setIdx) + ".bc1").c_str(), m_LatentArray[4 * setIdx + texIdx]);
+            }
+        }
+    };
+
+    // Fan out on all the cores, the reads are mostly waiting on the storage
+    uint32_t threadCount = numThreads != 0 ? numThreads : std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = std::min(threadCount, taskCount);
+    std::vector<std::thread> workers;
+    for (uint32_t threadIdx = 1; threadIdx < threadCount; ++threadIdx)
+        workers.emplace_back(load_files);
+    load_files();
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // The directory layout derives the shader defines from the network, the container stores them
+    ContainerMetadata networkMetadata;
+    tsnc_container::build_metadata(m_MLPArray[0], m_LatentArray[0], networkMetadata);
+    if (!container)
+        m_Metadata = networkMetadata;
+    assert_msg(memcmp(&m_Metadata, &networkMetadata, sizeof(ContainerMetadata)) == 0, "Container metadata doesn't match the network\n");
+}
+
+void TSNC::create_gpu_network()
+{
+    // Create the upload buffers straight from the mapped files
+    m_TexData.resize(4 * m_NumSets);
+    m_UVOffset.resize(4 * m_NumSets);
+    for (uint32_t texIdx = 0; texIdx < 4 * m_NumSets; ++texIdx)
+    {
+        const CPULatentTexture& latentTex = m_LatentArray[texIdx];
+        LSTextureData& texData = m_TexData[texIdx];
+        texData.texSize = { latentTex.width, latentTex.height, latentTex.mipCount };
+        texData.texBuffer = graphics::resources::create_graphics_buffer(m_Device, latentTex.data.size(), 4, GraphicsBufferType::Upload);
+        graphics::resources::set_buffer_data(texData.texBuffer, (const char*)latentTex.data.data(), latentTex.data.size());
+        m_UVOffset[texIdx] = latentTex.uvOffset;
     }
 
     // Create our Latent space runtime textures
     TextureDescriptor texDesc;
     texDesc.type = TextureType::Tex2DArray;
-    texDesc.depth = numSets;
+    texDesc.depth = m_NumSets;
     texDesc.format = TextureFormat::BC1_RGB;
     texDesc.isUAV = false;
 
@@ -103,78 +184,107 @@ void TSNC::reload_network(const std::string& modelDir, uint32_t numSets)
     m_Nwk.tex3 = graphics::resources::create_texture(m_Device, texDesc);
 
     // Allocate the MLP n the GPU
-    mlp::allocate_gpu_mlp_array(m_Device, m_MLPArray, m_Nwk.mlp);
+    mlp::allocate_gpu_mlp_array(m_Device, m_MLPArray, m_CVS, m_Nwk.mlp);
+
+    // Bake the first layer in the feature textures
+    if (m_FeatureTextures)
+    {
+        feature_textures::bake_network(m_MLPArray, m_LatentArray, m_FeatureArray);
+
+        // 4 features per slice, the slices of all the sets are stacked
+        const uint32_t featureCount = m_MLPArray[0].mlp0Width;
+        texDesc.depth = m_NumSets * featureCount / 4;
+        texDesc.format = TextureFormat::R16G16B16A16_Float;
+
+        texDesc.width = m_FeatureArray[0].width;
+        texDesc.height = m_FeatureArray[0].height;
+        texDesc.mipCount = m_FeatureArray[0].mipCount;
+        m_Nwk.feature0 = graphics::resources::create_texture(m_Device, texDesc);
+
+        texDesc.width = m_FeatureArray[1].width;
+        texDesc.height = m_FeatureArray[1].height;
+        texDesc.mipCount = m_FeatureArray[1].mipCount;
+        m_Nwk.feature1 = graphics::resources::create_texture(m_Device, texDesc);
+
+        texDesc.width = m_FeatureArray[2].width;
+        texDesc.height = m_FeatureArray[2].height;
+        texDesc.mipCount = m_FeatureArray[2].mipCount;
+        m_Nwk.feature2 = graphics::resources::create_texture(m_Device, texDesc);
+
+        texDesc.width = m_FeatureArray[3].width;
+        texDesc.height = m_FeatureArray[3].height;
+        texDesc.mipCount = m_FeatureArray[3].mipCount;
+        m_Nwk.feature3 = graphics::resources::create_texture(m_Device, texDesc);
+
+        // LOD weights and bias of the first layer
+        m_Nwk.featureLayer0Buffer = graphics::resources::create_graphics_buffer(m_Device, 2 * featureCount * sizeof(float16_t) * m_NumSets, sizeof(float16_t), GraphicsBufferType::Default);
+    }
 
     // Set the defines
-    std::string mip0resText = std::string("MIP0_RES ") + std::to_string(m_TexData[0].texSize.x);
+    std::string mip0resText = std::string("MIP0_RES ") + std::to_string(m_Metadata.mip0Resolution);
     m_ShaderDefines.push_back(mip0resText.c_str());
     m_ShaderDefines.push_back("NUM_MIPS 4");
 
-    const CPUMLP& cpuMLP = m_MLPArray[0];
-    m_ShaderDefines.push_back(std::string("MLP0_IN_DIM ") + std::to_string(cpuMLP.mlp0Height));
-    m_ShaderDefines.push_back(std::string("MLP0_OUT_DIM ") + std::to_string(cpuMLP.mlp0Width));
-    m_ShaderDefines.push_back(std::string("MLP1_OUT_DIM ") + std::to_string(cpuMLP.mlp1Width));
-    m_ShaderDefines.push_back(std::string("MLP2_OUT_DIM ") + std::to_string(cpuMLP.mlp2Width));
+    m_ShaderDefines.push_back(std::string("MLP0_IN_DIM ") + std::to_string(m_Metadata.mlp0InDim));
+    m_ShaderDefines.push_back(std::string("MLP0_OUT_DIM ") + std::to_string(m_Metadata.mlp0OutDim));
+    m_ShaderDefines.push_back(std::string("MLP1_OUT_DIM ") + std::to_string(m_Metadata.mlp1OutDim));
+    m_ShaderDefines.push_back(std::string("MLP2_OUT_DIM ") + std::to_string(m_Metadata.mlp2OutDim));
+    if ((MLPWeightFormat)m_Metadata.weightFormat == MLPWeightFormat::Int8)
+        m_ShaderDefines.push_back("MLP_INT8_WEIGHTS");
+    if (m_FeatureTextures)
+        m_ShaderDefines.push_back("MLP_FEATURE_TEXTURES");
 
     // Offset buffer
     m_UVOffsetBuffer = graphics::resources::create_graphics_buffer(m_Device, m_UVOffset.size() * sizeof(float2), sizeof(float2), GraphicsBufferType::Default);
-    m_TextureSize = { m_TexData[0].texSize.x, m_TexData[0].texSize.y, cpuMLP.finalChannelCount };
+    m_TextureSize = { m_TexData[0].texSize.x, m_TexData[0].texSize.y, m_Metadata.finalChannelCount };
 }
 
-void TSNC::upload_network(CommandQueue cmdQ, CommandBuffer cmdB)
+void TSNC::upload_network(UploadManager& uploadManager)
 {
-    GraphicsBuffer offsetBufferUp = graphics::resources::create_graphics_buffer(m_Device, m_UVOffset.size() * sizeof(float2), sizeof(float2), GraphicsBufferType::Upload);
-    graphics::resources::set_buffer_data(offsetBufferUp, (const char*)m_UVOffset.data(), m_UVOffset.size() * sizeof(float2));
-    
-    // Upload all the data
-    {
-        graphics::command_buffer::reset(cmdB);
+    // Copy the offsets
+    uploadManager.upload_buffer((const char*)m_UVOffset.data(), m_UVOffset.size() * sizeof(float2), m_UVOffsetBuffer);
 
-        // Copy the offsets
-        graphics::command_buffer::copy_graphics_buffer(cmdB, offsetBufferUp, m_UVOffsetBuffer);
-
-        // Copy all the mips
-        for (uint32_t setIdx = 0; setIdx < m_NumSets; ++setIdx)
+    // Copy all the mips, the manager releases the upload buffers once they are consumed
+    const Texture latentTextures[4] = { m_Nwk.tex0, m_Nwk.tex1, m_Nwk.tex2, m_Nwk.tex3 };
+    for (uint32_t setIdx = 0; setIdx < m_NumSets; ++setIdx)
+    {
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
         {
-            graphics::command_buffer::copy_buffer_into_texture_mips(cmdB, m_TexData[4 * setIdx + 0].texBuffer, 0, (m_TexData[4 * setIdx + 0].texSize.x / 4) * (m_TexData[4 * setIdx + 0].texSize.y / 4) * 8, m_Nwk.tex0, setIdx);
-            graphics::command_buffer::copy_buffer_into_texture_mips(cmdB, m_TexData[4 * setIdx + 1].texBuffer, 0, (m_TexData[4 * setIdx + 1].texSize.x / 4) * (m_TexData[4 * setIdx + 1].texSize.y / 4) * 8, m_Nwk.tex1, setIdx);
-            graphics::command_buffer::copy_buffer_into_texture_mips(cmdB, m_TexData[4 * setIdx + 2].texBuffer, 0, (m_TexData[4 * setIdx + 2].texSize.x / 4) * (m_TexData[4 * setIdx + 2].texSize.y / 4) * 8, m_Nwk.tex2, setIdx);
-            graphics::command_buffer::copy_buffer_into_texture_mips(cmdB, m_TexData[4 * setIdx + 3].texBuffer, 0, (m_TexData[4 * setIdx + 3].texSize.x / 4) * (m_TexData[4 * setIdx + 3].texSize.y / 4) * 8, m_Nwk.tex3, setIdx);
+            LSTextureData& texData = m_TexData[4 * setIdx + texIdx];
+            uploadManager.upload_texture_mips(texData.texBuffer, (texData.texSize.x / 4) * (texData.texSize.y / 4) * 8, latentTextures[texIdx], setIdx);
+            texData.texBuffer = 0;
         }
-
-        graphics::command_buffer::close(cmdB);
-        graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-        graphics::command_queue::flush(cmdQ);
     }
 
-    // Release the temporary buffers
-    graphics::resources::destroy_graphics_buffer(offsetBufferUp);
-    for (uint32_t setIdx = 0; setIdx < m_NumSets; ++setIdx)
-    {
-        graphics::resources::destroy_graphics_buffer(m_TexData[4 * setIdx + 0].texBuffer);
-        graphics::resources::destroy_graphics_buffer(m_TexData[4 * setIdx + 1].texBuffer);
-        graphics::resources::destroy_graphics_buffer(m_TexData[4 * setIdx + 2].texBuffer);
-        graphics::resources::destroy_graphics_buffer(m_TexData[4 * setIdx + 3].texBuffer);
-        m_TexData[4 * setIdx + 0].texBuffer = 0;
-        m_TexData[4 * setIdx + 1].texBuffer = 0;
-        m_TexData[4 * setIdx + 2].texBuffer = 0;
-        m_TexData[4 * setIdx + 3].texBuffer = 0;
-    }
+    // Upload the feature textures
+    if (m_FeatureTextures)
+        upload_feature_textures(uploadManager);
 
     {
         // For each buffer, let's concat all the mlps*
         std::vector<float> mlpWeight0, mlpWeight1, mlpWeight2;
         std::vector<float> mlpBias0, mlpBias1, mlpBias2;
+        std::vector<char> mlpInt8Weight0, mlpInt8Weight1, mlpInt8Weight2;
+        const bool int8Weights = m_MLPArray[0].weightFormat == MLPWeightFormat::Int8;
         for (uint32_t setIdx = 0; setIdx < m_NumSets; ++setIdx)
         {
             const CPUMLP& cpuMLP = m_MLPArray[setIdx];
             if (m_CVS)
             {
-                mlp::upload_and_convert_matrices(m_Device, cmdQ, cmdB, (char*)cpuMLP.mlp0Buffer.data(), cpuMLP.mlp0Width, cpuMLP.mlp0Height, m_Nwk.mlp.weight0Buffer, m_Nwk.mlp.weight0OptimalBuffer, setIdx * cpuMLP.mlp0Width * cpuMLP.mlp0Height * sizeof(float16_t));
-                mlp::upload_and_convert_matrices(m_Device, cmdQ, cmdB, (char*)cpuMLP.mlp1Buffer.data(), cpuMLP.mlp1Width, cpuMLP.mlp1Height, m_Nwk.mlp.weight1Buffer, m_Nwk.mlp.weight1OptimalBuffer, setIdx * cpuMLP.mlp1Width * cpuMLP.mlp1Height * sizeof(float16_t));
-                mlp::upload_and_convert_matrices(m_Device, cmdQ, cmdB, (char*)cpuMLP.mlp2Buffer.data(), cpuMLP.mlp2Width, cpuMLP.mlp2Height, m_Nwk.mlp.weight2Buffer, m_Nwk.mlp.weight2OptimalBuffer, setIdx * cpuMLP.mlp2Width * cpuMLP.mlp2Height * sizeof(float16_t));
+                // Cooperative vectors consume the fp16 optimal layout, int8 weights only go to the main buffers
+                uploadManager.convert_and_upload_matrix((char*)cpuMLP.mlp0Buffer.data(), cpuMLP.mlp0Width, cpuMLP.mlp0Height, int8Weights ? 0 : m_Nwk.mlp.weight0Buffer, m_Nwk.mlp.weight0OptimalBuffer, setIdx * cpuMLP.mlp0Width * cpuMLP.mlp0Height * sizeof(float16_t));
+                uploadManager.convert_and_upload_matrix((char*)cpuMLP.mlp1Buffer.data(), cpuMLP.mlp1Width, cpuMLP.mlp1Height, int8Weights ? 0 : m_Nwk.mlp.weight1Buffer, m_Nwk.mlp.weight1OptimalBuffer, setIdx * cpuMLP.mlp1Width * cpuMLP.mlp1Height * sizeof(float16_t));
+                uploadManager.convert_and_upload_matrix((char*)cpuMLP.mlp2Buffer.data(), cpuMLP.mlp2Width, cpuMLP.mlp2Height, int8Weights ? 0 : m_Nwk.mlp.weight2Buffer, m_Nwk.mlp.weight2OptimalBuffer, setIdx * cpuMLP.mlp2Width * cpuMLP.mlp2Height * sizeof(float16_t));
             }
-            else
+
+            if (int8Weights)
+            {
+                // Concatenate the int8 layers
+                mlp::pack_int8_layer(mlpInt8Weight0, cpuMLP.mlp0Int8, cpuMLP.mlp0Width, cpuMLP.mlp0Height);
+                mlp::pack_int8_layer(mlpInt8Weight1, cpuMLP.mlp1Int8, cpuMLP.mlp1Width, cpuMLP.mlp1Height);
+                mlp::pack_int8_layer(mlpInt8Weight2, cpuMLP.mlp2Int8, cpuMLP.mlp2Width, cpuMLP.mlp2Height);
+            }
+            else if (!m_CVS)
             {
                 // Concatenate the bias buffers
                 mlpWeight0.insert(mlpWeight0.end(), cpuMLP.mlp0Buffer.begin(), cpuMLP.mlp0Buffer.begin() + cpuMLP.mlp0Width * cpuMLP.mlp0Height);
@@ -189,18 +299,69 @@ void TSNC::upload_network(CommandQueue cmdQ, CommandBuffer cmdB)
         }
 
         // Weight buffers
-        if (!m_CVS)
+        if (int8Weights)
+        {
+            uploadManager.upload_buffer(mlpInt8Weight0.data(), mlpInt8Weight0.size(), m_Nwk.mlp.weight0Buffer);
+            uploadManager.upload_buffer(mlpInt8Weight1.data(), mlpInt8Weight1.size(), m_Nwk.mlp.weight1Buffer);
+            uploadManager.upload_buffer(mlpInt8Weight2.data(), mlpInt8Weight2.size(), m_Nwk.mlp.weight2Buffer);
+        }
+        else if (!m_CVS)
         {
-            sync_convert_and_upload_buffer_to_gpu(m_Device, cmdQ, cmdB, m_FP32toFP16CS, (char*)mlpWeight0.data(), mlpWeight0.size() * sizeof(float), sizeof(float), m_Nwk.mlp.weight0Buffer);
-            sync_convert_and_upload_buffer_to_gpu(m_Device, cmdQ, cmdB, m_FP32toFP16CS, (char*)mlpWeight1.data(), mlpWeight1.size() * sizeof(float), sizeof(float), m_Nwk.mlp.weight1Buffer);
-            sync_convert_and_upload_buffer_to_gpu(m_Device, cmdQ, cmdB, m_FP32toFP16CS, (char*)mlpWeight2.data(), mlpWeight2.size() * sizeof(float), sizeof(float), m_Nwk.mlp.weight2Buffer);
+            uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)mlpWeight0.data(), mlpWeight0.size() * sizeof(float), sizeof(float), m_Nwk.mlp.weight0Buffer);
+            uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)mlpWeight1.data(), mlpWeight1.size() * sizeof(float), sizeof(float), m_Nwk.mlp.weight1Buffer);
+            uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)mlpWeight2.data(), mlpWeight2.size() * sizeof(float), sizeof(float), m_Nwk.mlp.weight2Buffer);
         }
 
         // Bias buffers
-        sync_convert_and_upload_buffer_to_gpu(m_Device, cmdQ, cmdB, m_FP32toFP16CS, (char*)mlpBias0.data(), mlpBias0.size() * sizeof(float), sizeof(float), m_Nwk.mlp.bias0Buffer);
-        sync_convert_and_upload_buffer_to_gpu(m_Device, cmdQ, cmdB, m_FP32toFP16CS, (char*)mlpBias1.data(), mlpBias1.size() * sizeof(float), sizeof(float), m_Nwk.mlp.bias1Buffer);
-        sync_convert_and_upload_buffer_to_gpu(m_Device, cmdQ, cmdB, m_FP32toFP16CS, (char*)mlpBias2.data(), mlpBias2.size() * sizeof(float), sizeof(float), m_Nwk.mlp.bias2Buffer);
+        uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)mlpBias0.data(), mlpBias0.size() * sizeof(float), sizeof(float), m_Nwk.mlp.bias0Buffer);
+        uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)mlpBias1.data(), mlpBias1.size() * sizeof(float), sizeof(float), m_Nwk.mlp.bias1Buffer);
+        uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)mlpBias2.data(), mlpBias2.size() * sizeof(float), sizeof(float), m_Nwk.mlp.bias2Buffer);
+    }
+}
+
+void TSNC::upload_feature_textures(UploadManager& uploadManager)
+{
+    const uint32_t featureCount = m_MLPArray[0].mlp0Width;
+    const uint32_t sliceCount = featureCount / 4;
+    const Texture featureTextures[4] = { m_Nwk.feature0, m_Nwk.feature1, m_Nwk.feature2, m_Nwk.feature3 };
+
+    // Split the features in slices of 4 channels ([set][slice][mip][y][x][4])
+    for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+    {
+        const CPUFeatureTexture& refTex = m_FeatureArray[texIdx];
+        const uint64_t texelCount = feature_textures::mip_offset(refTex, refTex.mipCount) / featureCount;
+        std::vector<float16_t> sliceData(texelCount * 4 * sliceCount * m_NumSets);
+        float16_t* target = sliceData.data();
+        for (uint32_t setIdx = 0; setIdx < m_NumSets; ++setIdx)
+        {
+            const CPUFeatureTexture& featureTex = m_FeatureArray[4 * setIdx + texIdx];
+            for (uint32_t sliceIdx = 0; sliceIdx < sliceCount; ++sliceIdx)
+            {
+                for (uint64_t texelIdx = 0; texelIdx < texelCount; ++texelIdx)
+                {
+                    const float16_t* source = featureTex.data.data() + texelIdx * featureCount + 4 * sliceIdx;
+                    for (uint32_t c = 0; c < 4; ++c)
+                        *(target++) = source[c];
+                }
+            }
+        }
+
+        // Copy all the slices, the data is staged right away
+        const uint64_t sliceSize = texelCount * 4 * sizeof(float16_t);
+        const uint32_t mip0Size = refTex.width * refTex.height * 4 * sizeof(float16_t);
+        for (uint32_t sliceIdx = 0; sliceIdx < sliceCount * m_NumSets; ++sliceIdx)
+            uploadManager.upload_texture_mips((const char*)sliceData.data() + sliceIdx * sliceSize, sliceSize, mip0Size, featureTextures[texIdx], sliceIdx);
+    }
+
+    // The only inputs left for the first layer are the LOD weights and the bias
+    std::vector<float> layer0Data;
+    for (uint32_t setIdx = 0; setIdx < m_NumSets; ++setIdx)
+    {
+        const CPUMLP& cpuMLP = m_MLPArray[setIdx];
+        layer0Data.insert(layer0Data.end(), cpuMLP.mlp0Buffer.begin() + 12 * featureCount, cpuMLP.mlp0Buffer.begin() + 13 * featureCount);
+        layer0Data.insert(layer0Data.end(), cpuMLP.mlp0Buffer.begin() + cpuMLP.mlp0Height * featureCount, cpuMLP.mlp0Buffer.end());
     }
+    uploadManager.convert_and_upload_buffer(m_FP32toFP16CS, (char*)layer0Data.data(), layer0Data.size() * sizeof(float), sizeof(float), m_Nwk.featureLayer0Buffer);
 }
 
 void TSNC::reload_shaders(const std::string& shaderLibrary)
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "network/tsnc_container.h"
+#include "math/operators.h"
+#include "tools/crc32c.h"
+#include "tools/security.h"
+#include "tools/stream.h"
+
+namespace tsnc_container
+{
+    bool is_container(const std::string& path)
+    {
+        const std::string extension = ".tsnc";
+        return path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+    }
+
+    void build_metadata(const CPUMLP& mlp, const CPULatentTexture& latentTex, ContainerMetadata& metadata)
+    {
+        metadata.mip0Resolution = latentTex.width;
+        metadata.mlp0InDim = mlp.mlp0Height;
+        metadata.mlp0OutDim = mlp.mlp0Width;
+        metadata.mlp1OutDim = mlp.mlp1Width;
+        metadata.mlp2OutDim = mlp.mlp2Width;
+        metadata.finalChannelCount = mlp.finalChannelCount;
+        metadata.weightFormat = (uint32_t)mlp.weightFormat;
+    }
+
+    void pack_half_layer(std::vector<char>& buffer, uint32_t width, uint32_t height, const std::vector<float>& layerBuffer)
+    {
+        pack_bytes<uint32_t>(buffer, width);
+        pack_bytes<uint32_t>(buffer, height);
+        for (const float value : layerBuffer)
+            pack_bytes<float16_t>(buffer, to_half(value));
+    }
+
+    void pack_half(std::vector<char>& buffer, const CPUMLP& mlp)
+    {
+        pack_bytes<uint32_t>(buffer, mlp.nbMlp);
+        pack_bytes<uint32_t>(buffer, mlp.finalChannelCount);
+        pack_bytes<uint32_t>(buffer, mlp.finalBlockWidth);
+        pack_half_layer(buffer, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer);
+        pack_half_layer(buffer, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer);
+        pack_half_layer(buffer, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer);
+    }
+
+    bool unpack_half_layer(StreamReader& reader, uint32_t& width, uint32_t& height, std::vector<float>& layerBuffer)
+    {
+        reader.read_bytes<uint32_t>(width);
+        reader.read_bytes<uint32_t>(height);
+        const uint64_t layerSize = (uint64_t)width * height + width;
+        std::span<const float16_t> halfBuffer;
+        if (!reader.map_span(layerSize, halfBuffer))
+            return false;
+
+        // fp16 to float is exact, the GPU upload converts them back to the same values
+        layerBuffer.resize(layerSize);
+        for (uint64_t i = 0; i < layerSize; ++i)
+            layerBuffer[i] = to_float(halfBuffer[i]);
+        return true;
+    }
+
+    bool unpack_half(const char* data, uint64_t size, CPUMLP& mlp)
+    {
+        StreamReader reader(data, size);
+        mlp.weightFormat = MLPWeightFormat::Float32;
+        reader.read_bytes<uint32_t>(mlp.nbMlp);
+        reader.read_bytes<uint32_t>(mlp.finalChannelCount);
+        reader.read_bytes<uint32_t>(mlp.finalBlockWidth);
+        return unpack_half_layer(reader, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer)
+            && unpack_half_layer(reader, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer)
+            && unpack_half_layer(reader, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer);
+    }
+
+    uint32_t toc_checksum(const ContainerHeader& header, const ContainerEntry* entries)
+    {
+        ContainerHeader checkedHeader = header;
+        checkedHeader.tocChecksum = 0;
+        const uint32_t checksum = crc32c::compute(&checkedHeader, sizeof(ContainerHeader));
+        return crc32c::compute(entries, header.entryCount * sizeof(ContainerEntry), checksum);
+    }
+
+    uint64_t align_offset(uint64_t offset)
+    {
+        return (offset + TSNC_CONTAINER_ALIGNMENT - 1) / TSNC_CONTAINER_ALIGNMENT * TSNC_CONTAINER_ALIGNMENT;
+    }
+
+    void write(const char* containerPath, const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, bool halfWeights)
+    {
+        const uint32_t numSets = (uint32_t)mlpArray.size();
+        assert_msg(numSets > 0 && latentArray.size() == 4 * mlpArray.size(), "Invalid network\n");
+
+        // The metadata matches what the runtime computes after aligning the network
+        ContainerHeader header;
+        header.numSets = numSets;
+        header.entryCount = 5 * numSets;
+        CPUMLP alignedMLP = mlpArray[0];
+        mlp::align_dimensions(alignedMLP);
+        build_metadata(alignedMLP, latentArray[0], header.metadata);
+
+        // Serialize the MLPs, the latent textures are written straight from their mapping
+        std::vector<std::vector<char>> mlpPayloads(numSets);
+        std::vector<ContainerEntry> entries(header.entryCount);
+        uint64_t offset = align_offset(sizeof(ContainerHeader) + header.entryCount * sizeof(ContainerEntry));
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            const CPUMLP& mlp = mlpArray[setIdx];
+            const bool half = halfWeights && mlp.weightFormat == MLPWeightFormat::Float32;
+            if (half)
+                pack_half(mlpPayloads[setIdx], mlp);
+            else
+                pack_type(mlpPayloads[setIdx], mlp);
+
+            ContainerEntry& mlpEntry = entries[5 * setIdx];
+            mlpEntry.chunk = half ? ContainerChunk::MLPHalf : ContainerChunk::MLP;
+            mlpEntry.setIdx = setIdx;
+            mlpEntry.offset = offset;
+            mlpEntry.size = mlpPayloads[setIdx].size();
+            mlpEntry.checksum = crc32c::compute(mlpPayloads[setIdx].data(), mlpEntry.size);
+            offset = align_offset(offset + mlpEntry.size);
+
+            for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+            {
+                // Only the usable mips are kept
+                const CPULatentTexture& latentTex = latentArray[4 * setIdx + texIdx];
+                ContainerEntry& texEntry = entries[5 * setIdx + 1 + texIdx];
+                texEntry.chunk = ContainerChunk::Latent;
+                texEntry.setIdx = setIdx;
+                texEntry.texIdx = texIdx;
+                texEntry.offset = offset;
+                texEntry.size = latent_space::mip_offset(latentTex, latentTex.mipCount);
+                texEntry.width = latentTex.width;
+                texEntry.height = latentTex.height;
+                texEntry.mipCount = latentTex.mipCount;
+                texEntry.uvOffset = latentTex.uvOffset;
+                texEntry.checksum = crc32c::compute(latentTex.data.data(), texEntry.size);
+                offset = align_offset(offset + texEntry.size);
+            }
+        }
+
+        // Header, table of contents then the payloads, zero padded to their offsets
+        header.tocChecksum = toc_checksum(header, entries.data());
+        StreamWriter writer;
+        assert_msg(writer.open(containerPath), "Failed to create the container\n");
+        const std::vector<char> padding(TSNC_CONTAINER_ALIGNMENT, 0);
+        uint64_t position = 0;
+        auto write_payload = [&](uint64_t payloadOffset, const void* payload, uint64_t size)
+        {
+            writer.write_buffer(payloadOffset - position, padding.data());
+            writer.write_buffer(size, (const char*)payload);
+            position = payloadOffset + size;
+        };
+        write_payload(0, &header, sizeof(ContainerHeader));
+        write_payload(position, entries.data(), entries.size() * sizeof(ContainerEntry));
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            write_payload(entries[5 * setIdx].offset, mlpPayloads[setIdx].data(), mlpPayloads[setIdx].size());
+            for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+            {
+                const ContainerEntry& texEntry = entries[5 * setIdx + 1 + texIdx];
+                write_payload(texEntry.offset, latentArray[4 * setIdx + texIdx].data.data(), texEntry.size);
+            }
+        }
+
+        // Pad the last payload so that a whole page can be read
+        write_payload(align_offset(position), nullptr, 0);
+        assert_msg(writer.close(), "Failed to write the container\n");
+    }
+
+    bool load(const char* containerPath, std::vector<CPUMLP>& mlpArray, std::vector<CPULatentTexture>& latentArray, ContainerHeader& header)
+    {
+        // Map the file, every latent texture keeps a reference to the mapping
+        std::shared_ptr<FileView> file = std::make_shared<FileView>();
+        if (!file->open(containerPath))
+            return false;
+
+        // Header and table of contents
+        StreamReader reader(file->data(), file->size());
+        if (!reader.read_bytes(header) || header.magic != TSNC_CONTAINER_MAGIC || header.version != TSNC_CONTAINER_VERSION)
+            return false;
+        if (header.numSets == 0 || header.entryCount != 5 * (uint64_t)header.numSets || header.entryCount * sizeof(ContainerEntry) > reader.remaining())
+            return false;
+        std::vector<ContainerEntry> entries(header.entryCount);
+        if (!reader.read_buffer(entries.size() * sizeof(ContainerEntry), (char*)entries.data()) || toc_checksum(header, entries.data()) != header.tocChecksum)
+            return false;
+
+        // Payloads
+        mlpArray.resize(header.numSets);
+        latentArray.resize(4 * header.numSets);
+        std::vector<bool> loaded(header.entryCount, false);
+        for (const ContainerEntry& entry : entries)
+        {
+            if (entry.offset % TSNC_CONTAINER_ALIGNMENT != 0 || entry.offset > file->size() || entry.size > file->size() - entry.offset)
+                return false;
+            if (entry.setIdx >= header.numSets || entry.texIdx >= 4)
+                return false;
+            const char* payload = file->data() + entry.offset;
+            if (crc32c::compute(payload, entry.size) != entry.checksum)
+                return false;
+            if (entry.chunk == ContainerChunk::MLP || entry.chunk == ContainerChunk::MLPHalf)
+            {
+                CPUMLP& mlp = mlpArray[entry.setIdx];
+                if (entry.chunk == ContainerChunk::MLP)
+                {
+                    CPUMLPView view;
+                    if (!mlp::map_view(payload, entry.size, view))
+                        return false;
+                    mlp::load_view(view, mlp);
+                }
+                else if (!unpack_half(payload, entry.size, mlp))
+                    return false;
+                loaded[5 * entry.setIdx] = true;
+            }
+            else if (entry.chunk == ContainerChunk::Latent)
+            {
+                CPULatentTexture& latentTex = latentArray[4 * entry.setIdx + entry.texIdx];
+                latentTex.width = entry.width;
+                latentTex.height = entry.height;
+                latentTex.mipCount = entry.mipCount;
+                latentTex.uvOffset = entry.uvOffset;
+                latentTex.data = std::span<const uint8_t>((const uint8_t*)payload, entry.size);
+                latentTex.file = file;
+                if (entry.mipCount == 0 || latent_space::mip_offset(latentTex, latentTex.mipCount) > entry.size)
+                    return false;
+                loaded[5 * entry.setIdx + 1 + entry.texIdx] = true;
+            }
+        }
+
+        // Every set needs its MLP and its four textures
+        for (uint32_t entryIdx = 0; entryIdx < header.entryCount; ++entryIdx)
+        {
+            if (!loaded[entryIdx])
+                return false;
+        }
+        return true;
+    }
+
+    void export_model_directory(const std::string& modelDir, uint32_t numSets, const char* containerPath, bool halfWeights)
+    {
+        std::vector<CPUMLP> mlpArray(numSets);
+        std::vector<CPULatentTexture> latentArray(4 * numSets);
+
+        // Forward slashes are accepted on every platform
+        for (uint32_t setIdx = 0; setIdx < numSets; ++setIdx)
+        {
+            // The MLPs are stored as in the source files, the runtime aligns them
+            mlp::load_file((modelDir + "/mlp_" + std::to_string(setIdx) + ".bin").c_str(), mlpArray[setIdx]);
+            for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+                latent_space::load_bc1((modelDir + "/tex" + std::to_string(texIdx) + "_" + std::to_string(setIdx) + ".bc1").c_str(), latentArray[4 * setIdx + texIdx]);
+        }
+        write(containerPath, mlpArray, latentArray, halfWeights);
+    }
+}
@@ -0,0 +1,506 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+#include "null/null_helpers.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+
+namespace null_backend
+{
+    namespace command_buffer
+    {
+        // Creation and Destruction
+        CommandBuffer create_command_buffer(GraphicsDevice graphicsDevice, CommandBufferType commandBufferType)
+        {
+            NullCommandBuffer* null_cmd = new NullCommandBuffer();
+            null_cmd->deviceI = (NullGraphicsDevice*)graphicsDevice;
+            null_cmd->type = commandBufferType;
+            null_cmd->closed = true;
+            return (CommandBuffer)null_cmd;
+        }
+
+        void destroy_command_buffer(CommandBuffer commandBuffer)
+        {
+            NullCommandBuffer* null_cmd = (NullCommandBuffer*)commandBuffer;
+            delete null_cmd;
+        }
+
+        // Generic operations
+        void reset(CommandBuffer commandBuffer)
+        {
+            // The storage of the stream is kept from one recording to the next
+            NullCommandBuffer* null_cmd = (NullCommandBuffer*)commandBuffer;
+            null_cmd->commands.clear();
+            null_cmd->closed = false;
+            null_cmd->resetTime = NullClock::now();
+
+            // New recording, nothing is set on the command buffer
+            state_tracker::begin_recording(null_cmd->state, null_cmd->deviceI->nextRecordingID++);
+        }
+
+        void close(CommandBuffer commandBuffer)
+        {
+            NullCommandBuffer* null_cmd = (NullCommandBuffer*)commandBuffer;
+            null_cmd->closed = true;
+            null_cmd->recordingTimeUS = std::chrono::duration<double, std::micro>(NullClock::now() - null_cmd->resetTime).count();
+        }
+
+        const StateStats& state_statistics(CommandBuffer commandBuffer)
+        {
+            NullCommandBuffer* null_cmd = (NullCommandBuffer*)commandBuffer;
+            return null_cmd->state.stats;
+        }
+
+        void reset_state_statistics(CommandBuffer commandBuffer)
+        {
+            NullCommandBuffer* null_cmd = (NullCommandBuffer*)commandBuffer;
+            null_cmd->state.stats = StateStats();
+        }
+
+        // Render Texture
+        void clear_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture, const float4&)
+        {
+            NullCommand command;
+            command.type = NullCommandType::Clear;
+            command.resource0 = renderTexture;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void clear_depth_texture(CommandBuffer commandBuffer, RenderTexture depthTexture, float)
+        {
+            clear_render_texture(commandBuffer, depthTexture, float4());
+        }
+
+        void clear_depth_stencil_texture(CommandBuffer commandBuffer, RenderTexture depthTexture, float, uint8_t)
+        {
+            clear_render_texture(commandBuffer, depthTexture, float4());
+        }
+
+        void clear_stencil_texture(CommandBuffer commandBuffer, RenderTexture stencilTexture, uint8_t)
+        {
+            clear_render_texture(commandBuffer, stencilTexture, float4());
+        }
+
+        static void record_render_textures(CommandBuffer commandBuffer, RenderTexture renderTexture0, RenderTexture renderTexture1, uint32_t numRenderTextures)
+        {
+            NullCommand command;
+            command.type = NullCommandType::SetRenderTexture;
+            command.resource0 = renderTexture0;
+            command.resource1 = renderTexture1;
+            command.params[0] = numRenderTextures;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void set_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture)
+        {
+            record_render_textures(commandBuffer, renderTexture, 0, 1);
+        }
+
+        void set_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture, RenderTexture depthTexture)
+        {
+            record_render_textures(commandBuffer, renderTexture, depthTexture, 1);
+        }
+
+        void set_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture0, RenderTexture, RenderTexture depthTexture)
+        {
+            record_render_textures(commandBuffer, renderTexture0, depthTexture, 2);
+        }
+
+        void set_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture0, RenderTexture, RenderTexture, RenderTexture depthTexture)
+        {
+            record_render_textures(commandBuffer, renderTexture0, depthTexture, 3);
+        }
+
+        // Copy
+        static void record_copy(CommandBuffer commandBuffer, NullCommandType type, uint64_t input, uint64_t inputOffset, uint64_t output, uint64_t outputOffset, uint64_t size)
+        {
+            NullCommand command;
+            command.type = type;
+            command.resource0 = input;
+            command.offset0 = inputOffset;
+            command.resource1 = output;
+            command.offset1 = outputOffset;
+            command.size = size;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void copy_graphics_buffer(CommandBuffer commandBuffer, GraphicsBuffer inputBuffer, GraphicsBuffer outputBuffer)
+        {
+            NullGraphicsBuffer* input = (NullGraphicsBuffer*)inputBuffer;
+            NullGraphicsBuffer* output = (NullGraphicsBuffer*)outputBuffer;
+            record_copy(commandBuffer, NullCommandType::CopyBuffer, inputBuffer, 0, outputBuffer, 0, std::min(input->bufferSize, output->bufferSize));
+        }
+
+        void copy_graphics_buffer(CommandBuffer commandBuffer, GraphicsBuffer inputBuffer, uint32_t inputOffset, GraphicsBuffer outputBuffer, uint32_t outputOffset, uint64_t size)
+        {
+            record_copy(commandBuffer, NullCommandType::CopyBuffer, inputBuffer, inputOffset, outputBuffer, outputOffset, size);
+        }
+
+        void upload_constant_buffer(CommandBuffer commandBuffer, ConstantBuffer inputBuffer, ConstantBuffer outputBuffer)
+        {
+            NullConstantBuffer* input = (NullConstantBuffer*)inputBuffer;
+            record_copy(commandBuffer, NullCommandType::UploadConstantBuffer, inputBuffer, 0, outputBuffer, 0, input->data.size());
+        }
+
+        void upload_constant_buffer(CommandBuffer commandBuffer, ConstantBuffer constantBuffer)
+        {
+            // The constant buffers have a single host copy, nothing to move
+            record_copy(commandBuffer, NullCommandType::UploadConstantBuffer, constantBuffer, 0, 0, 0, 0);
+        }
+
+        void copy_texture(CommandBuffer commandBuffer, Texture inputTexture, Texture outputTexture)
+        {
+            NullTexture* input = (NullTexture*)inputTexture;
+            record_copy(commandBuffer, NullCommandType::CopyTexture, inputTexture, 0, outputTexture, 0, input->data.size());
+        }
+
+        void copy_texture(CommandBuffer commandBuffer, RenderTexture inputTexture, uint32_t inputIdx, RenderTexture outputTexture, uint32_t outputIdx)
+        {
+            NullTexture* input = (NullTexture*)inputTexture;
+            NullTexture* output = (NullTexture*)outputTexture;
+            record_copy(commandBuffer, NullCommandType::CopyTexture, inputTexture, input->subresourceOffsets[inputIdx], outputTexture, output->subresourceOffsets[outputIdx], input->subresourceSizes[inputIdx]);
+        }
+
+        void copy_render_texture(CommandBuffer commandBuffer, RenderTexture inputTexture, RenderTexture outputTexture)
+        {
+            copy_texture(commandBuffer, inputTexture, outputTexture);
+        }
+
+        void copy_buffer_into_texture(CommandBuffer commandBuffer, GraphicsBuffer inputBuffer, uint64_t bufferOffset, Texture outputTexture, uint32_t sliceIdx, uint32_t mipIdx)
+        {
+            NullTexture* output = (NullTexture*)outputTexture;
+            const uint32_t subresourceIdx = sliceIdx * output->mipLevels + mipIdx;
+            record_copy(commandBuffer, NullCommandType::CopyBufferToTexture, inputBuffer, bufferOffset, outputTexture, output->subresourceOffsets[subresourceIdx], output->subresourceSizes[subresourceIdx]);
+        }
+
+        void copy_buffer_into_texture_mip(CommandBuffer commandBuffer, GraphicsBuffer inputBuffer, uint64_t bufferOffset, Texture outputTexture, uint32_t mipIdx)
+        {
+            copy_buffer_into_texture(commandBuffer, inputBuffer, bufferOffset, outputTexture, 0, mipIdx);
+        }
+
+        void copy_buffer_into_texture_mips(CommandBuffer commandBuffer, GraphicsBuffer inputBuffer, uint64_t bufferOffset, uint32_t, Texture outputTexture, uint32_t sliceIdx)
+        {
+            // The mips of a slice are consecutive in the host memory
+            NullTexture* output = (NullTexture*)outputTexture;
+            const uint32_t firstIdx = sliceIdx * output->mipLevels;
+            uint64_t size = 0;
+            for (uint32_t mipIdx = 0; mipIdx < output->mipLevels; ++mipIdx)
+                size += output->subresourceSizes[firstIdx + mipIdx];
+            record_copy(commandBuffer, NullCommandType::CopyBufferToTexture, inputBuffer, bufferOffset, outputTexture, output->subresourceOffsets[firstIdx], size);
+        }
+
+        void copy_buffer_into_render_texture(CommandBuffer commandBuffer, GraphicsBuffer inputBuffer, uint64_t bufferOffset, Texture outputRenderTexture, uint32_t sliceIdx)
+        {
+            copy_buffer_into_texture(commandBuffer, inputBuffer, bufferOffset, outputRenderTexture, sliceIdx, 0);
+        }
+
+        void copy_texture_into_buffer(CommandBuffer commandBuffer, Texture inputTexture, uint32_t sliceIdx, uint32_t mipIdx, GraphicsBuffer outputBuffer, uint64_t bufferOffset)
+        {
+            NullTexture* input = (NullTexture*)inputTexture;
+            const uint32_t subresourceIdx = sliceIdx * input->mipLevels + mipIdx;
+            record_copy(commandBuffer, NullCommandType::CopyTextureToBuffer, inputTexture, input->subresourceOffsets[subresourceIdx], outputBuffer, bufferOffset, input->subresourceSizes[subresourceIdx]);
+        }
+
+        void copy_render_texture_into_buffer(CommandBuffer commandBuffer, RenderTexture inputTexture, uint32_t sliceIdx, GraphicsBuffer outputBuffer, uint64_t bufferOffset)
+        {
+            copy_texture_into_buffer(commandBuffer, inputTexture, sliceIdx, 0, outputBuffer, bufferOffset);
+        }
+
+        // UAV barriers and transitions
+        static void record_barrier(CommandBuffer commandBuffer, uint64_t resource)
+        {
+            NullCommand command;
+            command.type = NullCommandType::Barrier;
+            command.resource0 = resource;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void uav_barrier_buffer(CommandBuffer commandBuffer, GraphicsBuffer targetBuffer)
+        {
+            record_barrier(commandBuffer, targetBuffer);
+        }
+
+        void uav_barrier_texture(CommandBuffer commandBuffer, Texture texture)
+        {
+            record_barrier(commandBuffer, texture);
+        }
+
+        void uav_barrier_render_texture(CommandBuffer commandBuffer, RenderTexture renderTexture)
+        {
+            record_barrier(commandBuffer, renderTexture);
+        }
+
+        void transition_to_common(CommandBuffer commandBuffer, GraphicsBuffer targetBuffer)
+        {
+            record_barrier(commandBuffer, targetBuffer);
+        }
+
+        void transition_to_copy_source(CommandBuffer commandBuffer, GraphicsBuffer targetBuffer)
+        {
+            record_barrier(commandBuffer, targetBuffer);
+        }
+
+        void transition_to_present(CommandBuffer commandBuffer, RenderTexture renderTexture)
+        {
+            record_barrier(commandBuffer, renderTexture);
+        }
+
+        // Compute Shader
+        static void record_compute_binding(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, uint64_t resource, uint32_t mipLevel)
+        {
+            NullComputeShader* null_cs = (NullComputeShader*)computeShader;
+            const uint32_t index = request_binding(null_cs->bindings, null_cs->boundResources, null_cs->boundSubresources, slot);
+
+            // Like the cached views of DX12, binding the same resource again leaves the tables untouched
+            if (null_cs->boundResources[index] != resource || null_cs->boundSubresources[index] != mipLevel)
+            {
+                null_cs->boundResources[index] = resource;
+                null_cs->boundSubresources[index] = mipLevel;
+                null_cs->tables.dirty = true;
+            }
+
+            NullCommand command;
+            command.type = NullCommandType::Binding;
+            command.resource0 = computeShader;
+            command.resource1 = resource;
+            command.params[0] = index;
+            command.params[1] = mipLevel;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void set_compute_shader_cbuffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, ConstantBuffer constantBuffer)
+        {
+            record_compute_binding(commandBuffer, computeShader, slot, constantBuffer, 0);
+        }
+
+        void set_compute_shader_buffer(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, GraphicsBuffer graphicsBuffer)
+        {
+            record_compute_binding(commandBuffer, computeShader, slot, graphicsBuffer, 0);
+        }
+
+        void set_compute_shader_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Texture texture, uint32_t mipLevel)
+        {
+            record_compute_binding(commandBuffer, computeShader, slot, texture, mipLevel);
+        }
+
+        void set_compute_shader_render_texture(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, RenderTexture texture)
+        {
+            record_compute_binding(commandBuffer, computeShader, slot, texture, 0);
+        }
+
+        void set_compute_shader_sampler(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, Sampler sampler)
+        {
+            record_compute_binding(commandBuffer, computeShader, slot, sampler, 0);
+        }
+
+        void set_compute_shader_rtas(CommandBuffer commandBuffer, ComputeShader computeShader, BindingSlot slot, TopLevelAS rtas)
+        {
+            record_compute_binding(commandBuffer, computeShader, slot, rtas, 0);
+        }
+
+        void dispatch(CommandBuffer commandBuffer, ComputeShader computeShader, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ)
+        {
+            assert_msg(sizeX < 65535 && sizeY < 65535 && sizeZ < 65535, "Dispatch dimensions are too large.");
+            NullComputeShader* null_cs = (NullComputeShader*)computeShader;
+            bind_compute_shader((NullCommandBuffer*)commandBuffer, null_cs);
+            NullCommand command;
+            command.type = NullCommandType::Dispatch;
+            command.resource0 = computeShader;
+            command.params[0] = sizeX;
+            command.params[1] = sizeY;
+            command.params[2] = sizeZ;
+            command.params[3] = (uint32_t)null_cs->boundResources.size();
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void dispatch_indirect(CommandBuffer commandBuffer, ComputeShader computeShader, GraphicsBuffer indirectBuffer, uint32_t offset)
+        {
+            NullComputeShader* null_cs = (NullComputeShader*)computeShader;
+            bind_compute_shader((NullCommandBuffer*)commandBuffer, null_cs);
+            NullCommand command;
+            command.type = NullCommandType::Dispatch;
+            command.resource0 = computeShader;
+            command.resource1 = indirectBuffer;
+            command.offset1 = offset;
+            command.params[3] = (uint32_t)null_cs->boundResources.size();
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        // Graphics Pipeline
+        void set_viewport(CommandBuffer commandBuffer, int32_t offsetX, int32_t offsetY, uint32_t width, uint32_t height)
+        {
+            NullCommand command;
+            command.type = NullCommandType::Viewport;
+            command.params[0] = (uint32_t)offsetX;
+            command.params[1] = (uint32_t)offsetY;
+            command.params[2] = width;
+            command.params[3] = height;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        static void record_graphics_binding(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, uint64_t resource, uint64_t offset)
+        {
+            NullGraphicsPipeline* null_gp = (NullGraphicsPipeline*)graphicsPipeline;
+            const uint32_t index = request_binding(null_gp->bindings, null_gp->boundResources, null_gp->boundSubresources, slot);
+            if (null_gp->boundResources[index] != resource || null_gp->boundSubresources[index] != offset)
+            {
+                null_gp->boundResources[index] = resource;
+                null_gp->boundSubresources[index] = offset;
+                null_gp->tables.dirty = true;
+            }
+
+            NullCommand command;
+            command.type = NullCommandType::Binding;
+            command.resource0 = graphicsPipeline;
+            command.resource1 = resource;
+            command.offset1 = offset;
+            command.params[0] = index;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void set_graphics_pipeline_cbuffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, ConstantBuffer constantBuffer)
+        {
+            record_graphics_binding(commandBuffer, graphicsPipeline, slot, constantBuffer, 0);
+        }
+
+        void set_graphics_pipeline_buffer(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, GraphicsBuffer graphicsBuffer, uint64_t bufferOffset)
+        {
+            record_graphics_binding(commandBuffer, graphicsPipeline, slot, graphicsBuffer, bufferOffset);
+        }
+
+        void set_graphics_pipeline_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Texture texture)
+        {
+            record_graphics_binding(commandBuffer, graphicsPipeline, slot, texture, 0);
+        }
+
+        void set_graphics_pipeline_render_texture(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, RenderTexture renderTexture)
+        {
+            record_graphics_binding(commandBuffer, graphicsPipeline, slot, renderTexture, 0);
+        }
+
+        void set_graphics_pipeline_sampler(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, Sampler sampler)
+        {
+            record_graphics_binding(commandBuffer, graphicsPipeline, slot, sampler, 0);
+        }
+
+        void set_graphics_pipeline_rtas(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, BindingSlot slot, TopLevelAS rtas)
+        {
+            record_graphics_binding(commandBuffer, graphicsPipeline, slot, rtas, 0);
+        }
+
+        static void record_draw(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, uint64_t argumentBuffer, uint64_t argumentOffset, uint32_t numPrimitives, uint32_t numInstances, DrawPrimitive primitive)
+        {
+            NullGraphicsPipeline* null_gp = (NullGraphicsPipeline*)graphicsPipeline;
+            bind_graphics_pipeline((NullCommandBuffer*)commandBuffer, null_gp);
+
+            NullCommand command;
+            command.type = NullCommandType::Draw;
+            command.resource0 = graphicsPipeline;
+            command.resource1 = argumentBuffer;
+            command.offset1 = argumentOffset;
+            command.params[0] = numPrimitives;
+            command.params[1] = numInstances;
+            command.params[2] = (uint32_t)primitive;
+            command.params[3] = (uint32_t)null_gp->boundResources.size();
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void draw_indexed(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer, GraphicsBuffer indexBuffer, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive)
+        {
+            record_draw(commandBuffer, graphicsPipeline, indexBuffer, 0, numTriangles, numInstances, primitive);
+        }
+
+        void draw_procedural(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, uint32_t numTriangles, uint32_t numInstances, DrawPrimitive primitive)
+        {
+            record_draw(commandBuffer, graphicsPipeline, 0, 0, numTriangles, numInstances, primitive);
+        }
+
+        void draw_procedural_indirect(CommandBuffer commandBuffer, GraphicsPipeline graphicsPipeline, GraphicsBuffer indirectBuffer, uint64_t bufferOffset)
+        {
+            record_draw(commandBuffer, graphicsPipeline, indirectBuffer, bufferOffset, 0, 0, DrawPrimitive::Triangle);
+        }
+
+        // Ray Tracing
+        void build_blas(CommandBuffer cmdB, BottomLevelAS blas)
+        {
+            NullCommand command;
+            command.type = NullCommandType::BuildAS;
+            command.resource0 = blas;
+            record_command((NullCommandBuffer*)cmdB, command);
+        }
+
+        void build_tlas(CommandBuffer cmdB, TopLevelAS tlas)
+        {
+            NullCommand command;
+            command.type = NullCommandType::BuildAS;
+            command.resource0 = tlas;
+            record_command((NullCommandBuffer*)cmdB, command);
+        }
+
+        // Events
+        void start_section(CommandBuffer commandBuffer, const std::string&)
+        {
+            NullCommand command;
+            command.type = NullCommandType::Event;
+            command.params[0] = 1;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void end_section(CommandBuffer commandBuffer)
+        {
+            NullCommand command;
+            command.type = NullCommandType::Event;
+            command.params[0] = 0;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        // Profiling scopes, they time the recording on the CPU
+        void enable_profiling_scope(CommandBuffer commandBuffer, ProfilingScope scope)
+        {
+            NullProfilingScope* null_scope = (NullProfilingScope*)scope;
+            null_scope->startTime = NullClock::now();
+
+            NullCommand command;
+            command.type = NullCommandType::Profiling;
+            command.resource0 = scope;
+            command.params[0] = 1;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        void disable_profiling_scope(CommandBuffer commandBuffer, ProfilingScope scope)
+        {
+            NullProfilingScope* null_scope = (NullProfilingScope*)scope;
+            null_scope->durationUS = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(NullClock::now() - null_scope->startTime).count();
+
+            NullCommand command;
+            command.type = NullCommandType::Profiling;
+            command.resource0 = scope;
+            command.params[0] = 0;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+
+        // Misc
+        void convert_mat_32_to_16(CommandBuffer commandBuffer, GraphicsBuffer inputMatrixBuffer, uint64_t inputOffset, GraphicsBuffer outputMatrixBuffer, uint64_t outputOffset, uint32_t width, uint32_t height, bool optimal)
+        {
+            NullCommand command;
+            command.type = NullCommandType::ConvertMatrix;
+            command.resource0 = inputMatrixBuffer;
+            command.offset0 = inputOffset;
+            command.resource1 = outputMatrixBuffer;
+            command.offset1 = outputOffset;
+            command.params[0] = width;
+            command.params[1] = height;
+            command.params[2] = optimal ? 1 : 0;
+            record_command((NullCommandBuffer*)commandBuffer, command);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+#include "null/null_helpers.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#include <string.h>
+
+namespace null_backend
+{
+    // Copy between host ranges, the sizes are clamped to both of them
+    static uint64_t copy_range(std::vector<char>& output, uint64_t outputOffset, const std::vector<char>& input, uint64_t inputOffset, uint64_t size)
+    {
+        assert_msg(inputOffset <= input.size() && outputOffset <= output.size(), "Copy out of the bounds of a resource.");
+        size = std::min(size, std::min(input.size() - inputOffset, output.size() - outputOffset));
+        memcpy(output.data() + outputOffset, input.data() + inputOffset, size);
+        return size;
+    }
+
+    static uint64_t execute_command(const NullCommand& command)
+    {
+        switch (command.type)
+        {
+            case NullCommandType::CopyBuffer:
+            {
+                NullGraphicsBuffer* input = (NullGraphicsBuffer*)command.resource0;
+                NullGraphicsBuffer* output = (NullGraphicsBuffer*)command.resource1;
+                return copy_range(output->data, command.offset1, input->data, command.offset0, command.size);
+            }
+            case NullCommandType::CopyTexture:
+            {
+                NullTexture* input = (NullTexture*)command.resource0;
+                NullTexture* output = (NullTexture*)command.resource1;
+                return copy_range(output->data, command.offset1, input->data, command.offset0, command.size);
+            }
+            case NullCommandType::CopyBufferToTexture:
+            {
+                // The subresources of the range are consecutive, the source is tightly packed
+                NullGraphicsBuffer* input = (NullGraphicsBuffer*)command.resource0;
+                NullTexture* output = (NullTexture*)command.resource1;
+                return copy_range(output->data, command.offset1, input->data, command.offset0, command.size);
+            }
+            case NullCommandType::CopyTextureToBuffer:
+            {
+                NullTexture* input = (NullTexture*)command.resource0;
+                NullGraphicsBuffer* output = (NullGraphicsBuffer*)command.resource1;
+                return copy_range(output->data, command.offset1, input->data, command.offset0, command.size);
+            }
+            case NullCommandType::UploadConstantBuffer:
+            {
+                // Only the staged uploads move data
+                if (command.resource1 == 0)
+                    return 0;
+                NullConstantBuffer* input = (NullConstantBuffer*)command.resource0;
+                NullConstantBuffer* output = (NullConstantBuffer*)command.resource1;
+                return copy_range(output->data, 0, input->data, 0, command.size);
+            }
+            default:
+                // Shader work and state changes have no host side effect
+                return 0;
+        }
+    }
+
+    namespace command_queue
+    {
+        CommandQueue create_command_queue(GraphicsDevice graphicsDevice, CommandQueuePriority, CommandQueuePriority, CommandQueuePriority)
+        {
+            NullCommandQueue* null_queue = new NullCommandQueue();
+            null_queue->deviceI = (NullGraphicsDevice*)graphicsDevice;
+            return (CommandQueue)null_queue;
+        }
+
+        void destroy_command_queue(CommandQueue commandQueue)
+        {
+            NullCommandQueue* null_queue = (NullCommandQueue*)commandQueue;
+            delete null_queue;
+        }
+
+        void execute_command_buffer(CommandQueue commandQueue, CommandBuffer commandBuffer, bool)
+        {
+            NullCommandQueue* null_queue = (NullCommandQueue*)commandQueue;
+            NullCommandBuffer* null_cmd = (NullCommandBuffer*)commandBuffer;
+            assert_msg(null_cmd->closed, "Executing a command buffer that was not closed.");
+
+            // The execution is synchronous, it completes before the next submission
+            NullBackendStats& stats = null_queue->deviceI->stats;
+            const NullClock::time_point start = NullClock::now();
+            for (const NullCommand& command : null_cmd->commands)
+                stats.copiedBytes += execute_command(command);
+            const NullClock::time_point stop = NullClock::now();
+
+            // Stats
+            stats.numExecutedBuffers++;
+            stats.recordingTimeUS += null_cmd->recordingTimeUS;
+            stats.executionTimeUS += std::chrono::duration<double, std::micro>(stop - start).count();
+        }
+
+        void signal(CommandQueue, Fence fence, uint64_t value, CommandBufferType)
+        {
+            // Everything submitted so far is done
+            NullFence* null_fence = (NullFence*)fence;
+            null_fence->value = value;
+        }
+
+        void wait(CommandQueue, Fence fence, uint64_t value, CommandBufferType)
+        {
+            // Nothing can signal the fence later, the wait would never end on a GPU either
+            NullFence* null_fence = (NullFence*)fence;
+            assert_msg(null_fence->value >= value, "Queue waiting for a fence value that was never signaled.");
+        }
+
+        void flush(CommandQueue, CommandBufferType)
+        {
+        }
+    }
+}
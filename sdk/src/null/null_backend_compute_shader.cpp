@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+
+namespace null_backend
+{
+    namespace compute_shader
+    {
+        ComputeShader create_compute_shader(GraphicsDevice graphicsDevice, const ComputeShaderDescriptor& csd, bool)
+        {
+            // Nothing is compiled, the shader only tracks its bindings
+            NullGraphicsDevice* deviceI = (NullGraphicsDevice*)graphicsDevice;
+            NullComputeShader* null_cs = new NullComputeShader();
+            null_cs->deviceI = deviceI;
+            null_cs->filename = csd.filename;
+            null_cs->kernelname = csd.kernelname;
+            deviceI->allocatedCS++;
+            return (ComputeShader)null_cs;
+        }
+
+        void destroy_compute_shader(ComputeShader computeShader)
+        {
+            NullComputeShader* null_cs = (NullComputeShader*)computeShader;
+            null_cs->deviceI->allocatedCS--;
+            delete null_cs;
+        }
+    }
+}
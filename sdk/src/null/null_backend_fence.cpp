@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+#include "tools/security.h"
+
+namespace null_backend
+{
+    namespace fence
+    {
+        Fence create_fence(GraphicsDevice, uint64_t initialValue)
+        {
+            NullFence* null_fence = new NullFence();
+            null_fence->value = initialValue;
+            return (Fence)null_fence;
+        }
+
+        void destroy_fence(Fence fence)
+        {
+            NullFence* null_fence = (NullFence*)fence;
+            delete null_fence;
+        }
+
+        void set_value(Fence fence, uint64_t value)
+        {
+            NullFence* null_fence = (NullFence*)fence;
+            null_fence->value = value;
+        }
+
+        uint64_t get_value(Fence fence)
+        {
+            NullFence* null_fence = (NullFence*)fence;
+            return null_fence->value;
+        }
+
+        void wait_value(Fence fence, uint64_t value)
+        {
+            // The submissions are executed synchronously, a value not reached yet would never be
+            NullFence* null_fence = (NullFence*)fence;
+            assert_msg(null_fence->value >= value, "Waiting for a fence value that was never signaled.");
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+#include "tools/security.h"
+
+// System includes
+#include <stdio.h>
+
+namespace null_backend
+{
+    namespace device
+    {
+        void enable_experimental_features()
+        {
+        }
+
+        void enable_debug_layer()
+        {
+        }
+
+        GraphicsDevice create_graphics_device(DevicePickStrategy, uint32_t)
+        {
+            NullGraphicsDevice* null_device = new NullGraphicsDevice();
+            return (GraphicsDevice)null_device;
+        }
+
+        void destroy_graphics_device(GraphicsDevice graphicsDevice)
+        {
+            NullGraphicsDevice* null_device = (NullGraphicsDevice*)graphicsDevice;
+
+            // Sanity check
+            assert_msg(null_device->allocatedTextures == 0
+                && null_device->allocatedBuffers == 0
+                && null_device->allocatedSamplers == 0
+                && null_device->allocatedCS == 0
+                && null_device->allocatedGP == 0, "Graphics Device has still active resources");
+
+            // Report the CPU cost of the executed command buffers
+            const NullBackendStats& stats = null_device->stats;
+            if (stats.numExecutedBuffers != 0)
+            {
+                uint64_t numCommands = 0;
+                for (uint32_t typeIdx = 0; typeIdx < (uint32_t)NullCommandType::Count; ++typeIdx)
+                    numCommands += stats.numCommands[typeIdx];
+                printf("Null device: %llu command buffers, %llu commands, %.2f us recording and %.2f us execution per command buffer.\n",
+                    (unsigned long long)stats.numExecutedBuffers, (unsigned long long)numCommands,
+                    stats.recordingTimeUS / stats.numExecutedBuffers, stats.executionTimeUS / stats.numExecutedBuffers);
+            }
+
+            // Destroy the internal structure
+            delete null_device;
+        }
+
+        void set_stable_power_state(GraphicsDevice, bool)
+        {
+        }
+
+        GPUVendor get_gpu_vendor(GraphicsDevice)
+        {
+            return GPUVendor::Other;
+        }
+
+        const char* get_device_name(GraphicsDevice device)
+        {
+            NullGraphicsDevice* null_device = (NullGraphicsDevice*)device;
+            return null_device->adapterName.c_str();
+        }
+
+        bool feature_support(GraphicsDevice, GPUFeature)
+        {
+            // Nothing is executed, no optional path is exposed
+            return false;
+        }
+
+        CoopMatTier coop_mat_tier(GraphicsDevice)
+        {
+            return CoopMatTier::Other;
+        }
+
+        const NullBackendStats& statistics(GraphicsDevice device)
+        {
+            NullGraphicsDevice* null_device = (NullGraphicsDevice*)device;
+            return null_device->stats;
+        }
+
+        void reset_statistics(GraphicsDevice device)
+        {
+            NullGraphicsDevice* null_device = (NullGraphicsDevice*)device;
+            null_device->stats = NullBackendStats();
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+
+namespace null_backend
+{
+    namespace graphics_pipeline
+    {
+        GraphicsPipeline create_graphics_pipeline(GraphicsDevice graphicsDevice, const GraphicsPipelineDescriptor& graphicsPipelineDescriptor)
+        {
+            // Nothing is compiled, the pipeline only tracks its bindings
+            NullGraphicsDevice* deviceI = (NullGraphicsDevice*)graphicsDevice;
+            NullGraphicsPipeline* null_gp = new NullGraphicsPipeline();
+            null_gp->deviceI = deviceI;
+            null_gp->filename = graphicsPipelineDescriptor.filename;
+            null_gp->stencilRef = graphicsPipelineDescriptor.depthStencilState.stencilRef;
+            deviceI->allocatedGP++;
+            return (GraphicsPipeline)null_gp;
+        }
+
+        void destroy_graphics_pipeline(GraphicsPipeline graphicsPipeline)
+        {
+            NullGraphicsPipeline* null_gp = (NullGraphicsPipeline*)graphicsPipeline;
+            null_gp->deviceI->allocatedGP--;
+            delete null_gp;
+        }
+
+        void set_stencil_ref(GraphicsPipeline graphicsPipeline, uint8_t stencilRef)
+        {
+            NullGraphicsPipeline* null_gp = (NullGraphicsPipeline*)graphicsPipeline;
+            null_gp->stencilRef = stencilRef;
+        }
+    }
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+#include "null/null_helpers.h"
+#include "tools/security.h"
+
+// System includes
+#include <algorithm>
+#include <string.h>
+
+namespace null_backend
+{
+    namespace resources
+    {
+        // Sampler
+        Sampler create_sampler(GraphicsDevice graphicsDevice, const SamplerDescriptor& smplDesc)
+        {
+            NullGraphicsDevice* deviceI = (NullGraphicsDevice*)graphicsDevice;
+            NullSampler* null_sampler = new NullSampler();
+            null_sampler->deviceI = deviceI;
+            null_sampler->descriptor = smplDesc;
+            deviceI->allocatedSamplers++;
+            return (Sampler)null_sampler;
+        }
+
+        void destroy_sampler(Sampler sampler)
+        {
+            NullSampler* null_sampler = (NullSampler*)sampler;
+            null_sampler->deviceI->allocatedSamplers--;
+            delete null_sampler;
+        }
+
+        // Texture
+        Texture create_texture(GraphicsDevice graphicsDevice, TextureType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipCount, bool isUAV, TextureFormat format, float4 clearColor, const char* debugName)
+        {
+            TextureDescriptor texDescriptor;
+            texDescriptor.type = type;
+            texDescriptor.width = width;
+            texDescriptor.height = height;
+            texDescriptor.depth = depth;
+            texDescriptor.mipCount = mipCount;
+            texDescriptor.isUAV = isUAV;
+            texDescriptor.format = format;
+            texDescriptor.clearColor = clearColor;
+            texDescriptor.debugName = debugName;
+            return create_texture(graphicsDevice, texDescriptor);
+        }
+
+        Texture create_texture(GraphicsDevice graphicsDevice, const TextureDescriptor& texDesc)
+        {
+            NullGraphicsDevice* deviceI = (NullGraphicsDevice*)graphicsDevice;
+            NullTexture* null_texture = new NullTexture();
+            null_texture->deviceI = deviceI;
+            null_texture->type = texDesc.type;
+            null_texture->width = texDesc.width;
+            null_texture->height = texDesc.height;
+            null_texture->depth = texDesc.depth;
+            null_texture->mipLevels = std::max(texDesc.mipCount, 1u);
+            null_texture->format = texDesc.format;
+            null_texture->isUAV = texDesc.isUAV;
+
+            // Lay out the subresources, slice major
+            const uint32_t numSlices = texture_slice_count(texDesc.type, texDesc.depth);
+            const bool volume = texDesc.type == TextureType::Tex3D;
+            uint64_t offset = 0;
+            for (uint32_t sliceIdx = 0; sliceIdx < numSlices; ++sliceIdx)
+            {
+                for (uint32_t mipIdx = 0; mipIdx < null_texture->mipLevels; ++mipIdx)
+                {
+                    const uint32_t mipWidth = std::max(texDesc.width >> mipIdx, 1u);
+                    const uint32_t mipHeight = std::max(texDesc.height >> mipIdx, 1u);
+                    const uint32_t mipDepth = volume ? std::max(texDesc.depth >> mipIdx, 1u) : 1;
+                    const uint64_t size = texture_region_size(texDesc.format, mipWidth, mipHeight, mipDepth);
+                    null_texture->subresourceOffsets.push_back(offset);
+                    null_texture->subresourceSizes.push_back(size);
+                    offset += size;
+                }
+            }
+            null_texture->data.resize(offset);
+
+            // Stats
+            deviceI->allocatedTextures++;
+            deviceI->allocatedMemory += offset;
+            return (Texture)null_texture;
+        }
+
+        void destroy_texture(Texture texture)
+        {
+            NullTexture* null_texture = (NullTexture*)texture;
+            null_texture->deviceI->allocatedTextures--;
+            null_texture->deviceI->allocatedMemory -= null_texture->data.size();
+            delete null_texture;
+        }
+
+        void texture_dimensions(Texture texture, uint32_t& width, uint32_t& height, uint32_t& depth)
+        {
+            NullTexture* null_texture = (NullTexture*)texture;
+            width = null_texture->width;
+            height = null_texture->height;
+            depth = null_texture->depth;
+        }
+
+        // Render Texture, same host storage as the textures
+        RenderTexture create_render_texture(GraphicsDevice graphicsDevice, TextureType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipCount, bool isUAV, TextureFormat format, float4 clearColor, const char* debugName)
+        {
+            return (RenderTexture)create_texture(graphicsDevice, type, width, height, depth, mipCount, isUAV, format, clearColor, debugName);
+        }
+
+        RenderTexture create_render_texture(GraphicsDevice graphicsDevice, const TextureDescriptor& rtDesc)
+        {
+            return (RenderTexture)create_texture(graphicsDevice, rtDesc);
+        }
+
+        void destroy_render_texture(RenderTexture renderTexture)
+        {
+            destroy_texture((Texture)renderTexture);
+        }
+
+        void render_texture_dimensions(RenderTexture renderTexture, uint32_t& width, uint32_t& height, uint32_t& depth)
+        {
+            texture_dimensions((Texture)renderTexture, width, height, depth);
+        }
+
+        // Graphics Buffer
+        GraphicsBuffer create_graphics_buffer(GraphicsDevice graphicsDevice, uint64_t bufferSize, uint32_t elementSize, GraphicsBufferType bufferType, uint32_t)
+        {
+            NullGraphicsDevice* deviceI = (NullGraphicsDevice*)graphicsDevice;
+            NullGraphicsBuffer* null_buffer = new NullGraphicsBuffer();
+            null_buffer->deviceI = deviceI;
+            null_buffer->type = bufferType;
+            null_buffer->bufferSize = bufferSize;
+            null_buffer->elementSize = elementSize;
+            null_buffer->data.resize(bufferSize);
+
+            // Stats
+            deviceI->allocatedBuffers++;
+            deviceI->allocatedMemory += bufferSize;
+            return (GraphicsBuffer)null_buffer;
+        }
+
+        void destroy_graphics_buffer(GraphicsBuffer graphicsBuffer)
+        {
+            NullGraphicsBuffer* null_buffer = (NullGraphicsBuffer*)graphicsBuffer;
+            null_buffer->deviceI->allocatedBuffers--;
+            null_buffer->deviceI->allocatedMemory -= null_buffer->bufferSize;
+            delete null_buffer;
+        }
+
+        void set_buffer_data(GraphicsBuffer graphicsBuffer, const char* buffer, uint64_t bufferSize, uint32_t bufferOffset)
+        {
+            NullGraphicsBuffer* null_buffer = (NullGraphicsBuffer*)graphicsBuffer;
+            assert_msg(null_buffer->type == GraphicsBufferType::Upload, "Only upload buffers can be written by the CPU.");
+            assert_msg(bufferOffset + bufferSize <= null_buffer->bufferSize, "Write out of the bounds of the buffer.");
+            memcpy(null_buffer->data.data() + bufferOffset, buffer, bufferSize);
+        }
+
+        char* allocate_cpu_buffer(GraphicsBuffer graphicsBuffer)
+        {
+            NullGraphicsBuffer* null_buffer = (NullGraphicsBuffer*)graphicsBuffer;
+            assert_msg(null_buffer->type == GraphicsBufferType::Upload || null_buffer->type == GraphicsBufferType::Readback, "Only upload and readback buffers can be mapped.");
+            return null_buffer->data.data();
+        }
+
+        void release_cpu_buffer(GraphicsBuffer)
+        {
+        }
+
+        void set_buffer_debug_name(GraphicsBuffer, const char*)
+        {
+        }
+
+        // Constant Buffer
+        ConstantBuffer create_constant_buffer(GraphicsDevice graphicsDevice, uint32_t elementSize, ConstantBufferType)
+        {
+            NullConstantBuffer* null_cb = new NullConstantBuffer();
+            null_cb->deviceI = (NullGraphicsDevice*)graphicsDevice;
+            null_cb->data.resize(elementSize);
+            return (ConstantBuffer)null_cb;
+        }
+
+        void destroy_constant_buffer(ConstantBuffer constantBuffer)
+        {
+            NullConstantBuffer* null_cb = (NullConstantBuffer*)constantBuffer;
+            delete null_cb;
+        }
+
+        void set_constant_buffer(ConstantBuffer constantBuffer, const char* bufferData, uint32_t bufferSize)
+        {
+            NullConstantBuffer* null_cb = (NullConstantBuffer*)constantBuffer;
+            assert_msg(bufferSize <= null_cb->data.size(), "Write out of the bounds of the constant buffer.");
+            memcpy(null_cb->data.data(), bufferData, bufferSize);
+        }
+
+        // BLAS
+        BottomLevelAS create_blas(GraphicsDevice device, GraphicsBuffer, uint32_t, GraphicsBuffer, uint32_t, uint32_t)
+        {
+            NullAccelerationStructure* null_as = new NullAccelerationStructure();
+            null_as->deviceI = (NullGraphicsDevice*)device;
+            return (BottomLevelAS)null_as;
+        }
+
+        void destroy_blas(BottomLevelAS blas)
+        {
+            NullAccelerationStructure* null_as = (NullAccelerationStructure*)blas;
+            delete null_as;
+        }
+
+        // TLAS
+        TopLevelAS create_tlas(GraphicsDevice device, uint32_t numBLAS)
+        {
+            NullAccelerationStructure* null_as = new NullAccelerationStructure();
+            null_as->deviceI = (NullGraphicsDevice*)device;
+            null_as->instances.resize(numBLAS);
+            return (TopLevelAS)null_as;
+        }
+
+        void destroy_tlas(TopLevelAS tlas)
+        {
+            NullAccelerationStructure* null_as = (NullAccelerationStructure*)tlas;
+            delete null_as;
+        }
+
+        void set_tlas_instance(TopLevelAS tlas, BottomLevelAS blas, uint32_t index)
+        {
+            NullAccelerationStructure* null_as = (NullAccelerationStructure*)tlas;
+            null_as->instances[index] = blas;
+        }
+
+        void upload_tlas_instance_data(TopLevelAS)
+        {
+        }
+    }
+}
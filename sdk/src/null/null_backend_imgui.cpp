@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// SDK includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+#include "null/null_helpers.h"
+#include "imgui/imgui.h"
+
+namespace null_backend
+{
+    namespace imgui
+    {
+        bool initialize_imgui(GraphicsDevice, RenderWindow window, TextureFormat)
+        {
+            // Create the context
+            ImGui::CreateContext();
+            ImGuiIO& io = ImGui::GetIO();
+            uint2 size;
+            window::viewport_size(window, size);
+            io.DisplaySize = ImVec2((float)size.x, (float)size.y);
+
+            // The font atlas has to be built before the first frame
+            unsigned char* pixels = nullptr;
+            int width = 0, height = 0;
+            io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+            // Set the style
+            ImGui::StyleColorsClassic();
+            return true;
+        }
+
+        void release_imgui()
+        {
+            ImGui::DestroyContext();
+        }
+
+        void start_frame()
+        {
+            ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+            ImGui::NewFrame();
+        }
+
+        void end_frame()
+        {
+            ImGui::Render();
+        }
+
+        void draw_frame(CommandBuffer cmd, RenderTexture renderTexture)
+        {
+            // The imgui pass of DX12 replaces the pipeline, root signature and heaps
+            state_tracker::invalidate(((NullCommandBuffer*)cmd)->state);
+
+            // One draw per command list of the UI
+            const ImDrawData* drawData = ImGui::GetDrawData();
+            for (int listIdx = 0; drawData != nullptr && listIdx < drawData->CmdListsCount; ++listIdx)
+            {
+                NullCommand command;
+                command.type = NullCommandType::Draw;
+                command.resource1 = renderTexture;
+                command.params[0] = (uint32_t)drawData->CmdLists[listIdx]->IdxBuffer.Size / 3;
+                command.params[1] = 1;
+                record_command((NullCommandBuffer*)cmd, command);
+            }
+        }
+
+        void handle_input(RenderWindow, const EventData&)
+        {
+        }
+    }
+}
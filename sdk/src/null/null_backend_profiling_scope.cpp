@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+
+namespace null_backend
+{
+    namespace profiling_scope
+    {
+        ProfilingScope create_profiling_scope(GraphicsDevice)
+        {
+            NullProfilingScope* null_scope = new NullProfilingScope();
+            return (ProfilingScope)null_scope;
+        }
+
+        void destroy_profiling_scope(ProfilingScope profilingScope)
+        {
+            NullProfilingScope* null_scope = (NullProfilingScope*)profilingScope;
+            delete null_scope;
+        }
+
+        uint64_t get_duration_us(ProfilingScope profilingScope, CommandQueue, CommandBufferType)
+        {
+            // CPU time spent recording the scope
+            NullProfilingScope* null_scope = (NullProfilingScope*)profilingScope;
+            return null_scope->durationUS;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+
+namespace null_backend
+{
+    namespace swap_chain
+    {
+        SwapChain create_swap_chain(RenderWindow window, GraphicsDevice graphicsDevice, CommandQueue, TextureFormat format)
+        {
+            // The back buffers are regular host render textures of the size of the window
+            uint2 size;
+            window::viewport_size(window, size);
+            NullSwapChain* null_swapChain = new NullSwapChain();
+            for (uint32_t bufferIdx = 0; bufferIdx < NULL_NUM_BACK_BUFFERS; ++bufferIdx)
+                null_swapChain->backBuffers[bufferIdx] = resources::create_render_texture(graphicsDevice, TextureType::Tex2D, size.x, size.y, 1, 1, false, format, { 0.0f, 0.0f, 0.0f, 0.0f }, "BackBuffer");
+            return (SwapChain)null_swapChain;
+        }
+
+        void destroy_swap_chain(SwapChain swapChain)
+        {
+            NullSwapChain* null_swapChain = (NullSwapChain*)swapChain;
+            for (uint32_t bufferIdx = 0; bufferIdx < NULL_NUM_BACK_BUFFERS; ++bufferIdx)
+                resources::destroy_render_texture(null_swapChain->backBuffers[bufferIdx]);
+            delete null_swapChain;
+        }
+
+        RenderTexture get_current_render_texture(SwapChain swapChain)
+        {
+            NullSwapChain* null_swapChain = (NullSwapChain*)swapChain;
+            return null_swapChain->backBuffers[null_swapChain->currentBackBuffer];
+        }
+
+        void present(SwapChain swapChain, CommandQueue)
+        {
+            NullSwapChain* null_swapChain = (NullSwapChain*)swapChain;
+            null_swapChain->currentBackBuffer = (null_swapChain->currentBackBuffer + 1) % NULL_NUM_BACK_BUFFERS;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_backend.h"
+#include "null/null_containers.h"
+
+namespace null_backend
+{
+    namespace window
+    {
+        RenderWindow create_window(GraphicsDevice, uint64_t, uint32_t width, uint32_t height, const char*)
+        {
+            NullWindow* null_window = new NullWindow();
+            null_window->width = width;
+            null_window->height = height;
+            return (RenderWindow)null_window;
+        }
+
+        void destroy_window(RenderWindow renderWindow)
+        {
+            NullWindow* null_window = (NullWindow*)renderWindow;
+            delete null_window;
+        }
+
+        void viewport_size(RenderWindow window, uint2& size)
+        {
+            NullWindow* null_window = (NullWindow*)window;
+            size = { null_window->width, null_window->height };
+        }
+
+        uint2 viewport_center(RenderWindow window)
+        {
+            NullWindow* null_window = (NullWindow*)window;
+            return { null_window->width / 2, null_window->height / 2 };
+        }
+
+        void viewport_bounds(RenderWindow window, uint4& bounds)
+        {
+            NullWindow* null_window = (NullWindow*)window;
+            bounds = { 0, 0, null_window->width, null_window->height };
+        }
+
+        void window_size(RenderWindow window, uint2& size)
+        {
+            viewport_size(window, size);
+        }
+
+        uint2 window_center(RenderWindow window)
+        {
+            return viewport_center(window);
+        }
+
+        void window_bounds(RenderWindow window, uint4& bounds)
+        {
+            viewport_bounds(window, bounds);
+        }
+
+        void handle_messages(RenderWindow)
+        {
+            // No message pump, every iteration of the loop draws a frame
+            event_collector::request_draw();
+        }
+
+        void show(RenderWindow)
+        {
+        }
+
+        void hide(RenderWindow)
+        {
+        }
+
+        void set_cursor_visibility(RenderWindow, bool)
+        {
+        }
+
+        void set_cursor_pos(RenderWindow, uint2)
+        {
+        }
+    }
+}
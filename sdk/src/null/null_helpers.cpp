@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Internal includes
+#include "null/null_helpers.h"
+#include "tools/security.h"
+
+namespace null_backend
+{
+    static uint32_t format_size(TextureFormat format)
+    {
+        switch (format)
+        {
+            case TextureFormat::R8_SNorm:
+            case TextureFormat::R8_UNorm:
+            case TextureFormat::R8_SInt:
+            case TextureFormat::R8_UInt:
+                return 1;
+            case TextureFormat::R8G8_SNorm:
+            case TextureFormat::R8G8_UNorm:
+            case TextureFormat::R8G8_SInt:
+            case TextureFormat::R8G8_UInt:
+            case TextureFormat::R16_Float:
+            case TextureFormat::R16_SInt:
+            case TextureFormat::R16_UInt:
+                return 2;
+            case TextureFormat::R8G8B8A8_SNorm:
+            case TextureFormat::R8G8B8A8_UNorm:
+            case TextureFormat::R8G8B8A8_UNorm_SRGB:
+            case TextureFormat::R8G8B8A8_UInt:
+            case TextureFormat::R8G8B8A8_SInt:
+            case TextureFormat::R16G16_Float:
+            case TextureFormat::R16G16_SInt:
+            case TextureFormat::R16G16_UInt:
+            case TextureFormat::R32_Float:
+            case TextureFormat::R32_SInt:
+            case TextureFormat::R32_UInt:
+            case TextureFormat::Depth32:
+            case TextureFormat::Depth24Stencil8:
+            case TextureFormat::R10G10B10A2_UNorm:
+            case TextureFormat::R10G10B10A2_UInt:
+            case TextureFormat::R11G11B10_Float:
+                return 4;
+            case TextureFormat::R16G16B16A16_Float:
+            case TextureFormat::R16G16B16A16_UInt:
+            case TextureFormat::R16G16B16A16_SInt:
+            case TextureFormat::R32G32_Float:
+            case TextureFormat::R32G32_SInt:
+            case TextureFormat::R32G32_UInt:
+            case TextureFormat::Depth32Stencil8:
+                return 8;
+            case TextureFormat::R32G32B32_UInt:
+            case TextureFormat::R32G32B32_Float:
+                return 12;
+            case TextureFormat::R32G32B32A32_Float:
+            case TextureFormat::R32G32B32A32_UInt:
+            case TextureFormat::R32G32B32A32_SInt:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    uint64_t texture_region_size(TextureFormat format, uint32_t width, uint32_t height, uint32_t depth)
+    {
+        // Block compressed formats store 4x4 blocks
+        if (format == TextureFormat::BC1_RGB || format == TextureFormat::BC6_RGB)
+        {
+            const uint64_t blockSize = format == TextureFormat::BC1_RGB ? 8 : 16;
+            return (uint64_t)((width + 3) / 4) * ((height + 3) / 4) * depth * blockSize;
+        }
+
+        const uint32_t texelSize = format_size(format);
+        assert_msg(texelSize != 0, "Unsupported texture format.");
+        return (uint64_t)width * height * depth * texelSize;
+    }
+
+    uint32_t texture_slice_count(TextureType type, uint32_t depth)
+    {
+        switch (type)
+        {
+            case TextureType::Tex1DArray:
+            case TextureType::Tex2DArray:
+                return depth;
+            case TextureType::TexCube:
+                return 6;
+            case TextureType::TexCubeArray:
+                return 6 * depth;
+            default:
+                return 1;
+        }
+    }
+
+    void record_command(NullCommandBuffer* cmdI, const NullCommand& command)
+    {
+        assert_msg(!cmdI->closed, "Recording in a closed command buffer.");
+        cmdI->commands.push_back(command);
+        cmdI->deviceI->stats.numCommands[(uint32_t)command.type]++;
+    }
+
+    uint32_t request_binding(std::vector<uint32_t>& bindings, std::vector<uint64_t>& boundResources, std::vector<uint64_t>& boundSubresources, BindingSlot slot)
+    {
+        // A handful of bindings per shader, a linear search is enough
+        for (uint32_t bindIdx = 0; bindIdx < (uint32_t)bindings.size(); ++bindIdx)
+        {
+            if (bindings[bindIdx] == slot.hash)
+                return bindIdx;
+        }
+        bindings.push_back(slot.hash);
+        boundResources.push_back(0);
+        boundSubresources.push_back(0);
+        return (uint32_t)bindings.size() - 1;
+    }
+
+    static void bind_tables(NullCommandBuffer* cmdI, StateBindPoint bindPoint, uint64_t pipelineState, NullDescriptorTables& tables)
+    {
+        // Every shader has its own root signature on DX12, the pipeline identifies both
+        state_tracker::set_pipeline_state(cmdI->state, pipelineState);
+        state_tracker::set_root_signature(cmdI->state, bindPoint, pipelineState);
+        state_tracker::set_descriptor_heaps(cmdI->state);
+
+        // Allocate a new range when the bindings changed or the previous one belongs to another recording
+        if (state_tracker::copy_descriptor_tables(cmdI->state, tables.recordingID, tables.dirty))
+        {
+            const uint64_t range = cmdI->deviceI->nextTableRange++;
+            for (uint32_t tableIdx = 0; tableIdx < STATE_TRACKER_MAX_TABLES; ++tableIdx)
+                tables.handles[tableIdx] = range * STATE_TRACKER_MAX_TABLES + tableIdx;
+            tables.dirty = false;
+        }
+
+        // Without reflection, the four tables are at their default root index
+        for (uint32_t tableIdx = 0; tableIdx < STATE_TRACKER_MAX_TABLES; ++tableIdx)
+            state_tracker::set_root_table(cmdI->state, bindPoint, tableIdx, tables.handles[tableIdx]);
+    }
+
+    void bind_compute_shader(NullCommandBuffer* cmdI, NullComputeShader* computeShader)
+    {
+        bind_tables(cmdI, StateBindPoint::Compute, (uint64_t)computeShader, computeShader->tables);
+    }
+
+    void bind_graphics_pipeline(NullCommandBuffer* cmdI, NullGraphicsPipeline* graphicsPipeline)
+    {
+        bind_tables(cmdI, StateBindPoint::Graphics, (uint64_t)graphicsPipeline, graphicsPipeline->tables);
+    }
+}
@@ -21,12 +21,40 @@
 
 // System includes
 #include <chrono>
+#include <filesystem>
+#include <future>
 #include <iostream>
 
 // Number of frames for our performance path
 #define NUM_PROFILING_FRAMES 50
 #define FRAME_BUFFER_FORMAT TextureFormat::R16G16B16A16_Float
 
+// Network outputs read by each debug view (offsets of common.hlsl)
+uint32_t debug_mode_channel_mask(DebugMode debugMode)
+{
+    switch (debugMode)
+    {
+        case DebugMode::Thickness:
+            return 1u << 12;
+        case DebugMode::Mask:
+            return 3u << 5;
+        case DebugMode::Displacement:
+            return 1u << 4;
+        case DebugMode::Metalness:
+            return 1u << 7;
+        case DebugMode::Roughness:
+            return 1u << 11;
+        case DebugMode::AmbientOcclusion:
+            return 1u << 0;
+        case DebugMode::Normal:
+            return 7u << 8;
+        case DebugMode::DiffuseColor:
+            return 7u << 1;
+        default:
+            return MLP_ALL_CHANNELS;
+    }
+}
+
 DinoRenderer::DinoRenderer()
 {
 }
@@ -53,7 +81,7 @@ void DinoRenderer::initialize(uint64_t hInstance, const CommandLineOptions& opti
     const std::string& pathLibrary = m_ProjectDir + "\\paths";
 
     // Create the graphics components
-    graphics::setup_graphics_api(GraphicsAPI::DX12);
+    graphics::setup_graphics_api(options.nullBackend ? GraphicsAPI::Null : GraphicsAPI::DX12);
     // graphics::device::enable_debug_layer();
     graphics::device::enable_experimental_features();
 
@@ -67,6 +95,7 @@ void DinoRenderer::initialize(uint64_t hInstance, const CommandLineOptions& opti
     m_CmdQueue = graphics::command_queue::create_command_queue(m_Device);
     m_SwapChain = graphics::swap_chain::create_swap_chain(m_Window, m_Device, m_CmdQueue, FRAME_BUFFER_FORMAT);
     m_CmdBuffer = graphics::command_buffer::create_command_buffer(m_Device);
+    m_UploadManager.initialize(m_Device, m_CmdQueue);
 
     // Coop vector support
     m_CooperativeVectorsSupported = graphics::device::feature_support(m_Device, GPUFeature::CoopVector);
@@ -86,6 +115,7 @@ void DinoRenderer::initialize(uint64_t hInstance, const CommandLineOptions& opti
     m_CameraController.move_to_poi(options.initialPOI);
 
     // Initial setup
+    m_MaxFrames = options.frameCount;
     m_RenderingMode = options.renderingMode;
     m_TextureMode = options.textureMode;
     m_DebugMode = DebugMode::TileInfo;
@@ -141,25 +171,37 @@ void DinoRenderer::initialize(uint64_t hInstance, const CommandLineOptions& opti
     }
 
     // Components
-    m_TSNC.initialize(m_Device, m_CooperativeVectorsSupported);
+    m_TSNC.initialize(m_Device, m_CooperativeVectorsSupported, options.featureTextures);
+
+    // Start reading the models while the other components initialize, the exported container is preferred over the directory layout
+    const std::string containerPath = modelLibrary + "\\michel\\michel.tsnc";
+    std::future<void> networkLoad = m_TSNC.reload_network_async(std::filesystem::exists(containerPath) ? containerPath : (modelLibrary + "\\michel\\bc1_mip"), 1);
     m_GBufferRenderer.initialize(m_Device, m_CooperativeVectorsSupported);
     m_MaterialRenderer.initialize(m_Device, m_CooperativeVectorsSupported);
-    m_MeshRenderer.initialize(m_Device, geometryLibrary + "\\michel.anim");
+    std::string animationPath = geometryLibrary + "\\michel.pcanim";
+    if (!std::filesystem::exists(animationPath))
+        animationPath = geometryLibrary + "\\michel.canim";
+    if (!std::filesystem::exists(animationPath))
+        animationPath = geometryLibrary + "\\michel.anim";
+    m_MeshRenderer.initialize(m_Device, animationPath, options.animationRingSize);
     m_IBL.initialize(m_Device, textureLibrary);
-    m_TexManager.initialize(m_Device);
+    m_TexManager.initialize(m_Device, modelLibrary, "michel", (uint64_t)options.textureBudget << 20);
     m_Classifier.initialize(m_Device, m_TileSizeI, 1);
 
-    // Load the models
-    m_TSNC.reload_network((modelLibrary + "\\michel\\bc1_mip"), 1);
+    // Create the GPU resources of the models
+    networkLoad.get();
+    m_TSNC.finish_reload_network();
 
     // Load the shaders
     reload_shaders();
 
-    // Upload to the GPU
-    m_TSNC.upload_network(m_CmdQueue, m_CmdBuffer);
-    m_MeshRenderer.upload_geometry(m_CmdQueue, m_CmdBuffer);
-    m_IBL.upload_textures(m_CmdQueue, m_CmdBuffer);
-    m_TexManager.upload_textures(m_CmdQueue, m_CmdBuffer, modelLibrary, "michel");
+    // Upload to the GPU in a single batch, the frames are executed after it on the same queue
+    m_TSNC.upload_network(m_UploadManager);
+    m_MeshRenderer.upload_geometry(m_UploadManager);
+    m_IBL.upload_textures(m_UploadManager);
+    if (m_TextureMode != TextureMode::Neural)
+        m_TexManager.request_texture_set(m_TextureMode, m_UploadManager);
+    m_UploadManager.submit();
 
     // Tools
     m_ProfilingHelper.initialize(m_Device, m_CmdQueue, 2);
@@ -242,6 +284,7 @@ void DinoRenderer::release()
     m_TexManager.release();
     m_ProfilingHelper.release();
     m_Classifier.release();
+    m_UploadManager.release();
 
     // Imgui
     graphics::imgui::release_imgui();
@@ -295,6 +338,9 @@ void DinoRenderer::render_ui(CommandBuffer cmdB, RenderTexture rt)
             imgui_dropdown_enum<DebugMode>(m_DebugMode, "Debug Mode", debug_mode_labels);
         }
 
+        // Texture residency
+        m_TexManager.render_ui();
+
         // Mesh renderer
         m_MeshRenderer.render_ui();
 
@@ -360,6 +406,7 @@ void DinoRenderer::update_constant_buffers(CommandBuffer cmdB)
     globalCB._TileSize = m_TileSizeI;
     globalCB._ChannelSet = (uint32_t)m_DebugMode;
     globalCB._AnimationFactor = m_MeshRenderer.interpolation_factor();
+    globalCB._AnimationFrames = m_MeshRenderer.animation_frames();
     globalCB._AnimationTime = m_MeshRenderer.animation_time();
     globalCB._MeshNumVerts = m_MeshRenderer.num_vertices();
     globalCB._EnablePP = m_RenderingMode != RenderingMode::Debug ? 1.0f : 0.0f;
@@ -377,11 +424,24 @@ void DinoRenderer::update_constant_buffers(CommandBuffer cmdB)
 
 void DinoRenderer::render_frame()
 {
+    // Debug views only evaluate the channels they display
+    m_GBufferRenderer.set_channel_mask(m_RenderingMode == RenderingMode::Debug ? debug_mode_channel_mask(m_DebugMode) : MLP_ALL_CHANNELS);
+
+    // Make the texture set of the mode resident, a first use is uploaded ahead of the frame on the same queue
+    if (m_TextureMode != TextureMode::Neural)
+    {
+        m_TexManager.request_texture_set(m_TextureMode, m_UploadManager);
+        m_UploadManager.submit();
+    }
+
     // Reset the command buffer
     graphics::command_buffer::reset(m_CmdBuffer);
     if (m_EnableCounters)
         m_ProfilingHelper.start_profiling(m_CmdBuffer, 0);
 
+    // Key frames of the skinning, selected in the constant buffers
+    m_MeshRenderer.stream_animation(m_CmdBuffer);
+
     // Update the constant buffers
     update_constant_buffers(m_CmdBuffer);
 
@@ -409,16 +469,16 @@ void DinoRenderer::render_frame()
     graphics::command_buffer::start_section(m_CmdBuffer, "Trace shadows");
     {
         // CBVs
-        graphics::command_buffer::set_compute_shader_cbuffer(m_CmdBuffer, m_ShadowRTCS, "_GlobalCB", m_GlobalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(m_CmdBuffer, m_ShadowRTCS, binding_slot("_GlobalCB"), m_GlobalCB);
 
         // SRVs
-        graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_ShadowRTCS, "_VisibilityBuffer", m_VisibilityBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_ShadowRTCS, "_VertexBuffer", m_MeshRenderer.vertex_buffer());
-        graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_ShadowRTCS, "_IndexBuffer", m_MeshRenderer.index_buffer());
-        graphics::command_buffer::set_compute_shader_rtas(m_CmdBuffer, m_ShadowRTCS, "_SceneRTAS", m_MeshRenderer.tlas());
+        graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_ShadowRTCS, binding_slot("_VisibilityBuffer"), m_VisibilityBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_ShadowRTCS, binding_slot("_VertexBuffer"), m_MeshRenderer.vertex_buffer());
+        graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_ShadowRTCS, binding_slot("_IndexBuffer"), m_MeshRenderer.index_buffer());
+        graphics::command_buffer::set_compute_shader_rtas(m_CmdBuffer, m_ShadowRTCS, binding_slot("_SceneRTAS"), m_MeshRenderer.tlas());
 
         // UAVs
-        graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_ShadowRTCS, "_ShadowTextureRW", m_ShadowTexture);
+        graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_ShadowRTCS, binding_slot("_ShadowTextureRW"), m_ShadowTexture);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch(m_CmdBuffer, m_ShadowRTCS, m_TileSizeI.x, m_TileSizeI.y, 1);
@@ -451,7 +511,7 @@ void DinoRenderer::render_frame()
             else
             {
                 // Grab the right texture set
-                const TextureSet& texSet = m_TexManager.texture_set(m_TextureMode == TextureMode::BC6H);
+                const TextureSet& texSet = m_TexManager.texture_set(m_TextureMode);
 
                 //  GBuffer generation
                 if (m_EnableCounters)
@@ -475,21 +535,23 @@ void DinoRenderer::render_frame()
                 case RenderingMode::Debug:
                 {
                     // CBVs
-                    graphics::command_buffer::set_compute_shader_cbuffer(m_CmdBuffer, m_DebugViewCS, "_GlobalCB", m_GlobalCB);
+                    graphics::command_buffer::set_compute_shader_cbuffer(m_CmdBuffer, m_DebugViewCS, binding_slot("_GlobalCB"), m_GlobalCB);
 
                     // SRVs
-                    graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_DebugViewCS, "_VisibilityBuffer", m_VisibilityBuffer);
-                    graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_DebugViewCS, "_InferenceBuffer", m_GBuffer);
-                    graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_DebugViewCS, "_IndexationBuffer", m_Classifier.active_tiles_buffer());
+                    graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_DebugViewCS, binding_slot("_VisibilityBuffer"), m_VisibilityBuffer);
+                    graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_DebugViewCS, binding_slot("_InferenceBuffer"), m_GBuffer);
+                    graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, m_DebugViewCS, binding_slot("_IndexationBuffer"), m_Classifier.active_tiles_buffer());
 
                     // UAVs
-                    graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_DebugViewCS, "_ColorTextureRW", m_ColorTexture);
+                    graphics::command_buffer::set_compute_shader_render_texture(m_CmdBuffer, m_DebugViewCS, binding_slot("_ColorTextureRW"), m_ColorTexture);
 
                     // Dispatch + Barrier
                     graphics::command_buffer::dispatch_indirect(m_CmdBuffer, m_DebugViewCS, m_Classifier.indirect_buffer());
                     graphics::command_buffer::uav_barrier_render_texture(m_CmdBuffer, m_ColorTexture);
                 }
                 break;
+                default:
+                break;
             }
         }
         break;
@@ -515,7 +577,7 @@ void DinoRenderer::render_frame()
             else
             {
                 // Grab the right texture set
-                const TextureSet& texSet = m_TexManager.texture_set(m_TextureMode == TextureMode::BC6H);
+                const TextureSet& texSet = m_TexManager.texture_set(m_TextureMode);
 
                 // GBuffer generation
                 if (m_EnableCounters)
@@ -527,6 +589,8 @@ void DinoRenderer::render_frame()
             }
         }
         break;
+        default:
+        break;
     }
     if (m_EnableCounters)
         m_ProfilingHelper.end_profiling(m_CmdBuffer, 0);
@@ -539,8 +603,8 @@ void DinoRenderer::render_frame()
     {
         graphics::command_buffer::set_viewport(m_CmdBuffer, 0, 0, m_ScreenSizeI.x, m_ScreenSizeI.y);
         graphics::command_buffer::set_render_texture(m_CmdBuffer, rTexture);
-        graphics::command_buffer::set_graphics_pipeline_cbuffer(m_CmdBuffer, m_UberPostGP, "_GlobalCB", m_GlobalCB);
-        graphics::command_buffer::set_graphics_pipeline_render_texture(m_CmdBuffer, m_UberPostGP, "_ColorTextureIn", m_ColorTexture);
+        graphics::command_buffer::set_graphics_pipeline_cbuffer(m_CmdBuffer, m_UberPostGP, binding_slot("_GlobalCB"), m_GlobalCB);
+        graphics::command_buffer::set_graphics_pipeline_render_texture(m_CmdBuffer, m_UberPostGP, binding_slot("_ColorTextureIn"), m_ColorTexture);
         graphics::command_buffer::draw_procedural(m_CmdBuffer, m_UberPostGP, 1, 1);
     }
     graphics::command_buffer::end_section(m_CmdBuffer);
@@ -562,6 +626,9 @@ void DinoRenderer::render_frame()
 
     // Flush the queue
     graphics::command_queue::flush(m_CmdQueue);
+
+    // The staging memory of the completed uploads can be reused
+    m_UploadManager.retire_batches();
 }
 
 
@@ -644,6 +711,11 @@ void DinoRenderer::render_loop()
             render_frame();
             m_FrameIndex++;
             event_collector::draw_done();
+
+            // Benchmark runs stop after a fixed number of frames
+            m_NumRenderedFrames++;
+            if (m_MaxFrames != 0 && m_NumRenderedFrames >= m_MaxFrames)
+                activeLoop = false;
         }
 
         // Query the time
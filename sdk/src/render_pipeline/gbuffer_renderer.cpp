@@ -10,7 +10,6 @@
 #include "render_pipeline/gbuffer_renderer.h"
 #include "tools/security.h"
 #include "tools/shader_utils.h"
-#include "tools/gpu_helpers.h"
 
 GBufferRenderer::GBufferRenderer()
 {
@@ -45,6 +44,11 @@ void GBufferRenderer::release()
     graphics::compute_shader::destroy_compute_shader(m_TextureCS);
     graphics::compute_shader::destroy_compute_shader(m_FMABC1CS);
     graphics::compute_shader::destroy_compute_shader(m_FMABC1_Repacked_CS);
+    if (m_FMABC1_Channels_CS != 0)
+    {
+        graphics::compute_shader::destroy_compute_shader(m_FMABC1_Channels_CS);
+        graphics::compute_shader::destroy_compute_shader(m_FMABC1_Channels_Repacked_CS);
+    }
     if (m_CoopVectors)
     {
         graphics::compute_shader::destroy_compute_shader(m_CVBC1CS);
@@ -55,6 +59,10 @@ void GBufferRenderer::release()
 
 void GBufferRenderer::reload_shaders(const std::string& shaderLibrary, const std::vector<std::string>& shaderDefines)
 {
+    // Keep track of the configuration
+    m_ShaderLibrary = shaderLibrary;
+    m_ShaderDefines = shaderDefines;
+
     // Texture sampling
     {
         ComputeShaderDescriptor csd;
@@ -98,6 +106,10 @@ void GBufferRenderer::reload_shaders(const std::string& shaderLibrary, const std
         compile_and_replace_compute_shader(m_Device, csd, m_CVBC1_Repacked_CS, true);
     }
 
+    // Channel subset inference
+    if (m_ChannelMask != MLP_ALL_CHANNELS)
+        compile_channel_shaders();
+
     // Deferred lighting
     {
         ComputeShaderDescriptor csd;
@@ -107,42 +119,70 @@ void GBufferRenderer::reload_shaders(const std::string& shaderLibrary, const std
     }
 }
 
+void GBufferRenderer::compile_channel_shaders()
+{
+    ComputeShaderDescriptor csd;
+    csd.includeDirectories.push_back(m_ShaderLibrary);
+    csd.defines.insert(csd.defines.end(), m_ShaderDefines.begin(), m_ShaderDefines.end());
+    csd.filename = m_ShaderLibrary + "\\GBuffer\\Inference.compute";
+    csd.defines.push_back("LS_BC1_COMPRESSION");
+    csd.defines.push_back(std::string("MLP_CHANNEL_MASK ") + std::to_string(m_ChannelMask));
+
+    // BC1 version
+    csd.kernelname = "main";
+    compile_and_replace_compute_shader(m_Device, csd, m_FMABC1_Channels_CS);
+
+    csd.kernelname = "main_repacked";
+    compile_and_replace_compute_shader(m_Device, csd, m_FMABC1_Channels_Repacked_CS);
+}
+
+void GBufferRenderer::set_channel_mask(uint32_t channelMask)
+{
+    if (channelMask == m_ChannelMask)
+        return;
+    m_ChannelMask = channelMask;
+    if (m_ChannelMask != MLP_ALL_CHANNELS)
+        compile_channel_shaders();
+}
+
 void GBufferRenderer::evaluate_indirect(CommandBuffer cmdB, ConstantBuffer globalCB, 
     GraphicsBuffer visibilityBuffer, GraphicsBuffer indexationBuffer, GraphicsBuffer indirectBuffer, GraphicsBuffer outputBuffer,
     const TextureSet& texSet, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, FilteringMode filteringMode)
 {
     // CBVs
-    graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_TextureCS, "_GlobalCB", globalCB);
+    graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_TextureCS, binding_slot("_GlobalCB"), globalCB);
 
     // Common buffers
-    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TextureCS, "_VisibilityBuffer", visibilityBuffer);
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, "_TileBuffer", indexationBuffer);
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, "_VertexBuffer", vertexBuffer);
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, "_IndexBuffer", indexBuffer);
+    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TextureCS, binding_slot("_VisibilityBuffer"), visibilityBuffer);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, binding_slot("_TileBuffer"), indexationBuffer);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, binding_slot("_VertexBuffer"), vertexBuffer);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, binding_slot("_IndexBuffer"), indexBuffer);
 
     // Texture materials
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, "_Texture0", texSet.tex0);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, "_Texture1", texSet.tex1);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, "_Texture2", texSet.tex2);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, "_Texture3", texSet.tex3);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, "_Texture4", texSet.tex4);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, binding_slot("_Texture0"), texSet.tex0);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, binding_slot("_Texture1"), texSet.tex1);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, binding_slot("_Texture2"), texSet.tex2);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, binding_slot("_Texture3"), texSet.tex3);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TextureCS, binding_slot("_Texture4"), texSet.tex4);
 
     // Sampler
     switch (filteringMode)
     {
         case FilteringMode::Nearest:
-            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TextureCS, "s_texture_sampler", m_NearestSampler);
+            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TextureCS, binding_slot("s_texture_sampler"), m_NearestSampler);
         break;
         case FilteringMode::Linear:
-            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TextureCS, "s_texture_sampler", m_LinearSampler);
+            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TextureCS, binding_slot("s_texture_sampler"), m_LinearSampler);
         break;
         case FilteringMode::Anisotropic:
-            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TextureCS, "s_texture_sampler", m_AnisoSampler);
+            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TextureCS, binding_slot("s_texture_sampler"), m_AnisoSampler);
+        break;
+        default:
         break;
     }
 
     // Output buffer
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, "_OutputBufferRW", outputBuffer);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TextureCS, binding_slot("_OutputBufferRW"), outputBuffer);
 
     // Dispatch + Barrier
     graphics::command_buffer::dispatch_indirect(cmdB, m_TextureCS, indirectBuffer);
@@ -159,45 +199,61 @@ void GBufferRenderer::partial_inference(CommandBuffer cmdB, ComputeShader target
     if (targetCS != 0)
     {
         // Constant buffers
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, targetCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, targetCS, binding_slot("_GlobalCB"), globalCB);
 
         // Common buffers
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, "_VisibilityBuffer", visibilityBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_TileBuffer", tileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_VertexBuffer", vertexBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_IndexBuffer", indexBuffer);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, binding_slot("_VisibilityBuffer"), visibilityBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_TileBuffer"), tileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_VertexBuffer"), vertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_IndexBuffer"), indexBuffer);
 
         // Latent Space
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS0Texture", gpuNwk.tex0);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS1Texture", gpuNwk.tex1);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS2Texture", gpuNwk.tex2);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS3Texture", gpuNwk.tex3);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_UVOffsetBuffer", network.uv_offset_buffer());
+        if (network.feature_textures_enabled())
+        {
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature0Texture"), gpuNwk.feature0);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature1Texture"), gpuNwk.feature1);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature2Texture"), gpuNwk.feature2);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature3Texture"), gpuNwk.feature3);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_FeatureLayer0Buffer"), gpuNwk.featureLayer0Buffer);
+        }
+        else
+        {
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS0Texture"), gpuNwk.tex0);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS1Texture"), gpuNwk.tex1);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS2Texture"), gpuNwk.tex2);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS3Texture"), gpuNwk.tex3);
+        }
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_UVOffsetBuffer"), network.uv_offset_buffer());
 
         // Sampler
         switch (filteringMode)
         {
             case FilteringMode::Nearest:
-                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "bc1_linear_clamp_sampler", m_NearestSampler);
+                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("bc1_linear_clamp_sampler"), m_NearestSampler);
                 break;
             case FilteringMode::Linear:
-                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "bc1_linear_clamp_sampler", m_LinearSampler);
+                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("bc1_linear_clamp_sampler"), m_LinearSampler);
                 break;
             case FilteringMode::Anisotropic:
-                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "bc1_linear_clamp_sampler", m_AnisoSampler);
+                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("bc1_linear_clamp_sampler"), m_AnisoSampler);
+                break;
+            default:
                 break;
         }
 
         // MLPs
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPWeight0Buffer", useCoopVectors ? gpuNwk.mlp.weight0OptimalBuffer : gpuNwk.mlp.weight0Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPBias0Buffer", gpuNwk.mlp.bias0Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPWeight1Buffer", useCoopVectors ? gpuNwk.mlp.weight1OptimalBuffer : gpuNwk.mlp.weight1Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPBias1Buffer", gpuNwk.mlp.bias1Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPWeight2Buffer", useCoopVectors ? gpuNwk.mlp.weight2OptimalBuffer : gpuNwk.mlp.weight2Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPBias2Buffer", gpuNwk.mlp.bias2Buffer);
+        if (!network.feature_textures_enabled())
+        {
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPWeight0Buffer"), useCoopVectors ? gpuNwk.mlp.weight0OptimalBuffer : gpuNwk.mlp.weight0Buffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPBias0Buffer"), gpuNwk.mlp.bias0Buffer);
+        }
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPWeight1Buffer"), useCoopVectors ? gpuNwk.mlp.weight1OptimalBuffer : gpuNwk.mlp.weight1Buffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPBias1Buffer"), gpuNwk.mlp.bias1Buffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPWeight2Buffer"), useCoopVectors ? gpuNwk.mlp.weight2OptimalBuffer : gpuNwk.mlp.weight2Buffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPBias2Buffer"), gpuNwk.mlp.bias2Buffer);
 
         // Output buffer
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_OutputBufferRW", outputBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_OutputBufferRW"), outputBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch_indirect(cmdB, targetCS, classifier.indirect_buffer(), indirectOffset);
@@ -208,14 +264,17 @@ void GBufferRenderer::partial_inference(CommandBuffer cmdB, ComputeShader target
 void GBufferRenderer::evaluate_neural_cmp_indirect(CommandBuffer cmdB, ConstantBuffer globalCB, GraphicsBuffer visibilityBuffer, GraphicsBuffer vertexBuffer, GraphicsBuffer indexBuffer, GraphicsBuffer outputBuffer,
     const TileClassifier& classifier, bool useCoopVectors, const TSNC& network, FilteringMode filteringMode)
 {
+    // The channel subset is only available without cooperative vectors
+    const bool channelSubset = !useCoopVectors && m_ChannelMask != MLP_ALL_CHANNELS;
+
     // Uniform inference
-    ComputeShader uniformCS = useCoopVectors ? m_CVBC1CS : m_FMABC1CS;
+    ComputeShader uniformCS = useCoopVectors ? m_CVBC1CS : (channelSubset ? m_FMABC1_Channels_CS : m_FMABC1CS);
     graphics::command_buffer::start_section(cmdB, "Uniform inference");
     partial_inference(cmdB, uniformCS, 3 * sizeof(uint32_t), classifier.uniform_tiles_buffer(), globalCB, visibilityBuffer, vertexBuffer, indexBuffer, outputBuffer, classifier, useCoopVectors, network, filteringMode);
     graphics::command_buffer::end_section(cmdB);
 
     // Repacked inference
-    ComputeShader repackedCS = useCoopVectors ? m_CVBC1_Repacked_CS : m_FMABC1_Repacked_CS;
+    ComputeShader repackedCS = useCoopVectors ? m_CVBC1_Repacked_CS : (channelSubset ? m_FMABC1_Channels_Repacked_CS : m_FMABC1_Repacked_CS);
     graphics::command_buffer::start_section(cmdB, "Repacked inference");
     partial_inference(cmdB, repackedCS, 9 * sizeof(uint32_t), classifier.repacked_tiles_buffer(), globalCB, visibilityBuffer, vertexBuffer, indexBuffer, outputBuffer, classifier, useCoopVectors, network, filteringMode);
     graphics::command_buffer::end_section(cmdB);
@@ -229,26 +288,26 @@ void GBufferRenderer::lighting_indirect(CommandBuffer cmdB, ConstantBuffer globa
     graphics::command_buffer::start_section(cmdB, "Deferred Lighting");
     {
         // CBV
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_DeferredLightingCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_DeferredLightingCS, binding_slot("_GlobalCB"), globalCB);
 
         // Input buffers
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_DeferredLightingCS, "_VisibilityBuffer", visibilityBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, "_InferenceBuffer", gbuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, "_TileBuffer", tileBuffer);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, m_DeferredLightingCS, "_PreIntegratedFGDTexture", ibl.pre_integrated_fgd());
-        graphics::command_buffer::set_compute_shader_texture(cmdB, m_DeferredLightingCS, "_ConvolvedIBLTexture", ibl.convolved_ggx_ibl());
-        graphics::command_buffer::set_compute_shader_texture(cmdB, m_DeferredLightingCS, "_IndirectDiffuseTexture", ibl.convolved_lambert_ibl());
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, "_VertexBuffer", vertexBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, "_IndexBuffer", indexBuffer);
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_DeferredLightingCS, "_ShadowTexture", shadowTexture);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_DeferredLightingCS, binding_slot("_VisibilityBuffer"), visibilityBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, binding_slot("_InferenceBuffer"), gbuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, binding_slot("_TileBuffer"), tileBuffer);
+        graphics::command_buffer::set_compute_shader_texture(cmdB, m_DeferredLightingCS, binding_slot("_PreIntegratedFGDTexture"), ibl.pre_integrated_fgd());
+        graphics::command_buffer::set_compute_shader_texture(cmdB, m_DeferredLightingCS, binding_slot("_ConvolvedIBLTexture"), ibl.convolved_ggx_ibl());
+        graphics::command_buffer::set_compute_shader_texture(cmdB, m_DeferredLightingCS, binding_slot("_IndirectDiffuseTexture"), ibl.convolved_lambert_ibl());
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, binding_slot("_VertexBuffer"), vertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DeferredLightingCS, binding_slot("_IndexBuffer"), indexBuffer);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_DeferredLightingCS, binding_slot("_ShadowTexture"), shadowTexture);
 
         // Output buffer
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_DeferredLightingCS, "_ColorTextureRW", colorTexture);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_DeferredLightingCS, binding_slot("_ColorTextureRW"), colorTexture);
 
         // Samplers
-        graphics::command_buffer::set_compute_shader_sampler(cmdB, m_DeferredLightingCS, "s_fgd_sampler", ibl.fgd_sampler());
-        graphics::command_buffer::set_compute_shader_sampler(cmdB, m_DeferredLightingCS, "s_ggx_sampler", ibl.ggx_sampler());
-        graphics::command_buffer::set_compute_shader_sampler(cmdB, m_DeferredLightingCS, "s_lambert_sampler", ibl.lambert_sampler());
+        graphics::command_buffer::set_compute_shader_sampler(cmdB, m_DeferredLightingCS, binding_slot("s_fgd_sampler"), ibl.fgd_sampler());
+        graphics::command_buffer::set_compute_shader_sampler(cmdB, m_DeferredLightingCS, binding_slot("s_ggx_sampler"), ibl.ggx_sampler());
+        graphics::command_buffer::set_compute_shader_sampler(cmdB, m_DeferredLightingCS, binding_slot("s_lambert_sampler"), ibl.lambert_sampler());
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch_indirect(cmdB, m_DeferredLightingCS, indirectBuffer);
@@ -123,95 +123,39 @@ void IBL::release()
     graphics::resources::destroy_sampler(m_LambertSampler);
 }
 
-void IBL::upload_textures(CommandQueue cmdQ, CommandBuffer cmdB)
+void IBL::upload_textures(UploadManager& uploadManager)
 {
     // FGD
-    {
-        GraphicsBuffer imageBuffer = graphics::resources::create_graphics_buffer(m_Device, m_FGDData.width * m_FGDData.height * sizeof(half4), sizeof(half4), GraphicsBufferType::Upload);
-        graphics::resources::set_buffer_data(imageBuffer, (const char*)m_FGDData.data.data(), m_FGDData.width * m_FGDData.height * sizeof(half4));
-
-        // Copy the buffer to a texture
-        graphics::command_buffer::reset(cmdB);
-        graphics::command_buffer::copy_buffer_into_texture(cmdB, imageBuffer, 0, m_FGDTexture, 0, 0);
-        graphics::command_buffer::close(cmdB);
-        graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-        graphics::command_queue::flush(cmdQ);
-
-        // Destroy the graphics buffer
-        graphics::resources::destroy_graphics_buffer(imageBuffer);
-    }
+    uploadManager.upload_texture((const char*)m_FGDData.data.data(), m_FGDData.width * m_FGDData.height * sizeof(half4), m_FGDTexture, 0, 0);
 
     // Convolved map GGX
     {
-        GraphicsBuffer imageBuffer = graphics::resources::create_graphics_buffer(m_Device, m_ConvolvedGGXData.data.size(), sizeof(half4), GraphicsBufferType::Upload);
-        graphics::resources::set_buffer_data(imageBuffer, (const char*)m_ConvolvedGGXData.data.data(), m_ConvolvedGGXData.data.size());
-
-        // Copy the buffer to a texture
-        graphics::command_buffer::reset(cmdB);
-
         uint64_t offset = 0;
         uint64_t currentRes = m_ConvolvedGGXData.width;
         for (uint32_t mipIdx = 0; mipIdx < 7; ++mipIdx)
         {
+            const uint64_t faceSize = currentRes * currentRes * sizeof(half4);
             for (uint32_t faceIdx = 0; faceIdx < 6; ++faceIdx)
             {
-                graphics::command_buffer::copy_buffer_into_texture(cmdB, imageBuffer, offset, m_ConvolvedGGXTexture, faceIdx, mipIdx);
-                offset += currentRes * currentRes * sizeof(half4);
+                uploadManager.upload_texture((const char*)m_ConvolvedGGXData.data.data() + offset, faceSize, m_ConvolvedGGXTexture, faceIdx, mipIdx);
+                offset += faceSize;
             }
             currentRes >>= 1;
         }
-        graphics::command_buffer::close(cmdB);
-        graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-        graphics::command_queue::flush(cmdQ);
-
-        // Destroy the graphics buffer
-        graphics::resources::destroy_graphics_buffer(imageBuffer);
     }
 
     // Convolved map Lambert
     {
-        GraphicsBuffer imageBuffer = graphics::resources::create_graphics_buffer(m_Device, m_ConvolvedLambertData.data.size(), sizeof(half4), GraphicsBufferType::Upload);
-        graphics::resources::set_buffer_data(imageBuffer, (const char*)m_ConvolvedLambertData.data.data(), m_ConvolvedLambertData.data.size());
-
-        // Copy the buffer to a texture
-        graphics::command_buffer::reset(cmdB);
-
-        uint64_t offset = 0;
-        uint64_t currentRes = m_ConvolvedLambertData.width;
+        const uint64_t faceSize = (uint64_t)m_ConvolvedLambertData.width * m_ConvolvedLambertData.width * sizeof(half4);
         for (uint32_t faceIdx = 0; faceIdx < 6; ++faceIdx)
-        {
-            graphics::command_buffer::copy_buffer_into_texture(cmdB, imageBuffer, offset, m_ConvolvedLambertTexture, faceIdx, 0);
-            offset += currentRes * currentRes * sizeof(half4);
-        }
-        graphics::command_buffer::close(cmdB);
-        graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-        graphics::command_queue::flush(cmdQ);
-
-        // Destroy the graphics buffer
-        graphics::resources::destroy_graphics_buffer(imageBuffer);
+            uploadManager.upload_texture((const char*)m_ConvolvedLambertData.data.data() + faceIdx * faceSize, faceSize, m_ConvolvedLambertTexture, faceIdx, 0);
     }
 
     // Background texture
     {
-        GraphicsBuffer imageBuffer = graphics::resources::create_graphics_buffer(m_Device, m_BackgroundData.data.size(), sizeof(half4), GraphicsBufferType::Upload);
-        graphics::resources::set_buffer_data(imageBuffer, (const char*)m_BackgroundData.data.data(), m_BackgroundData.data.size());
-
-        // Copy the buffer to a texture
-        graphics::command_buffer::reset(cmdB);
-
-        uint64_t offset = 0;
-        uint64_t currentRes = m_BackgroundData.width;
+        const uint64_t faceSize = (uint64_t)m_BackgroundData.width * m_BackgroundData.width * sizeof(half4);
         for (uint32_t faceIdx = 0; faceIdx < 6; ++faceIdx)
-        {
-            graphics::command_buffer::copy_buffer_into_texture(cmdB, imageBuffer, offset, m_BackgroundTexture, faceIdx, 0);
-            offset += currentRes * currentRes * sizeof(half4);
-        }
-        graphics::command_buffer::close(cmdB);
-        graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-        graphics::command_queue::flush(cmdQ);
-
-        // Destroy the graphics buffer
-        graphics::resources::destroy_graphics_buffer(imageBuffer);
+            uploadManager.upload_texture((const char*)m_BackgroundData.data.data() + faceIdx * faceSize, faceSize, m_BackgroundTexture, faceIdx, 0);
     }
 }
 
@@ -233,16 +177,16 @@ void IBL::render_cubemap(CommandBuffer cmdB, ConstantBuffer globalCB, RenderText
     graphics::command_buffer::set_render_texture(cmdB, colorTexture);
 
     // Constant buffer
-    graphics::command_buffer::set_graphics_pipeline_cbuffer(cmdB, m_CubemapGP, "_GlobalCB", globalCB);
+    graphics::command_buffer::set_graphics_pipeline_cbuffer(cmdB, m_CubemapGP, binding_slot("_GlobalCB"), globalCB);
 
     // Input data
-    graphics::command_buffer::set_graphics_pipeline_texture(cmdB, m_CubemapGP, "_BackgroundTexture", m_BackgroundTexture);
-    graphics::command_buffer::set_graphics_pipeline_texture(cmdB, m_CubemapGP, "_IndirectDiffuseTexture", m_ConvolvedLambertTexture);
-    graphics::command_buffer::set_graphics_pipeline_render_texture(cmdB, m_CubemapGP, "_ShadowTexture", shadowTexture);
-    graphics::command_buffer::set_graphics_pipeline_buffer(cmdB, m_CubemapGP, "_DisplacementBuffer", displacementBuffer);
+    graphics::command_buffer::set_graphics_pipeline_texture(cmdB, m_CubemapGP, binding_slot("_BackgroundTexture"), m_BackgroundTexture);
+    graphics::command_buffer::set_graphics_pipeline_texture(cmdB, m_CubemapGP, binding_slot("_IndirectDiffuseTexture"), m_ConvolvedLambertTexture);
+    graphics::command_buffer::set_graphics_pipeline_render_texture(cmdB, m_CubemapGP, binding_slot("_ShadowTexture"), shadowTexture);
+    graphics::command_buffer::set_graphics_pipeline_buffer(cmdB, m_CubemapGP, binding_slot("_DisplacementBuffer"), displacementBuffer);
 
     // Sampler
-    graphics::command_buffer::set_graphics_pipeline_sampler(cmdB, m_CubemapGP, "sampler_linear_clamp", m_LambertSampler);
+    graphics::command_buffer::set_graphics_pipeline_sampler(cmdB, m_CubemapGP, binding_slot("sampler_linear_clamp"), m_LambertSampler);
 
     // Draw
     graphics::command_buffer::draw_procedural(cmdB, m_CubemapGP, 1, 1);
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "render_pipeline/keyframe_ring.h"
+#include "graphics/backend.h"
+#include "tools/security.h"
+
+KeyframeRing::KeyframeRing()
+{
+}
+
+KeyframeRing::~KeyframeRing()
+{
+}
+
+void KeyframeRing::initialize(GraphicsDevice device, const CompactMeshAnimation& animation, uint32_t numSlots)
+{
+    // The skinning interpolates two frames
+    assert_msg(numSlots >= 2 && numSlots <= animation.numFrames, "Invalid key frame ring size\n");
+    m_Device = device;
+    m_Animation = &animation;
+    m_FrameSize = (uint64_t)animation.numVertices * sizeof(CompactVertex);
+
+    // GPU ring, every upload buffer holds the vertices of a frame followed by its bounds
+    m_FrameBuffer = graphics::resources::create_graphics_buffer(m_Device, numSlots * m_FrameSize, sizeof(CompactVertex), GraphicsBufferType::Default);
+    m_BoundsBuffer = graphics::resources::create_graphics_buffer(m_Device, numSlots * sizeof(AnimationFrameBounds), sizeof(float4), GraphicsBufferType::Default);
+    m_UploadBuffers.resize(numSlots);
+    for (uint32_t slotIdx = 0; slotIdx < numSlots; ++slotIdx)
+        m_UploadBuffers[slotIdx] = graphics::resources::create_graphics_buffer(m_Device, m_FrameSize + sizeof(AnimationFrameBounds), sizeof(uint32_t), GraphicsBufferType::Upload);
+
+    // Start streaming
+    m_Slots.assign(numSlots, KeyframeSlot());
+    m_CurrentFrame = 0;
+    m_Exit = false;
+    m_Worker = std::thread(&KeyframeRing::stream_frames, this);
+}
+
+void KeyframeRing::release()
+{
+    // Stop the streaming thread
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Exit = true;
+    }
+    m_RequestCV.notify_all();
+    if (m_Worker.joinable())
+        m_Worker.join();
+
+    // Buffers
+    graphics::resources::destroy_graphics_buffer(m_FrameBuffer);
+    graphics::resources::destroy_graphics_buffer(m_BoundsBuffer);
+    for (GraphicsBuffer uploadBuffer : m_UploadBuffers)
+        graphics::resources::destroy_graphics_buffer(uploadBuffer);
+    m_UploadBuffers.clear();
+    m_Slots.clear();
+}
+
+uint32_t KeyframeRing::playback_distance(uint32_t frameIdx) const
+{
+    return (frameIdx + m_Animation->numFrames - m_CurrentFrame) % m_Animation->numFrames;
+}
+
+uint32_t KeyframeRing::find_slot(uint32_t frameIdx) const
+{
+    for (uint32_t slotIdx = 0; slotIdx < (uint32_t)m_Slots.size(); ++slotIdx)
+    {
+        if (m_Slots[slotIdx].frameIdx == frameIdx)
+            return slotIdx;
+    }
+    return UINT32_MAX;
+}
+
+void KeyframeRing::stream_frames()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        // Wait for a request, the closest frame to the playback goes first
+        uint32_t slotIdx = UINT32_MAX;
+        m_RequestCV.wait(lock, [&]()
+        {
+            for (uint32_t candidateIdx = 0; candidateIdx < (uint32_t)m_Slots.size(); ++candidateIdx)
+            {
+                if (m_Slots[candidateIdx].state == KeyframeSlotState::Requested && (slotIdx == UINT32_MAX || playback_distance(m_Slots[candidateIdx].frameIdx) < playback_distance(m_Slots[slotIdx].frameIdx)))
+                    slotIdx = candidateIdx;
+            }
+            return m_Exit || slotIdx != UINT32_MAX;
+        });
+        if (m_Exit)
+            return;
+
+        // Fill the upload buffer outside of the lock, the render thread doesn't touch a loading slot
+        const uint32_t frameIdx = m_Slots[slotIdx].frameIdx;
+        m_Slots[slotIdx].state = KeyframeSlotState::Loading;
+        lock.unlock();
+        const CompactVertex* frameVertices = m_Animation->frameVertices.data() + (uint64_t)frameIdx * m_Animation->numVertices;
+        graphics::resources::set_buffer_data(m_UploadBuffers[slotIdx], (const char*)frameVertices, m_FrameSize);
+        graphics::resources::set_buffer_data(m_UploadBuffers[slotIdx], (const char*)&m_Animation->frameBounds[frameIdx], sizeof(AnimationFrameBounds), (uint32_t)m_FrameSize);
+        lock.lock();
+
+        m_Slots[slotIdx].state = KeyframeSlotState::Staged;
+        m_StagedCV.notify_all();
+    }
+}
+
+void KeyframeRing::request_frames()
+{
+    // The slots out of the window are recycled, unless their upload buffer is in use
+    const uint32_t numSlots = (uint32_t)m_Slots.size();
+    bool requested = false;
+    for (uint32_t offset = 0; offset < numSlots; ++offset)
+    {
+        const uint32_t frameIdx = (m_CurrentFrame + offset) % m_Animation->numFrames;
+        if (find_slot(frameIdx) != UINT32_MAX)
+            continue;
+        for (KeyframeSlot& slot : m_Slots)
+        {
+            const bool busy = slot.state == KeyframeSlotState::Loading || slot.state == KeyframeSlotState::Copying;
+            if (!busy && (slot.state == KeyframeSlotState::Empty || playback_distance(slot.frameIdx) >= numSlots))
+            {
+                slot.frameIdx = frameIdx;
+                slot.state = KeyframeSlotState::Requested;
+                requested = true;
+                break;
+            }
+        }
+    }
+    if (requested)
+        m_RequestCV.notify_one();
+}
+
+void KeyframeRing::copy_staged_slots(CommandBuffer cmdB)
+{
+    for (uint32_t slotIdx = 0; slotIdx < (uint32_t)m_Slots.size(); ++slotIdx)
+    {
+        KeyframeSlot& slot = m_Slots[slotIdx];
+        if (slot.state != KeyframeSlotState::Staged || playback_distance(slot.frameIdx) >= (uint32_t)m_Slots.size())
+            continue;
+        graphics::command_buffer::copy_graphics_buffer(cmdB, m_UploadBuffers[slotIdx], 0, m_FrameBuffer, (uint32_t)(slotIdx * m_FrameSize), m_FrameSize);
+        graphics::command_buffer::copy_graphics_buffer(cmdB, m_UploadBuffers[slotIdx], (uint32_t)m_FrameSize, m_BoundsBuffer, slotIdx * sizeof(AnimationFrameBounds), sizeof(AnimationFrameBounds));
+        slot.state = KeyframeSlotState::Copying;
+    }
+}
+
+uint2 KeyframeRing::update(CommandBuffer cmdB, uint32_t currentFrame, uint32_t nextFrame)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_CurrentFrame = currentFrame;
+
+    // The previous frame has been flushed, its copies are done
+    for (KeyframeSlot& slot : m_Slots)
+    {
+        if (slot.state == KeyframeSlotState::Copying)
+            slot.state = KeyframeSlotState::Resident;
+    }
+
+    // Record the frames prefetched since the last update and request the missing ones.
+    // The skinning can't start before both of its frames are copied (start of the playback or a jump in time).
+    auto usable = [&](uint32_t slotIdx)
+    {
+        return slotIdx != UINT32_MAX && (m_Slots[slotIdx].state == KeyframeSlotState::Copying || m_Slots[slotIdx].state == KeyframeSlotState::Resident);
+    };
+    while (true)
+    {
+        copy_staged_slots(cmdB);
+        request_frames();
+        const uint32_t currentSlot = find_slot(currentFrame);
+        const uint32_t nextSlot = find_slot(nextFrame);
+        if (usable(currentSlot) && usable(nextSlot))
+            return { currentSlot, nextSlot };
+        m_StagedCV.wait(lock);
+    }
+}
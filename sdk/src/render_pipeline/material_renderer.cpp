@@ -12,7 +12,6 @@
 
 #include "tools/security.h"
 #include "tools/shader_utils.h"
-#include "tools/gpu_helpers.h"
 
 MaterialRenderer::MaterialRenderer()
 {
@@ -109,44 +108,46 @@ void MaterialRenderer::evaluate_indirect(CommandBuffer cmdB, ConstantBuffer glob
     RenderTexture visilityBuffer, GraphicsBuffer shadowTexture, GraphicsBuffer indexationBuffer, GraphicsBuffer indirectBuffer, RenderTexture colorTexture)
 {
     // Constant buffer
-    graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_TexturesCS, "_GlobalCB", globalCB);
+    graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_TexturesCS, binding_slot("_GlobalCB"), globalCB);
 
     // SRVs
-    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TexturesCS, "_VisibilityBuffer", visilityBuffer);
-    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TexturesCS, "_ShadowTexture", shadowTexture);
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TexturesCS, "_TileBuffer", indexationBuffer);
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TexturesCS, "_VertexBuffer", vertexBuffer);
-    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TexturesCS, "_IndexBuffer", indexBuffer);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_PreIntegratedFGDTexture", ibl.pre_integrated_fgd());
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_ConvolvedIBLTexture", ibl.convolved_ggx_ibl());
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_IndirectDiffuseTexture", ibl.convolved_lambert_ibl());
+    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TexturesCS, binding_slot("_VisibilityBuffer"), visilityBuffer);
+    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TexturesCS, binding_slot("_ShadowTexture"), shadowTexture);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TexturesCS, binding_slot("_TileBuffer"), indexationBuffer);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TexturesCS, binding_slot("_VertexBuffer"), vertexBuffer);
+    graphics::command_buffer::set_compute_shader_buffer(cmdB, m_TexturesCS, binding_slot("_IndexBuffer"), indexBuffer);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_PreIntegratedFGDTexture"), ibl.pre_integrated_fgd());
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_ConvolvedIBLTexture"), ibl.convolved_ggx_ibl());
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_IndirectDiffuseTexture"), ibl.convolved_lambert_ibl());
 
     // Material texture
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_Texture0", texSet.tex0);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_Texture1", texSet.tex1);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_Texture2", texSet.tex2);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_Texture3", texSet.tex3);
-    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, "_Texture4", texSet.tex4);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_Texture0"), texSet.tex0);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_Texture1"), texSet.tex1);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_Texture2"), texSet.tex2);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_Texture3"), texSet.tex3);
+    graphics::command_buffer::set_compute_shader_texture(cmdB, m_TexturesCS, binding_slot("_Texture4"), texSet.tex4);
 
     // Samplers
-    graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, "s_fgd_sampler", ibl.fgd_sampler());
-    graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, "s_ggx_sampler", ibl.ggx_sampler());
-    graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, "s_lambert_sampler", ibl.lambert_sampler());
+    graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, binding_slot("s_fgd_sampler"), ibl.fgd_sampler());
+    graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, binding_slot("s_ggx_sampler"), ibl.ggx_sampler());
+    graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, binding_slot("s_lambert_sampler"), ibl.lambert_sampler());
     switch (filteringMode)
     {
         case FilteringMode::Nearest:
-            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, "s_texture_sampler", m_NearestSampler);
+            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, binding_slot("s_texture_sampler"), m_NearestSampler);
             break;
         case FilteringMode::Linear:
-            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, "s_texture_sampler", m_LinearSampler);
+            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, binding_slot("s_texture_sampler"), m_LinearSampler);
             break;
         case FilteringMode::Anisotropic:
-            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, "s_texture_sampler", m_AnisoSampler);
+            graphics::command_buffer::set_compute_shader_sampler(cmdB, m_TexturesCS, binding_slot("s_texture_sampler"), m_AnisoSampler);
+            break;
+        default:
             break;
     }
 
     // Output buffer
-    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TexturesCS, "_ColorTextureRW", colorTexture);
+    graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_TexturesCS, binding_slot("_ColorTextureRW"), colorTexture);
 
     // Dispatch + barrier
     graphics::command_buffer::dispatch_indirect(cmdB, m_TexturesCS, indirectBuffer);
@@ -163,54 +164,70 @@ void MaterialRenderer::partial_inference(CommandBuffer cmdB, ComputeShader targe
     if (targetCS != 0)
     {
         // CBVs
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, targetCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, targetCS, binding_slot("_GlobalCB"), globalCB);
 
         // Input buffers
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, "_VisibilityBuffer", visilityBuffer);
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, "_ShadowTexture", shadowTexture);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_TileBuffer", tileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_VertexBuffer", vertexBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_IndexBuffer", indexBuffer);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_PreIntegratedFGDTexture", ibl.pre_integrated_fgd());
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_ConvolvedIBLTexture", ibl.convolved_ggx_ibl());
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_IndirectDiffuseTexture", ibl.convolved_lambert_ibl());
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, binding_slot("_VisibilityBuffer"), visilityBuffer);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, binding_slot("_ShadowTexture"), shadowTexture);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_TileBuffer"), tileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_VertexBuffer"), vertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_IndexBuffer"), indexBuffer);
+        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_PreIntegratedFGDTexture"), ibl.pre_integrated_fgd());
+        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_ConvolvedIBLTexture"), ibl.convolved_ggx_ibl());
+        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_IndirectDiffuseTexture"), ibl.convolved_lambert_ibl());
 
         // Samplers
-        graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "s_fgd_sampler", ibl.fgd_sampler());
-        graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "s_ggx_sampler", ibl.ggx_sampler());
-        graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "s_lambert_sampler", ibl.lambert_sampler());
+        graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("s_fgd_sampler"), ibl.fgd_sampler());
+        graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("s_ggx_sampler"), ibl.ggx_sampler());
+        graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("s_lambert_sampler"), ibl.lambert_sampler());
 
         // Output buffer
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, "_ColorTextureRW", colorTexture);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, targetCS, binding_slot("_ColorTextureRW"), colorTexture);
 
         // Latent Space
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS0Texture", gpuNwk.tex0);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS1Texture", gpuNwk.tex1);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS2Texture", gpuNwk.tex2);
-        graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, "_LS3Texture", gpuNwk.tex3);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_UVOffsetBuffer", network.uv_offset_buffer());
+        if (network.feature_textures_enabled())
+        {
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature0Texture"), gpuNwk.feature0);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature1Texture"), gpuNwk.feature1);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature2Texture"), gpuNwk.feature2);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_Feature3Texture"), gpuNwk.feature3);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_FeatureLayer0Buffer"), gpuNwk.featureLayer0Buffer);
+        }
+        else
+        {
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS0Texture"), gpuNwk.tex0);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS1Texture"), gpuNwk.tex1);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS2Texture"), gpuNwk.tex2);
+            graphics::command_buffer::set_compute_shader_texture(cmdB, targetCS, binding_slot("_LS3Texture"), gpuNwk.tex3);
+        }
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_UVOffsetBuffer"), network.uv_offset_buffer());
 
         // Samplers
         switch (filteringMode)
         {
             case FilteringMode::Nearest:
-                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "bc1_linear_clamp_sampler", m_NearestSampler);
+                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("bc1_linear_clamp_sampler"), m_NearestSampler);
                 break;
             case FilteringMode::Linear:
-                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "bc1_linear_clamp_sampler", m_LinearSampler);
+                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("bc1_linear_clamp_sampler"), m_LinearSampler);
                 break;
             case FilteringMode::Anisotropic:
-                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, "bc1_linear_clamp_sampler", m_AnisoSampler);
+                graphics::command_buffer::set_compute_shader_sampler(cmdB, targetCS, binding_slot("bc1_linear_clamp_sampler"), m_AnisoSampler);
+                break;
+            default:
                 break;
         }
 
         // MLPs
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPWeight0Buffer", useCooperativeVectors ? gpuNwk.mlp.weight0OptimalBuffer : gpuNwk.mlp.weight0Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPBias0Buffer", gpuNwk.mlp.bias0Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPWeight1Buffer", useCooperativeVectors ? gpuNwk.mlp.weight1OptimalBuffer : gpuNwk.mlp.weight1Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPBias1Buffer", gpuNwk.mlp.bias1Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPWeight2Buffer", useCooperativeVectors ? gpuNwk.mlp.weight2OptimalBuffer : gpuNwk.mlp.weight2Buffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, "_MLPBias2Buffer", gpuNwk.mlp.bias2Buffer);
+        if (!network.feature_textures_enabled())
+        {
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPWeight0Buffer"), useCooperativeVectors ? gpuNwk.mlp.weight0OptimalBuffer : gpuNwk.mlp.weight0Buffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPBias0Buffer"), gpuNwk.mlp.bias0Buffer);
+        }
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPWeight1Buffer"), useCooperativeVectors ? gpuNwk.mlp.weight1OptimalBuffer : gpuNwk.mlp.weight1Buffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPBias1Buffer"), gpuNwk.mlp.bias1Buffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPWeight2Buffer"), useCooperativeVectors ? gpuNwk.mlp.weight2OptimalBuffer : gpuNwk.mlp.weight2Buffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, targetCS, binding_slot("_MLPBias2Buffer"), gpuNwk.mlp.bias2Buffer);
 
         // Dispatch + barrier
         graphics::command_buffer::dispatch_indirect(cmdB, targetCS, classifier.indirect_buffer(), indirectOffset);
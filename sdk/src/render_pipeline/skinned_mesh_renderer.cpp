@@ -10,7 +10,6 @@
 #include "graphics/backend.h"
 #include "math/operators.h"
 #include "tools/shader_utils.h"
-#include "tools/dirent.h"
 #include "imgui/imgui.h"
 
 SkinnedMeshRenderer::SkinnedMeshRenderer()
@@ -21,26 +20,58 @@ SkinnedMeshRenderer::~SkinnedMeshRenderer()
 {
 }
 
-void SkinnedMeshRenderer::initialize(GraphicsDevice device, const std::string& modelName)
+bool has_extension(const std::string& path, const std::string& extension)
+{
+    return path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+void SkinnedMeshRenderer::initialize(GraphicsDevice device, const std::string& modelName, uint32_t ringSize)
 {
     //Keep track of the device
 	m_Device = device;
 
-    // Import the animation
-    mesh::import_mesh_animation(modelName.c_str(), m_AnimMesh);
+    // Import the animation, the full precision format is compressed on load
+    m_PCAAnimation = has_extension(modelName, ".pcanim");
+    if (m_PCAAnimation)
+        animation_pca::import_animation(modelName.c_str(), m_PCAMesh);
+    else if (has_extension(modelName, ".canim"))
+        mesh::import_compact_animation(modelName.c_str(), m_AnimMesh);
+    else
+    {
+        MeshAnimation meshAnimation;
+        mesh::import_mesh_animation(modelName.c_str(), meshAnimation);
+        mesh::compress_animation(meshAnimation, m_AnimMesh);
+    }
 
     // Set up the animation data
-    m_NumFrames = (uint32_t)m_AnimMesh.vertexBufferArray.size();
-    m_NumTriangles = (uint32_t)m_AnimMesh.indexBuffer.size();
-    m_NumVertices = (uint32_t)m_AnimMesh.vertexBufferArray[0].data.size();
-    m_AnimVertexBuffer.resize(m_NumFrames);
+    m_NumFrames = m_PCAAnimation ? m_PCAMesh.numFrames : m_AnimMesh.numFrames;
+    m_NumTriangles = (uint32_t)(m_PCAAnimation ? m_PCAMesh.indexBuffer.size() : m_AnimMesh.indexBuffer.size());
+    m_NumVertices = m_PCAAnimation ? m_PCAMesh.numVertices : m_AnimMesh.numVertices;
+    m_StreamAnimation = !m_PCAAnimation && ringSize != 0 && ringSize < m_NumFrames;
     m_ActiveAnimation = false;
     m_AnimationSpeed = 0.0;
 
     // Allocate the runtime buffers
     m_AnimIndexBuffer = graphics::resources::create_graphics_buffer(m_Device, m_NumTriangles * sizeof(uint3), sizeof(uint32_t), GraphicsBufferType::Default);
-    for (uint32_t idx = 0; idx < m_NumFrames; ++idx)
-        m_AnimVertexBuffer[idx] = graphics::resources::create_graphics_buffer(m_Device, m_NumVertices * sizeof(VertexData), sizeof(VertexData), GraphicsBufferType::Default);
+    if (m_PCAAnimation)
+    {
+        // The coefficient buffer is never empty, even for a static mesh
+        m_PCAAttributesBuffer = graphics::resources::create_graphics_buffer(m_Device, m_NumVertices * sizeof(AnimationVertexAttributes), sizeof(AnimationVertexAttributes), GraphicsBufferType::Default);
+        m_PCAMeanBuffer = graphics::resources::create_graphics_buffer(m_Device, m_NumVertices * sizeof(PCAVertex), sizeof(PCAVertex), GraphicsBufferType::Default);
+        m_PCABasisBuffer = graphics::resources::create_graphics_buffer(m_Device, std::max(m_PCAMesh.basis.size(), (size_t)1) * sizeof(PCAVertex), sizeof(PCAVertex), GraphicsBufferType::Default);
+        m_PCACoefficientBuffer = graphics::resources::create_graphics_buffer(m_Device, std::max(m_PCAMesh.coefficients.size(), (size_t)1) * sizeof(float), sizeof(float), GraphicsBufferType::Default);
+    }
+    else
+    {
+        m_AnimBaseBuffer = graphics::resources::create_graphics_buffer(m_Device, m_NumVertices * sizeof(AnimationBaseVertex), sizeof(AnimationBaseVertex), GraphicsBufferType::Default);
+        if (m_StreamAnimation)
+            m_KeyframeRing.initialize(m_Device, m_AnimMesh, std::max(ringSize, 2u));
+        else
+        {
+            m_AnimFrameBuffer = graphics::resources::create_graphics_buffer(m_Device, (uint64_t)m_NumFrames * m_NumVertices * sizeof(CompactVertex), sizeof(CompactVertex), GraphicsBufferType::Default);
+            m_AnimBoundsBuffer = graphics::resources::create_graphics_buffer(m_Device, m_NumFrames * sizeof(AnimationFrameBounds), sizeof(float4), GraphicsBufferType::Default);
+        }
+    }
     m_SkinnedVertexBuffer = graphics::resources::create_graphics_buffer(m_Device, m_NumVertices * sizeof(VertexData), sizeof(VertexData), GraphicsBufferType::Default);
     m_DisplacementBuffer = graphics::resources::create_graphics_buffer(m_Device, 4 * sizeof(float), sizeof(float), GraphicsBufferType::Default);
 
@@ -57,8 +88,24 @@ void SkinnedMeshRenderer::release()
     graphics::resources::destroy_graphics_buffer(m_AnimIndexBuffer);
     graphics::resources::destroy_graphics_buffer(m_SkinnedVertexBuffer);
     graphics::resources::destroy_graphics_buffer(m_DisplacementBuffer);
-    for (uint32_t idx = 0; idx < m_NumFrames; ++idx)
-        graphics::resources::destroy_graphics_buffer(m_AnimVertexBuffer[idx]);
+    if (m_PCAAnimation)
+    {
+        graphics::resources::destroy_graphics_buffer(m_PCAAttributesBuffer);
+        graphics::resources::destroy_graphics_buffer(m_PCAMeanBuffer);
+        graphics::resources::destroy_graphics_buffer(m_PCABasisBuffer);
+        graphics::resources::destroy_graphics_buffer(m_PCACoefficientBuffer);
+    }
+    else
+    {
+        graphics::resources::destroy_graphics_buffer(m_AnimBaseBuffer);
+        if (m_StreamAnimation)
+            m_KeyframeRing.release();
+        else
+        {
+            graphics::resources::destroy_graphics_buffer(m_AnimFrameBuffer);
+            graphics::resources::destroy_graphics_buffer(m_AnimBoundsBuffer);
+        }
+    }
 
     // Shaders
     graphics::compute_shader::destroy_compute_shader(m_SkinCS);
@@ -73,11 +120,17 @@ void SkinnedMeshRenderer::release()
 // Resource loading
 void SkinnedMeshRenderer::reload_shaders(const std::string& shaderLibrary)
 {
-    // Skinning
+    // Skinning, the PCA reconstruction is unrolled over the components
     {
         ComputeShaderDescriptor csd;
         csd.includeDirectories.push_back(shaderLibrary);
-        csd.filename = shaderLibrary + "\\Mesh\\SkinMesh.compute";
+        if (m_PCAAnimation)
+        {
+            csd.filename = shaderLibrary + "\\Mesh\\SkinMeshPCA.compute";
+            csd.defines.push_back(std::string("PCA_COMPONENT_COUNT ") + std::to_string(m_PCAMesh.numComponents));
+        }
+        else
+            csd.filename = shaderLibrary + "\\Mesh\\SkinMesh.compute";
         compile_and_replace_compute_shader(m_Device, csd, m_SkinCS);
     }
 
@@ -104,70 +157,60 @@ void SkinnedMeshRenderer::reload_shaders(const std::string& shaderLibrary)
     }
 }
 
-void upload_index_buffer(GraphicsDevice device, CommandQueue cmdQ, CommandBuffer cmdB, const std::vector<uint3>& indexBufferData, GraphicsBuffer indexBuffer)
-{
-    // Create the upload index buffer
-    GraphicsBuffer indexBufferUp = graphics::resources::create_graphics_buffer(device, indexBufferData.size() * sizeof(uint3), sizeof(uint32_t), GraphicsBufferType::Upload);
-    graphics::resources::set_buffer_data(indexBufferUp, (char*)indexBufferData.data(), indexBufferData.size() * sizeof(uint3));
-
-    // Copy
-    graphics::command_buffer::reset(cmdB);
-    graphics::command_buffer::copy_graphics_buffer(cmdB, indexBufferUp, indexBuffer);
-    graphics::command_buffer::close(cmdB);
-    graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-    graphics::command_queue::flush(cmdQ);
-
-    // Clear
-    graphics::resources::destroy_graphics_buffer(indexBufferUp);
-}
-
-void upload_vertex_buffer(GraphicsDevice device, CommandQueue cmdQ, CommandBuffer cmdB, const std::vector<VertexData>& vertexBufferData, GraphicsBuffer vertexBuffer)
-{
-    // Create the upload vertex buffer
-    GraphicsBuffer vertexBufferUp = graphics::resources::create_graphics_buffer(device, vertexBufferData.size() * sizeof(VertexData), sizeof(VertexData), GraphicsBufferType::Upload);
-    graphics::resources::set_buffer_data(vertexBufferUp, (char*)vertexBufferData.data(), vertexBufferData.size() * sizeof(VertexData));
-
-    // Reset the command buffer
-    graphics::command_buffer::reset(cmdB);
-
-    // Copy the upload buffers
-    graphics::command_buffer::copy_graphics_buffer(cmdB, vertexBufferUp, vertexBuffer);
-
-    // Close and flush the command buffer
-    graphics::command_buffer::close(cmdB);
-    graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-    graphics::command_queue::flush(cmdQ);
-
-    graphics::resources::destroy_graphics_buffer(vertexBufferUp);
-}
-
-void SkinnedMeshRenderer::upload_geometry(CommandQueue cmdQ, CommandBuffer cmdB)
+void SkinnedMeshRenderer::upload_geometry(UploadManager& uploadManager)
 {
     // Upload index buffers
-    upload_index_buffer(m_Device, cmdQ, cmdB, m_AnimMesh.indexBuffer, m_AnimIndexBuffer);
+    const std::vector<uint3>& indexBuffer = m_PCAAnimation ? m_PCAMesh.indexBuffer : m_AnimMesh.indexBuffer;
+    uploadManager.upload_buffer((const char*)indexBuffer.data(), indexBuffer.size() * sizeof(uint3), m_AnimIndexBuffer);
 
-    // Upload all the vertex buffers
-    for (uint32_t idx = 0; idx < m_NumFrames; ++idx)
-        upload_vertex_buffer(m_Device, cmdQ, cmdB, m_AnimMesh.vertexBufferArray[idx].data, m_AnimVertexBuffer[idx]);
+    // Upload the animation, the frames are decoded by the skinning shader
+    if (m_PCAAnimation)
+    {
+        uploadManager.upload_buffer((const char*)m_PCAMesh.attributes.data(), m_PCAMesh.attributes.size() * sizeof(AnimationVertexAttributes), m_PCAAttributesBuffer);
+        uploadManager.upload_buffer((const char*)m_PCAMesh.mean.data(), m_PCAMesh.mean.size() * sizeof(PCAVertex), m_PCAMeanBuffer);
+        if (m_PCAMesh.numComponents > 0)
+        {
+            uploadManager.upload_buffer((const char*)m_PCAMesh.basis.data(), m_PCAMesh.basis.size() * sizeof(PCAVertex), m_PCABasisBuffer);
+            uploadManager.upload_buffer((const char*)m_PCAMesh.coefficients.data(), m_PCAMesh.coefficients.size() * sizeof(float), m_PCACoefficientBuffer);
+        }
+    }
+    else
+    {
+        uploadManager.upload_buffer((const char*)m_AnimMesh.baseVertices.data(), m_AnimMesh.baseVertices.size() * sizeof(AnimationBaseVertex), m_AnimBaseBuffer);
+
+        // The streamed frames are uploaded by the key frame ring
+        if (!m_StreamAnimation)
+        {
+            uploadManager.upload_buffer((const char*)m_AnimMesh.frameVertices.data(), m_AnimMesh.frameVertices.size() * sizeof(CompactVertex), m_AnimFrameBuffer);
+            uploadManager.upload_buffer((const char*)m_AnimMesh.frameBounds.data(), m_AnimMesh.frameBounds.size() * sizeof(AnimationFrameBounds), m_AnimBoundsBuffer);
+        }
+    }
 }
 
 void SkinnedMeshRenderer::update_mesh(CommandBuffer cmdB, ConstantBuffer globalCB)
 {
-    // Skin the mesh
-    uint32_t keyFrame = current_animation_frame();
-    uint32_t nextFrame = next_animation_frame();
-
     // Skinning
     {
         // Constant buffers
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_SkinCS, "_GlobalCB", globalCB);
-
-        // Input buffers
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, "_VertexBufferA", m_AnimVertexBuffer[keyFrame]);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, "_VertexBufferB", m_AnimVertexBuffer[nextFrame]);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_SkinCS, binding_slot("_GlobalCB"), globalCB);
+
+        // Input buffers, the key frames are selected by _AnimationFrames
+        if (m_PCAAnimation)
+        {
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_PCAAttributesBuffer"), m_PCAAttributesBuffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_PCAMeanBuffer"), m_PCAMeanBuffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_PCABasisBuffer"), m_PCABasisBuffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_PCACoefficientBuffer"), m_PCACoefficientBuffer);
+        }
+        else
+        {
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_AnimBaseBuffer"), m_AnimBaseBuffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_AnimFrameBuffer"), m_StreamAnimation ? m_KeyframeRing.frame_buffer() : m_AnimFrameBuffer);
+            graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_AnimBoundsBuffer"), m_StreamAnimation ? m_KeyframeRing.bounds_buffer() : m_AnimBoundsBuffer);
+        }
 
         // Output buffers
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, "_VertexBufferRW", m_SkinnedVertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SkinCS, binding_slot("_VertexBufferRW"), m_SkinnedVertexBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch(cmdB, m_SkinCS, (m_NumVertices + 31) / 32, 1, 1);
@@ -177,13 +220,13 @@ void SkinnedMeshRenderer::update_mesh(CommandBuffer cmdB, ConstantBuffer globalC
     // Displacement Eval
     {
         // Constant buffers
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_DisplEvalCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_DisplEvalCS, binding_slot("_GlobalCB"), globalCB);
 
         // Input buffers
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DisplEvalCS, "_SkinnedVertexBuffer", m_SkinnedVertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DisplEvalCS, binding_slot("_SkinnedVertexBuffer"), m_SkinnedVertexBuffer);
 
         // Output buffers
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DisplEvalCS, "_DisplacementBuffer", m_DisplacementBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_DisplEvalCS, binding_slot("_DisplacementBuffer"), m_DisplacementBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch(cmdB, m_DisplEvalCS, 1, 1, 1);
@@ -203,11 +246,11 @@ void SkinnedMeshRenderer::render_mesh(CommandBuffer cmdB, ConstantBuffer globalC
         graphics::command_buffer::set_render_texture(cmdB, colorBuffer, depthBuffer);
 
         // Constant buffers
-        graphics::command_buffer::set_graphics_pipeline_cbuffer(cmdB, m_VisibilityPassGP, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_graphics_pipeline_cbuffer(cmdB, m_VisibilityPassGP, binding_slot("_GlobalCB"), globalCB);
 
         // Input buffers
-        graphics::command_buffer::set_graphics_pipeline_buffer(cmdB, m_VisibilityPassGP, "_VertexBuffer", m_SkinnedVertexBuffer);
-        graphics::command_buffer::set_graphics_pipeline_buffer(cmdB, m_VisibilityPassGP, "_IndexBuffer", m_AnimIndexBuffer);
+        graphics::command_buffer::set_graphics_pipeline_buffer(cmdB, m_VisibilityPassGP, binding_slot("_VertexBuffer"), m_SkinnedVertexBuffer);
+        graphics::command_buffer::set_graphics_pipeline_buffer(cmdB, m_VisibilityPassGP, binding_slot("_IndexBuffer"), m_AnimIndexBuffer);
 
         // Draw
         graphics::command_buffer::draw_procedural(cmdB, m_VisibilityPassGP, m_NumTriangles, 1);
@@ -276,6 +319,19 @@ float SkinnedMeshRenderer::interpolation_factor() const
     return m_CurrentTime * m_NumFrames - current;
 }
 
+void SkinnedMeshRenderer::stream_animation(CommandBuffer cmdB)
+{
+    if (m_StreamAnimation)
+        m_AnimationSlots = m_KeyframeRing.update(cmdB, current_animation_frame(), next_animation_frame());
+}
+
+uint2 SkinnedMeshRenderer::animation_frames() const
+{
+    if (m_StreamAnimation)
+        return m_AnimationSlots;
+    return { current_animation_frame(), next_animation_frame() };
+}
+
 float SkinnedMeshRenderer::animation_time() const
 {
     return m_CurrentTime;
@@ -294,5 +350,5 @@ void SkinnedMeshRenderer::render_ui()
     ImGui::SetNextItemWidth(200);
     float enthusiasm = 1.0f - (m_Duration - 0.5f) / 2.5f;
     ImGui::SliderFloat("Enthusiasm", &enthusiasm, 0.0f, 1.0f);
-    m_Duration = lerp(0.5f, 3.0f, 1.0f - enthusiasm);
+    m_Duration = 0.5f + 2.5f * (1.0f - enthusiasm);
 }
\ No newline at end of file
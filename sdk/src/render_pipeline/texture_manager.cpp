@@ -9,13 +9,20 @@
 #include "graphics/backend.h"
 #include "render_pipeline/texture_manager.h"
 #include "tools/directory_utilities.h"
+#include "tools/security.h"
 #include "tools/texture_utils.h"
+#include "imgui/imgui.h"
 
-Texture read_binary_texture_and_upload(GraphicsDevice device, CommandQueue cmdQ, CommandBuffer cmdB, const std::string& texFile)
+// System includes
+#include <algorithm>
+
+Texture read_binary_texture_and_upload(GraphicsDevice device, UploadManager& uploadManager, const std::string& texFile, uint64_t& sizeInBytes)
 {
-	// Read from disk
-	BinaryTexture binTex;
-	binary_texture::import_binary_texture(texFile.c_str(), binTex);
+	// Map the file
+	FileView binaryFile;
+	assert_msg(binaryFile.open(texFile.c_str()), "Failed to open binary texture\n");
+	BinaryTextureView binTex;
+	assert_msg(binary_texture::map_binary_texture(binaryFile, binTex), "Invalid binary texture\n");
 
 	// Allocate the texture
 	TextureDescriptor desc;
@@ -27,29 +34,16 @@ Texture read_binary_texture_and_upload(GraphicsDevice device, CommandQueue cmdQ,
 	desc.format = binTex.format;
 	Texture tex = graphics::resources::create_texture(device, desc);
 
-	// Create the upload buffer
-	GraphicsBuffer imageBuffer = graphics::resources::create_graphics_buffer(device, binTex.data.size(), sizeof(uint32_t), GraphicsBufferType::Upload);
-	graphics::resources::set_buffer_data(imageBuffer, (const char*)binTex.data.data(), binTex.data.size());
-
-	// Copy the buffer to a texture
-	graphics::command_buffer::reset(cmdB);
-	graphics::command_buffer::copy_buffer_into_texture_mips(cmdB, imageBuffer, 0, sizeof(uint32_t) * binTex.width * binTex.height, tex, 0);
-	graphics::command_buffer::close(cmdB);
-	graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-	graphics::command_queue::flush(cmdQ);
-
-	// Destroy the graphics buffer
-	graphics::resources::destroy_graphics_buffer(imageBuffer);
+	// Stage the mips straight from the mapping and record the copy
+	uploadManager.upload_texture_mips((const char*)binTex.data.data(), binTex.data.size(), sizeof(uint32_t) * binTex.width * binTex.height, tex, 0);
+	sizeInBytes = binTex.data.size();
 
 	// return the texture
 	return tex;
 }
 
-Texture read_bc6_texture_and_upload(GraphicsDevice device, CommandQueue cmdQ, CommandBuffer cmdB, const std::string& texFile)
+Texture read_bc6_texture_and_upload(GraphicsDevice device, UploadManager& uploadManager, const std::string& texFile, uint64_t& sizeInBytes)
 {
-	std::vector<char> binaryData;
-	load_file_to_array(texFile.c_str(), binaryData);
-
 	// Create the upload buffer
 	uint32_t width, height, mipCount;
 	GraphicsBuffer imageBuffer = load_bc6_to_graphics_buffer(device, texFile.c_str(), width, height, mipCount);
@@ -64,15 +58,13 @@ Texture read_bc6_texture_and_upload(GraphicsDevice device, CommandQueue cmdQ, Co
 	desc.format = TextureFormat::BC6_RGB;
 	Texture tex = graphics::resources::create_texture(device, desc);
 
-	// Copy the buffer to a texture
-	graphics::command_buffer::reset(cmdB);
-	graphics::command_buffer::copy_buffer_into_texture_mips(cmdB, imageBuffer, 0, (width / 4) * (height / 4) * 16, tex, 0);
-	graphics::command_buffer::close(cmdB);
-	graphics::command_queue::execute_command_buffer(cmdQ, cmdB);
-	graphics::command_queue::flush(cmdQ);
+	// Copy the buffer to a texture, the manager destroys it once the copy is done
+	uploadManager.upload_texture_mips(imageBuffer, (width / 4) * (height / 4) * 16, tex, 0);
 
-	// Destroy the graphics buffer
-	graphics::resources::destroy_graphics_buffer(imageBuffer);
+	// 16 bytes per 4x4 block for every mip
+	sizeInBytes = 0;
+	for (uint32_t mipIdx = 0; mipIdx < mipCount; ++mipIdx)
+		sizeInBytes += (uint64_t)std::max(width >> (mipIdx + 2), 1u) * std::max(height >> (mipIdx + 2), 1u) * 16;
 
 	// return the texture
 	return tex;
@@ -86,64 +78,119 @@ TextureManager::~TextureManager()
 {
 }
 
-void TextureManager::initialize(GraphicsDevice device)
+void TextureManager::initialize(GraphicsDevice device, const std::string& modelDir, const std::string& modelName, uint64_t budget)
 {
 	// Keep track of the device
 	m_Device = device;
+
+	// The sets are loaded on demand
+	m_ModelDir = modelDir;
+	m_ModelName = modelName;
+	m_Budget = budget;
+	m_UseCounter = 0;
+	m_Stats = TextureResidencyStats();
 }
 
 void TextureManager::release()
 {
-	// Uncompressed
-	graphics::resources::destroy_texture(m_UncompressedSet.tex0);
-	graphics::resources::destroy_texture(m_UncompressedSet.tex1);
-	graphics::resources::destroy_texture(m_UncompressedSet.tex2);
-	graphics::resources::destroy_texture(m_UncompressedSet.tex3);
-	graphics::resources::destroy_texture(m_UncompressedSet.tex4);
-
-	// BC6 set
-	graphics::resources::destroy_texture(m_BC6Set.tex0);
-	graphics::resources::destroy_texture(m_BC6Set.tex1);
-	graphics::resources::destroy_texture(m_BC6Set.tex2);
-	graphics::resources::destroy_texture(m_BC6Set.tex3);
-	graphics::resources::destroy_texture(m_BC6Set.tex4);
+	for (uint32_t setIdx = 0; setIdx < (uint32_t)TextureMode::Neural; ++setIdx)
+	{
+		if (m_Sets[setIdx].resident)
+			evict_set(setIdx);
+	}
 }
 
-void TextureManager::upload_textures(CommandQueue cmdQ, CommandBuffer cmdB, const std::string& modelDir, const std::string& modelName)
+uint32_t TextureManager::set_index(TextureMode mode) const
 {
-	// Uncompressed textures
-	{
-		const std::string tex0Path = modelDir + "\\" + modelName + "\\uncompressed\\tex0.tex_bin";
-		m_UncompressedSet.tex0 = read_binary_texture_and_upload(m_Device, cmdQ, cmdB, tex0Path);
-
-		const std::string tex1Path = modelDir + "\\" + modelName + "\\uncompressed\\tex1.tex_bin";
-		m_UncompressedSet.tex1 = read_binary_texture_and_upload(m_Device, cmdQ, cmdB, tex1Path);
+	assert_msg(mode == TextureMode::Uncompressed || mode == TextureMode::BC6H, "The texture manager only holds the uncompressed and BC6 sets\n");
+	return (uint32_t)mode;
+}
 
-		const std::string tex2Path = modelDir + "\\" + modelName + "\\uncompressed\\tex2.tex_bin";
-		m_UncompressedSet.tex2 = read_binary_texture_and_upload(m_Device, cmdQ, cmdB, tex2Path);
+bool TextureManager::is_resident(TextureMode mode) const
+{
+	return m_Sets[set_index(mode)].resident;
+}
 
-		const std::string tex3Path = modelDir + "\\" + modelName + "\\uncompressed\\tex3.tex_bin";
-		m_UncompressedSet.tex3 = read_binary_texture_and_upload(m_Device, cmdQ, cmdB, tex3Path);
+const TextureSet& TextureManager::texture_set(TextureMode mode) const
+{
+	const ResidentSet& set = m_Sets[set_index(mode)];
+	assert_msg(set.resident, "Texture set used before being requested\n");
+	return set.textures;
+}
 
-		const std::string tex4Path = modelDir + "\\" + modelName + "\\uncompressed\\tex4.tex_bin";
-		m_UncompressedSet.tex4 = read_binary_texture_and_upload(m_Device, cmdQ, cmdB, tex4Path);
+void TextureManager::request_texture_set(TextureMode mode, UploadManager& uploadManager)
+{
+	const uint32_t requestedIdx = set_index(mode);
+	m_Sets[requestedIdx].lastUse = ++m_UseCounter;
+	if (m_Sets[requestedIdx].resident)
+		return;
+	load_set(requestedIdx, uploadManager);
+
+	// Evict the least recently used sets until the budget is met
+	while (m_Budget != 0 && m_Stats.residentBytes > m_Budget)
+	{
+		uint32_t evictedIdx = UINT32_MAX;
+		for (uint32_t setIdx = 0; setIdx < (uint32_t)TextureMode::Neural; ++setIdx)
+		{
+			if (setIdx != requestedIdx && m_Sets[setIdx].resident && (evictedIdx == UINT32_MAX || m_Sets[setIdx].lastUse < m_Sets[evictedIdx].lastUse))
+				evictedIdx = setIdx;
+		}
+		if (evictedIdx == UINT32_MAX)
+			break;
+		m_Stats.numEvictions++;
+		m_Stats.evictedBytes += m_Sets[evictedIdx].sizeInBytes;
+		evict_set(evictedIdx);
 	}
+}
 
-	// Uncompressed textures
+void TextureManager::load_set(uint32_t setIdx, UploadManager& uploadManager)
+{
+	ResidentSet& set = m_Sets[setIdx];
+	Texture* textures[5] = { &set.textures.tex0, &set.textures.tex1, &set.textures.tex2, &set.textures.tex3, &set.textures.tex4 };
+	set.sizeInBytes = 0;
+	for (uint32_t texIdx = 0; texIdx < 5; ++texIdx)
 	{
-		const std::string tex0Path = modelDir + "\\" + modelName + "\\bc6\\tex0.bc6";
-		m_BC6Set.tex0 = read_bc6_texture_and_upload(m_Device, cmdQ, cmdB, tex0Path);
-
-		const std::string tex1Path = modelDir + "\\" + modelName + "\\bc6\\tex1.bc6";
-		m_BC6Set.tex1 = read_bc6_texture_and_upload(m_Device, cmdQ, cmdB, tex1Path);
+		uint64_t texSize = 0;
+		if ((TextureMode)setIdx == TextureMode::BC6H)
+		{
+			const std::string texPath = m_ModelDir + "\\" + m_ModelName + "\\bc6\\tex" + std::to_string(texIdx) + ".bc6";
+			*textures[texIdx] = read_bc6_texture_and_upload(m_Device, uploadManager, texPath, texSize);
+		}
+		else
+		{
+			const std::string texPath = m_ModelDir + "\\" + m_ModelName + "\\uncompressed\\tex" + std::to_string(texIdx) + ".tex_bin";
+			*textures[texIdx] = read_binary_texture_and_upload(m_Device, uploadManager, texPath, texSize);
+		}
+		set.sizeInBytes += texSize;
+	}
+	set.resident = true;
 
-		const std::string tex2Path = modelDir + "\\" + modelName + "\\bc6\\tex2.bc6";
-		m_BC6Set.tex2 = read_bc6_texture_and_upload(m_Device, cmdQ, cmdB, tex2Path);
+	// Stats
+	m_Stats.residentBytes += set.sizeInBytes;
+	m_Stats.numLoads++;
+}
 
-		const std::string tex3Path = modelDir + "\\" + modelName + "\\bc6\\tex3.bc6";
-		m_BC6Set.tex3 = read_bc6_texture_and_upload(m_Device, cmdQ, cmdB, tex3Path);
+void TextureManager::evict_set(uint32_t setIdx)
+{
+	ResidentSet& set = m_Sets[setIdx];
+	graphics::resources::destroy_texture(set.textures.tex0);
+	graphics::resources::destroy_texture(set.textures.tex1);
+	graphics::resources::destroy_texture(set.textures.tex2);
+	graphics::resources::destroy_texture(set.textures.tex3);
+	graphics::resources::destroy_texture(set.textures.tex4);
+	m_Stats.residentBytes -= set.sizeInBytes;
+	set.textures = TextureSet();
+	set.sizeInBytes = 0;
+	set.resident = false;
+}
 
-		const std::string tex4Path = modelDir + "\\" + modelName + "\\bc6\\tex4.bc6";
-		m_BC6Set.tex4 = read_bc6_texture_and_upload(m_Device, cmdQ, cmdB, tex4Path);
-	}
-}
\ No newline at end of file
+void TextureManager::render_ui()
+{
+	ImGui::SeparatorText("Texture residency");
+	const float toMiB = 1.0f / (1024.0f * 1024.0f);
+	if (m_Budget != 0)
+		ImGui::Text("Resident: %.1f / %.1f MiB", (float)m_Stats.residentBytes * toMiB, (float)m_Budget * toMiB);
+	else
+		ImGui::Text("Resident: %.1f MiB", (float)m_Stats.residentBytes * toMiB);
+	ImGui::Text("Loads: %u, Evictions: %u (%.1f MiB)", m_Stats.numLoads, m_Stats.numEvictions, (float)m_Stats.evictedBytes * toMiB);
+}
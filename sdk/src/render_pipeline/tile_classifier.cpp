@@ -93,13 +93,13 @@ void TileClassifier::classify(CommandBuffer cmdB, ConstantBuffer globalCB, Rende
     // Clear the classification data
     {
         // CBVs
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_ResetCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_ResetCS, binding_slot("_GlobalCB"), globalCB);
 
         // Buffers
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, "_ActiveTileBufferRW", m_ActiveTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, "_UniformTileBufferRW", m_UniformTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, "_ComplexTileBufferRW", m_ComplexTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, "_MLPUsageBufferRW", m_MLPUsageBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, binding_slot("_ActiveTileBufferRW"), m_ActiveTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, binding_slot("_UniformTileBufferRW"), m_UniformTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, binding_slot("_ComplexTileBufferRW"), m_ComplexTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_ResetCS, binding_slot("_MLPUsageBufferRW"), m_MLPUsageBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch(cmdB, m_ResetCS, 1, 1, 1);
@@ -109,18 +109,18 @@ void TileClassifier::classify(CommandBuffer cmdB, ConstantBuffer globalCB, Rende
     // First classification
     {
         // CBVs
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_FirstPassCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_FirstPassCS, binding_slot("_GlobalCB"), globalCB);
 
         // SRVs
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_FirstPassCS, "_VisibilityBuffer", visibilityBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, "_VertexBuffer", vertexBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, "_IndexBuffer", indexBuffer);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_FirstPassCS, binding_slot("_VisibilityBuffer"), visibilityBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, binding_slot("_VertexBuffer"), vertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, binding_slot("_IndexBuffer"), indexBuffer);
 
         // UAVs
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, "_ActiveTileBufferRW", m_ActiveTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, "_UniformTileBufferRW", m_UniformTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, "_ComplexTileBufferRW", m_ComplexTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, "_MLPUsageBufferRW", m_MLPUsageBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, binding_slot("_ActiveTileBufferRW"), m_ActiveTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, binding_slot("_UniformTileBufferRW"), m_UniformTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, binding_slot("_ComplexTileBufferRW"), m_ComplexTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_FirstPassCS, binding_slot("_MLPUsageBufferRW"), m_MLPUsageBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch(cmdB, m_FirstPassCS, m_TileSize.x, m_TileSize.y, 1);
@@ -130,16 +130,16 @@ void TileClassifier::classify(CommandBuffer cmdB, ConstantBuffer globalCB, Rende
     // Prepare the indirection
     {
         // CBVs
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_PrepareIndirectionCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_PrepareIndirectionCS, binding_slot("_GlobalCB"), globalCB);
 
         // SRVs
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, "_ActiveTileBuffer", m_ActiveTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, "_UniformTileBuffer", m_UniformTileBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, "_ComplexTileBuffer", m_ComplexTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, binding_slot("_ActiveTileBuffer"), m_ActiveTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, binding_slot("_UniformTileBuffer"), m_UniformTileBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, binding_slot("_ComplexTileBuffer"), m_ComplexTileBuffer);
 
         // UAVs
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, "_MLPUsageBufferRW", m_MLPUsageBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, "_IndirectDispatchBufferRW", m_IndirectBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, binding_slot("_MLPUsageBufferRW"), m_MLPUsageBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_PrepareIndirectionCS, binding_slot("_IndirectDispatchBufferRW"), m_IndirectBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch(cmdB, m_PrepareIndirectionCS, 1, 1, 1);
@@ -149,17 +149,17 @@ void TileClassifier::classify(CommandBuffer cmdB, ConstantBuffer globalCB, Rende
     // Second classification
     {
         // CBUffers
-        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_SecondPassCS, "_GlobalCB", globalCB);
+        graphics::command_buffer::set_compute_shader_cbuffer(cmdB, m_SecondPassCS, binding_slot("_GlobalCB"), globalCB);
 
         // SRVs
-        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_SecondPassCS, "_VisibilityBuffer", visibilityBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, "_VertexBuffer", vertexBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, "_IndexBuffer", indexBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, "_ComplexTileBuffer", m_ComplexTileBuffer);
+        graphics::command_buffer::set_compute_shader_render_texture(cmdB, m_SecondPassCS, binding_slot("_VisibilityBuffer"), visibilityBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, binding_slot("_VertexBuffer"), vertexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, binding_slot("_IndexBuffer"), indexBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, binding_slot("_ComplexTileBuffer"), m_ComplexTileBuffer);
 
         // UAVs
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, "_MLPUsageBufferRW", m_MLPUsageBuffer);
-        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, "_IndexedTilesBufferRW", m_RepackedTilesBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, binding_slot("_MLPUsageBufferRW"), m_MLPUsageBuffer);
+        graphics::command_buffer::set_compute_shader_buffer(cmdB, m_SecondPassCS, binding_slot("_IndexedTilesBufferRW"), m_RepackedTilesBuffer);
 
         // Dispatch + Barrier
         graphics::command_buffer::dispatch_indirect(cmdB, m_SecondPassCS, m_IndirectBuffer, 6 * sizeof(uint32_t));
@@ -0,0 +1,400 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "scene/animation_pca.h"
+#include "math/operators.h"
+#include "tools/file_view.h"
+#include "tools/security.h"
+#include "tools/stream.h"
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <math.h>
+#include <numeric>
+#include <random>
+#include <stddef.h>
+#include <thread>
+
+namespace animation_pca
+{
+    // Floats of a PCAVertex, every one of them is a row of the data matrix
+    const uint32_t vertexFloats = sizeof(PCAVertex) / sizeof(float);
+    static_assert(sizeof(PCAVertex) == 9 * sizeof(float), "Unexpected PCA vertex layout");
+
+    // Rows are distributed dynamically across the threads in batches, task(threadIdx, firstRow, lastRow)
+    template<typename Task>
+    void parallel_rows(uint64_t numRows, uint32_t threadCount, const Task& task)
+    {
+        const uint64_t batchSize = 256;
+        std::atomic<uint64_t> nextBatch(0);
+        auto process_rows = [&](uint32_t threadIdx)
+        {
+            for (uint64_t batchIdx = nextBatch++; batchIdx * batchSize < numRows; batchIdx = nextBatch++)
+                task(threadIdx, batchIdx * batchSize, std::min(numRows, (batchIdx + 1) * batchSize));
+        };
+
+        std::vector<std::thread> workers;
+        for (uint32_t threadIdx = 1; threadIdx < threadCount; ++threadIdx)
+            workers.emplace_back(process_rows, threadIdx);
+        process_rows(0);
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    // output (numRows x m) = input (numRows x n) * matrix (n x m), all row major
+    void multiply(const std::vector<float>& input, uint64_t numRows, uint32_t n, const std::vector<double>& matrix, uint32_t m, std::vector<float>& output, uint32_t threadCount)
+    {
+        output.resize(numRows * m);
+        parallel_rows(numRows, threadCount, [&](uint32_t, uint64_t firstRow, uint64_t lastRow)
+        {
+            std::vector<double> row(m);
+            for (uint64_t rowIdx = firstRow; rowIdx < lastRow; ++rowIdx)
+            {
+                std::fill(row.begin(), row.end(), 0.0);
+                const float* inputRow = input.data() + rowIdx * n;
+                for (uint32_t i = 0; i < n; ++i)
+                {
+                    for (uint32_t j = 0; j < m; ++j)
+                        row[j] += inputRow[i] * matrix[i * m + j];
+                }
+                for (uint32_t j = 0; j < m; ++j)
+                    output[rowIdx * m + j] = (float)row[j];
+            }
+        });
+    }
+
+    // output (n x m) = a^T * b with a (numRows x n) and b (numRows x m), every thread accumulates its own partial sum
+    void transpose_multiply(const std::vector<float>& a, uint32_t n, const std::vector<float>& b, uint32_t m, uint64_t numRows, std::vector<double>& output, uint32_t threadCount)
+    {
+        std::vector<std::vector<double>> partialSums(threadCount, std::vector<double>(n * m, 0.0));
+        parallel_rows(numRows, threadCount, [&](uint32_t threadIdx, uint64_t firstRow, uint64_t lastRow)
+        {
+            double* partialSum = partialSums[threadIdx].data();
+            for (uint64_t rowIdx = firstRow; rowIdx < lastRow; ++rowIdx)
+            {
+                const float* rowA = a.data() + rowIdx * n;
+                const float* rowB = b.data() + rowIdx * m;
+                for (uint32_t i = 0; i < n; ++i)
+                {
+                    for (uint32_t j = 0; j < m; ++j)
+                        partialSum[i * m + j] += (double)rowA[i] * rowB[j];
+                }
+            }
+        });
+
+        output.assign(n * m, 0.0);
+        for (const std::vector<double>& partialSum : partialSums)
+        {
+            for (uint32_t i = 0; i < n * m; ++i)
+                output[i] += partialSum[i];
+        }
+    }
+
+    // Eigen decomposition of a symmetric matrix (cyclic Jacobi), the eigenvectors are the columns sorted by decreasing eigenvalue
+    void symmetric_eigen(std::vector<double> matrix, uint32_t n, std::vector<double>& eigenValues, std::vector<double>& eigenVectors)
+    {
+        std::vector<double> rotation(n * n, 0.0);
+        for (uint32_t i = 0; i < n; ++i)
+            rotation[i * n + i] = 1.0;
+
+        for (uint32_t sweepIdx = 0; sweepIdx < 64; ++sweepIdx)
+        {
+            double diagonal = 0.0;
+            double offDiagonal = 0.0;
+            for (uint32_t p = 0; p < n; ++p)
+            {
+                diagonal += matrix[p * n + p] * matrix[p * n + p];
+                for (uint32_t q = p + 1; q < n; ++q)
+                    offDiagonal += matrix[p * n + q] * matrix[p * n + q];
+            }
+            if (offDiagonal <= 1e-24 * diagonal)
+                break;
+
+            for (uint32_t p = 0; p < n; ++p)
+            {
+                for (uint32_t q = p + 1; q < n; ++q)
+                {
+                    const double apq = matrix[p * n + q];
+                    if (apq == 0.0)
+                        continue;
+
+                    // Rotation that cancels the (p, q) element
+                    const double theta = (matrix[q * n + q] - matrix[p * n + p]) / (2.0 * apq);
+                    const double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                    const double c = 1.0 / sqrt(t * t + 1.0);
+                    const double s = t * c;
+                    for (uint32_t k = 0; k < n; ++k)
+                    {
+                        const double akp = matrix[k * n + p];
+                        const double akq = matrix[k * n + q];
+                        matrix[k * n + p] = c * akp - s * akq;
+                        matrix[k * n + q] = s * akp + c * akq;
+                    }
+                    for (uint32_t k = 0; k < n; ++k)
+                    {
+                        const double apk = matrix[p * n + k];
+                        const double aqk = matrix[q * n + k];
+                        matrix[p * n + k] = c * apk - s * aqk;
+                        matrix[q * n + k] = s * apk + c * aqk;
+                    }
+                    for (uint32_t k = 0; k < n; ++k)
+                    {
+                        const double vkp = rotation[k * n + p];
+                        const double vkq = rotation[k * n + q];
+                        rotation[k * n + p] = c * vkp - s * vkq;
+                        rotation[k * n + q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        // Sort by decreasing eigenvalue
+        std::vector<uint32_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](uint32_t i, uint32_t j) { return matrix[i * n + i] > matrix[j * n + j]; });
+        eigenValues.resize(n);
+        eigenVectors.resize(n * n);
+        for (uint32_t col = 0; col < n; ++col)
+        {
+            eigenValues[col] = matrix[order[col] * n + order[col]];
+            for (uint32_t row = 0; row < n; ++row)
+                eigenVectors[row * n + col] = rotation[row * n + order[col]];
+        }
+    }
+
+    // Orthonormal basis of the columns of y (numRows x numCols) through the eigen decomposition of its Gram matrix.
+    // The dependent columns are dropped, numCols is updated. Two passes restore the orthogonality lost to the squared condition number.
+    void orthonormalize(std::vector<float>& y, uint64_t numRows, uint32_t& numCols, uint32_t threadCount)
+    {
+        for (uint32_t passIdx = 0; passIdx < 2; ++passIdx)
+        {
+            std::vector<double> gram, eigenValues, eigenVectors;
+            transpose_multiply(y, numCols, y, numCols, numRows, gram, threadCount);
+            symmetric_eigen(gram, numCols, eigenValues, eigenVectors);
+
+            uint32_t rank = 0;
+            while (rank < numCols && eigenValues[rank] > 1e-10 * eigenValues[0])
+                ++rank;
+            std::vector<double> normalization(numCols * rank);
+            for (uint32_t row = 0; row < numCols; ++row)
+            {
+                for (uint32_t col = 0; col < rank; ++col)
+                    normalization[row * rank + col] = eigenVectors[row * numCols + col] / sqrt(eigenValues[col]);
+            }
+
+            std::vector<float> q;
+            multiply(y, numRows, numCols, normalization, rank, q, threadCount);
+            y.swap(q);
+            numCols = rank;
+        }
+    }
+
+    // Position, normal and tangent are contiguous in VertexData
+    const float* vertex_floats(const VertexData& vertex)
+    {
+        return &vertex.position.x;
+    }
+
+    void compress_animation(const MeshAnimation& meshAnimation, const PCASettings& settings, PCAMeshAnimation& pcaAnimation, PCAReport& report)
+    {
+        static_assert(offsetof(VertexData, normal) == sizeof(float3) && offsetof(VertexData, tangent) == 2 * sizeof(float3), "Unexpected vertex layout");
+        const uint32_t numFrames = (uint32_t)meshAnimation.vertexBufferArray.size();
+        assert_msg(numFrames > 0, "Empty mesh animation\n");
+        const uint32_t numVertices = (uint32_t)meshAnimation.vertexBufferArray[0].data.size();
+        assert_msg(numVertices > 0, "Empty mesh animation\n");
+        for (const VertexBuffer& frame : meshAnimation.vertexBufferArray)
+            assert_msg(frame.data.size() == numVertices, "Inconsistent mesh animation\n");
+        const uint64_t numRows = (uint64_t)numVertices * vertexFloats;
+        const uint32_t threadCount = settings.numThreads != 0 ? settings.numThreads : std::max(std::thread::hardware_concurrency(), 1u);
+
+        pcaAnimation.numFrames = numFrames;
+        pcaAnimation.numVertices = numVertices;
+        pcaAnimation.indexBuffer = meshAnimation.indexBuffer;
+        pcaAnimation.attributes.resize(numVertices);
+        for (uint32_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+        {
+            const VertexData& vertex = meshAnimation.vertexBufferArray[0].data[vertIdx];
+            pcaAnimation.attributes[vertIdx] = { vertex.texCoord, vertex.matID };
+        }
+
+        // Centered data matrix, one row per animated float and one column per frame
+        std::vector<float> data(numRows * numFrames);
+        pcaAnimation.mean.resize(numVertices);
+        float* mean = &pcaAnimation.mean[0].position.x;
+        parallel_rows(numVertices, threadCount, [&](uint32_t, uint64_t firstVertex, uint64_t lastVertex)
+        {
+            for (uint64_t vertIdx = firstVertex; vertIdx < lastVertex; ++vertIdx)
+            {
+                for (uint32_t c = 0; c < vertexFloats; ++c)
+                {
+                    const uint64_t rowIdx = vertIdx * vertexFloats + c;
+                    double sum = 0.0;
+                    for (uint32_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+                        sum += vertex_floats(meshAnimation.vertexBufferArray[frameIdx].data[vertIdx])[c];
+                    mean[rowIdx] = (float)(sum / numFrames);
+                    for (uint32_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+                        data[rowIdx * numFrames + frameIdx] = vertex_floats(meshAnimation.vertexBufferArray[frameIdx].data[vertIdx])[c] - mean[rowIdx];
+                }
+            }
+        });
+
+        // Range of the data: random projection, then power iterations to sharpen the spectrum
+        uint32_t rangeSize = std::min(settings.numComponents + settings.oversampling, numFrames);
+        std::vector<double> projection(numFrames * rangeSize);
+        std::mt19937 generator(0x5eed);
+        std::normal_distribution<double> distribution;
+        for (double& value : projection)
+            value = distribution(generator);
+        std::vector<float> range;
+        multiply(data, numRows, numFrames, projection, rangeSize, range, threadCount);
+        orthonormalize(range, numRows, rangeSize, threadCount);
+        for (uint32_t iterationIdx = 0; iterationIdx < settings.powerIterations && rangeSize > 0; ++iterationIdx)
+        {
+            transpose_multiply(data, numFrames, range, rangeSize, numRows, projection, threadCount);
+            multiply(data, numRows, numFrames, projection, rangeSize, range, threadCount);
+            orthonormalize(range, numRows, rangeSize, threadCount);
+        }
+
+        // SVD of the small projected matrix (rangeSize x numFrames) through its Gram matrix
+        std::vector<double> projected, gram, eigenValues, eigenVectors;
+        transpose_multiply(range, rangeSize, data, numFrames, numRows, projected, threadCount);
+        gram.assign(rangeSize * rangeSize, 0.0);
+        for (uint32_t i = 0; i < rangeSize; ++i)
+        {
+            for (uint32_t j = 0; j < rangeSize; ++j)
+            {
+                for (uint32_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+                    gram[i * rangeSize + j] += projected[i * numFrames + frameIdx] * projected[j * numFrames + frameIdx];
+            }
+        }
+        symmetric_eigen(gram, rangeSize, eigenValues, eigenVectors);
+        const uint32_t numComponents = std::min(settings.numComponents, rangeSize);
+        pcaAnimation.numComponents = numComponents;
+
+        // Basis vectors (left singular vectors) and per frame coefficients
+        std::vector<double> rotation(rangeSize * numComponents);
+        for (uint32_t row = 0; row < rangeSize; ++row)
+        {
+            for (uint32_t col = 0; col < numComponents; ++col)
+                rotation[row * numComponents + col] = eigenVectors[row * rangeSize + col];
+        }
+        std::vector<float> basis;
+        multiply(range, numRows, rangeSize, rotation, numComponents, basis, threadCount);
+        pcaAnimation.basis.resize((uint64_t)numComponents * numVertices);
+        float* basisFloats = pcaAnimation.basis.empty() ? nullptr : &pcaAnimation.basis[0].position.x;
+        for (uint32_t compIdx = 0; compIdx < numComponents; ++compIdx)
+        {
+            for (uint64_t rowIdx = 0; rowIdx < numRows; ++rowIdx)
+                basisFloats[compIdx * numRows + rowIdx] = basis[rowIdx * numComponents + compIdx];
+        }
+        pcaAnimation.coefficients.assign((uint64_t)numFrames * numComponents, 0.0f);
+        for (uint32_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+        {
+            for (uint32_t compIdx = 0; compIdx < numComponents; ++compIdx)
+            {
+                double coefficient = 0.0;
+                for (uint32_t row = 0; row < rangeSize; ++row)
+                    coefficient += rotation[row * numComponents + compIdx] * projected[row * numFrames + frameIdx];
+                pcaAnimation.coefficients[frameIdx * numComponents + compIdx] = (float)coefficient;
+            }
+        }
+
+        // Share of the variance kept by the basis
+        double totalVariance = 0.0;
+        for (const float value : data)
+            totalVariance += (double)value * value;
+        double keptVariance = 0.0;
+        for (uint32_t compIdx = 0; compIdx < numComponents; ++compIdx)
+            keptVariance += eigenValues[compIdx];
+        report.explainedVariance = totalVariance > 0.0 ? (float)std::min(keptVariance / totalVariance, 1.0) : 1.0f;
+
+        // Reconstruction error
+        report.maxPositionError = 0.0f;
+        report.maxNormalError = 0.0f;
+        VertexBuffer reconstructed;
+        for (uint32_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+        {
+            reconstruct_frame(pcaAnimation, frameIdx, reconstructed);
+            const std::vector<VertexData>& frame = meshAnimation.vertexBufferArray[frameIdx].data;
+            for (uint32_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+            {
+                report.maxPositionError = std::max(report.maxPositionError, length(reconstructed.data[vertIdx].position - frame[vertIdx].position));
+                report.maxNormalError = std::max(report.maxNormalError, length(reconstructed.data[vertIdx].normal - frame[vertIdx].normal));
+            }
+        }
+    }
+
+    void reconstruct_frame(const PCAMeshAnimation& pcaAnimation, uint32_t frameIdx, VertexBuffer& vertexBuffer)
+    {
+        const uint32_t numVertices = pcaAnimation.numVertices;
+        const float* coefficients = pcaAnimation.coefficients.data() + (uint64_t)frameIdx * pcaAnimation.numComponents;
+        vertexBuffer.data.resize(numVertices);
+        for (uint32_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+        {
+            PCAVertex animated = pcaAnimation.mean[vertIdx];
+            for (uint32_t compIdx = 0; compIdx < pcaAnimation.numComponents; ++compIdx)
+            {
+                const PCAVertex& basisVertex = pcaAnimation.basis[(uint64_t)compIdx * numVertices + vertIdx];
+                animated.position = animated.position + basisVertex.position * coefficients[compIdx];
+                animated.normal = animated.normal + basisVertex.normal * coefficients[compIdx];
+                animated.tangent = animated.tangent + basisVertex.tangent * coefficients[compIdx];
+            }
+
+            VertexData& vertex = vertexBuffer.data[vertIdx];
+            vertex.position = animated.position;
+            vertex.normal = normalize(animated.normal);
+            vertex.tangent = normalize(animated.tangent);
+            vertex.texCoord = pcaAnimation.attributes[vertIdx].texCoord;
+            vertex.matID = pcaAnimation.attributes[vertIdx].matID;
+        }
+    }
+
+    void import_animation(const char* path, PCAMeshAnimation& pcaAnimation)
+    {
+        // Map the file and check it
+        FileView binaryFile;
+        assert_msg(binaryFile.open(path), "Failed to open PCA animation\n");
+        StreamReader reader(binaryFile.data(), binaryFile.size());
+        assert_msg(reader.verify_checksum(true), "Corrupted PCA animation\n");
+
+        uint32_t tag = 0;
+        reader.read_bytes(tag);
+        assert_msg(tag == PCA_ANIMATION_TAG, "Invalid PCA animation\n");
+        reader.read_bytes(pcaAnimation.numFrames);
+        reader.read_bytes(pcaAnimation.numVertices);
+        reader.read_bytes(pcaAnimation.numComponents);
+        reader.read_vector_bytes(pcaAnimation.indexBuffer);
+        reader.read_vector_bytes(pcaAnimation.attributes);
+        reader.read_vector_bytes(pcaAnimation.mean);
+        reader.read_vector_bytes(pcaAnimation.basis);
+        reader.read_vector_bytes(pcaAnimation.coefficients);
+        assert_msg(!reader.failed(), "Truncated PCA animation\n");
+        assert_msg(pcaAnimation.attributes.size() == pcaAnimation.numVertices
+            && pcaAnimation.mean.size() == pcaAnimation.numVertices
+            && pcaAnimation.basis.size() == (uint64_t)pcaAnimation.numComponents * pcaAnimation.numVertices
+            && pcaAnimation.coefficients.size() == (uint64_t)pcaAnimation.numFrames * pcaAnimation.numComponents, "Invalid PCA animation\n");
+    }
+
+    void export_animation(const PCAMeshAnimation& pcaAnimation, const char* path)
+    {
+        StreamWriter writer;
+        assert_msg(writer.open(path), "Failed to create PCA animation\n");
+        writer.write_bytes<uint32_t>(PCA_ANIMATION_TAG);
+        writer.write_bytes(pcaAnimation.numFrames);
+        writer.write_bytes(pcaAnimation.numVertices);
+        writer.write_bytes(pcaAnimation.numComponents);
+        writer.write_vector_bytes(pcaAnimation.indexBuffer);
+        writer.write_vector_bytes(pcaAnimation.attributes);
+        writer.write_vector_bytes(pcaAnimation.mean);
+        writer.write_vector_bytes(pcaAnimation.basis);
+        writer.write_vector_bytes(pcaAnimation.coefficients);
+        writer.write_checksum();
+        assert_msg(writer.close(), "Failed to write PCA animation\n");
+    }
+}
@@ -7,64 +7,234 @@
 
 // Includes
 #include "scene/mesh.h"
+#include "math/operators.h"
+#include "tools/file_view.h"
+#include "tools/security.h"
 #include "tools/stream.h"
 
+// System includes
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+
 namespace mesh
 {
     void import_mesh_animation(const char* path, MeshAnimation& meshAnimation)
     {
-        // Vector that will hold our packed meshAnimation 
-        std::vector<char> binaryFile;
-
-        // Read from disk
-        FILE* pFile;
-        pFile = fopen(path, "rb");
-        fseek(pFile, 0L, SEEK_END);
-        size_t fileSize = _ftelli64(pFile);
-        binaryFile.resize(fileSize);
-        _fseeki64(pFile, 0L, SEEK_SET);
-        rewind(pFile);
-        fread(binaryFile.data(), sizeof(char), fileSize, pFile);
-        fclose(pFile);
-
-        // Pack the structure in a buffer
-        const char* binaryPtr = binaryFile.data();
+        // Map the file and check it
+        FileView binaryFile;
+        assert_msg(binaryFile.open(path), "Failed to open mesh animation\n");
+        StreamReader reader(binaryFile.data(), binaryFile.size());
+        assert_msg(reader.verify_checksum(), "Corrupted mesh animation\n");
 
         // Read the index buffers
-        unpack_vector_bytes(binaryPtr, meshAnimation.indexBuffer);
+        reader.read_vector_bytes(meshAnimation.indexBuffer);
 
         // Read the number of frames
-        uint32_t numFrames;
-        unpack_bytes(binaryPtr, numFrames);
+        uint32_t numFrames = 0;
+        reader.read_bytes(numFrames);
 
         // Read the vertex buffers
         meshAnimation.vertexBufferArray.resize(numFrames);
-        for (uint32_t idx = 0; idx < numFrames; ++idx)
+        for (uint32_t idx = 0; idx < numFrames && !reader.failed(); ++idx)
         {
-            unpack_vector_bytes(binaryPtr, meshAnimation.vertexBufferArray[idx].data);
+            reader.read_vector_bytes(meshAnimation.vertexBufferArray[idx].data);
         }
+        assert_msg(!reader.failed(), "Truncated mesh animation\n");
     }
 
     void export_mesh_animation(const MeshAnimation& meshAnimation, const char* path)
     {
-        // Vector that will hold our packed mesh 
-        std::vector<char> binaryFile;
+        // The frames are streamed to disk, nothing is packed in memory
+        StreamWriter writer;
+        assert_msg(writer.open(path), "Failed to create mesh animation\n");
 
         // Write the index buffer
-        pack_vector_bytes(binaryFile, meshAnimation.indexBuffer);
+        writer.write_vector_bytes(meshAnimation.indexBuffer);
 
         // Write the number of frames
         uint32_t numFrames = (uint32_t)meshAnimation.vertexBufferArray.size();
-        pack_bytes(binaryFile, numFrames);
+        writer.write_bytes(numFrames);
 
         // Write the vertex buffers
         for (uint32_t idx = 0; idx < numFrames; ++idx)
-            pack_vector_bytes(binaryFile, meshAnimation.vertexBufferArray[idx].data);
+            writer.write_vector_bytes(meshAnimation.vertexBufferArray[idx].data);
+
+        // Checksum of the whole content
+        writer.write_checksum();
+        assert_msg(writer.close(), "Failed to write mesh animation\n");
+    }
+
+    // Quantization steps of the compact vertices
+    const float3 positionSteps = { 2047.0f, 2047.0f, 1023.0f };
+    const float normalSteps = 2047.0f;
+    const float tangentSteps = 1024.0f;
+    const float twoPi = 6.28318530718f;
+
+    float2 octahedral_encode(float3 n)
+    {
+        n = n / (fabsf(n.x) + fabsf(n.y) + fabsf(n.z));
+        if (n.z >= 0.0f)
+            return { n.x, n.y };
+        return { (1.0f - fabsf(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f), (1.0f - fabsf(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f) };
+    }
+
+    float3 octahedral_decode(float2 e)
+    {
+        float3 n = { e.x, e.y, 1.0f - fabsf(e.x) - fabsf(e.y) };
+        const float t = std::max(-n.z, 0.0f);
+        n.x += n.x >= 0.0f ? -t : t;
+        n.y += n.y >= 0.0f ? -t : t;
+        return normalize(n);
+    }
+
+    // Orthonormal basis around a unit vector (Duff et al. 2017)
+    void tangent_basis(const float3& n, float3& b1, float3& b2)
+    {
+        const float sign = n.z >= 0.0f ? 1.0f : -1.0f;
+        const float a = -1.0f / (sign + n.z);
+        const float b = n.x * n.y * a;
+        b1 = { 1.0f + sign * n.x * n.x * a, sign * b, -sign * n.x };
+        b2 = { b, sign + n.y * n.y * a, -n.y };
+    }
+
+    uint32_t quantize(float value, float steps)
+    {
+        return (uint32_t)std::clamp(value * steps + 0.5f, 0.0f, steps);
+    }
+
+    CompactVertex encode_vertex(const VertexData& vertex, const AnimationBaseVertex& base, const AnimationFrameBounds& bounds)
+    {
+        CompactVertex compact;
+
+        // Position delta in the bounds of the frame
+        const float3 delta = vertex.position - base.position;
+        const float3 range = bounds.scale * positionSteps;
+        const float3 unorm = { range.x > 0.0f ? (delta.x - bounds.minimum.x) / range.x : 0.0f, range.y > 0.0f ? (delta.y - bounds.minimum.y) / range.y : 0.0f, range.z > 0.0f ? (delta.z - bounds.minimum.z) / range.z : 0.0f };
+        compact.position = quantize(unorm.x, positionSteps.x) | (quantize(unorm.y, positionSteps.y) << 11) | (quantize(unorm.z, positionSteps.z) << 22);
+
+        // Octahedral normal
+        const float2 octNormal = octahedral_encode(vertex.normal);
+        const uint32_t normalX = quantize(octNormal.x * 0.5f + 0.5f, normalSteps);
+        const uint32_t normalY = quantize(octNormal.y * 0.5f + 0.5f, normalSteps);
 
-        // Write to disk
-        FILE* pFile;
-        pFile = fopen(path, "wb");
-        fwrite(binaryFile.data(), sizeof(char), binaryFile.size(), pFile);
-        fclose(pFile);
+        // The tangent angle is measured around the decoded normal, as in the shader
+        const float3 decodedNormal = octahedral_decode({ normalX / normalSteps * 2.0f - 1.0f, normalY / normalSteps * 2.0f - 1.0f });
+        float3 b1, b2;
+        tangent_basis(decodedNormal, b1, b2);
+        float angle = atan2f(dot(vertex.tangent, b2), dot(vertex.tangent, b1)) / twoPi;
+        angle = angle < 0.0f ? angle + 1.0f : angle;
+        const uint32_t tangent = (uint32_t)(angle * tangentSteps + 0.5f) & 0x3ff;
+        compact.frame = normalX | (normalY << 11) | (tangent << 22);
+        return compact;
+    }
+
+    void compress_animation(const MeshAnimation& meshAnimation, CompactMeshAnimation& compactAnimation)
+    {
+        compactAnimation.numFrames = (uint32_t)meshAnimation.vertexBufferArray.size();
+        compactAnimation.numVertices = compactAnimation.numFrames > 0 ? (uint32_t)meshAnimation.vertexBufferArray[0].data.size() : 0;
+        compactAnimation.indexBuffer = meshAnimation.indexBuffer;
+
+        // Shared attributes, taken from the first frame
+        const uint32_t numVertices = compactAnimation.numVertices;
+        compactAnimation.baseVertices.resize(numVertices);
+        for (uint32_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+        {
+            const VertexData& vertex = meshAnimation.vertexBufferArray[0].data[vertIdx];
+            compactAnimation.baseVertices[vertIdx] = { vertex.position, vertex.texCoord, vertex.matID };
+        }
+
+        compactAnimation.frameBounds.resize(compactAnimation.numFrames);
+        compactAnimation.frameVertices.resize((uint64_t)compactAnimation.numFrames * numVertices);
+        for (uint32_t frameIdx = 0; frameIdx < compactAnimation.numFrames; ++frameIdx)
+        {
+            const std::vector<VertexData>& frame = meshAnimation.vertexBufferArray[frameIdx].data;
+            assert_msg(frame.size() == numVertices, "Inconsistent mesh animation\n");
+
+            // Bounds of the deltas of the frame
+            float3 minimum = { FLT_MAX, FLT_MAX, FLT_MAX };
+            float3 maximum = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            for (uint32_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+            {
+                const float3 delta = frame[vertIdx].position - compactAnimation.baseVertices[vertIdx].position;
+                minimum = { std::min(minimum.x, delta.x), std::min(minimum.y, delta.y), std::min(minimum.z, delta.z) };
+                maximum = { std::max(maximum.x, delta.x), std::max(maximum.y, delta.y), std::max(maximum.z, delta.z) };
+            }
+            AnimationFrameBounds& bounds = compactAnimation.frameBounds[frameIdx];
+            bounds = AnimationFrameBounds();
+            if (numVertices > 0)
+            {
+                bounds.minimum = minimum;
+                bounds.scale = (maximum - minimum) / positionSteps;
+            }
+
+            CompactVertex* compactFrame = compactAnimation.frameVertices.data() + (uint64_t)frameIdx * numVertices;
+            for (uint32_t vertIdx = 0; vertIdx < numVertices; ++vertIdx)
+                compactFrame[vertIdx] = encode_vertex(frame[vertIdx], compactAnimation.baseVertices[vertIdx], bounds);
+        }
+    }
+
+    void decompress_frame(const CompactMeshAnimation& compactAnimation, uint32_t frameIdx, VertexBuffer& vertexBuffer)
+    {
+        const AnimationFrameBounds& bounds = compactAnimation.frameBounds[frameIdx];
+        const CompactVertex* compactFrame = compactAnimation.frameVertices.data() + (uint64_t)frameIdx * compactAnimation.numVertices;
+        vertexBuffer.data.resize(compactAnimation.numVertices);
+        for (uint32_t vertIdx = 0; vertIdx < compactAnimation.numVertices; ++vertIdx)
+        {
+            const AnimationBaseVertex& base = compactAnimation.baseVertices[vertIdx];
+            const CompactVertex& compact = compactFrame[vertIdx];
+            VertexData& vertex = vertexBuffer.data[vertIdx];
+
+            const float3 quantized = { (float)(compact.position & 0x7ff), (float)((compact.position >> 11) & 0x7ff), (float)(compact.position >> 22) };
+            vertex.position = base.position + bounds.minimum + quantized * bounds.scale;
+
+            const float2 octNormal = { (compact.frame & 0x7ff) / normalSteps * 2.0f - 1.0f, ((compact.frame >> 11) & 0x7ff) / normalSteps * 2.0f - 1.0f };
+            vertex.normal = octahedral_decode(octNormal);
+            float3 b1, b2;
+            tangent_basis(vertex.normal, b1, b2);
+            const float angle = (compact.frame >> 22) / tangentSteps * twoPi;
+            vertex.tangent = b1 * cosf(angle) + b2 * sinf(angle);
+
+            vertex.texCoord = base.texCoord;
+            vertex.matID = base.matID;
+        }
+    }
+
+    void import_compact_animation(const char* path, CompactMeshAnimation& compactAnimation)
+    {
+        // Map the file and check it
+        FileView binaryFile;
+        assert_msg(binaryFile.open(path), "Failed to open compact animation\n");
+        StreamReader reader(binaryFile.data(), binaryFile.size());
+        assert_msg(reader.verify_checksum(true), "Corrupted compact animation\n");
+
+        uint32_t tag = 0;
+        reader.read_bytes(tag);
+        assert_msg(tag == COMPACT_ANIMATION_TAG, "Invalid compact animation\n");
+        reader.read_bytes(compactAnimation.numFrames);
+        reader.read_bytes(compactAnimation.numVertices);
+        reader.read_vector_bytes(compactAnimation.indexBuffer);
+        reader.read_vector_bytes(compactAnimation.baseVertices);
+        reader.read_vector_bytes(compactAnimation.frameBounds);
+        reader.read_vector_bytes(compactAnimation.frameVertices);
+        assert_msg(!reader.failed(), "Truncated compact animation\n");
+        assert_msg(compactAnimation.baseVertices.size() == compactAnimation.numVertices
+            && compactAnimation.frameBounds.size() == compactAnimation.numFrames
+            && compactAnimation.frameVertices.size() == (uint64_t)compactAnimation.numFrames * compactAnimation.numVertices, "Invalid compact animation\n");
+    }
+
+    void export_compact_animation(const CompactMeshAnimation& compactAnimation, const char* path)
+    {
+        StreamWriter writer;
+        assert_msg(writer.open(path), "Failed to create compact animation\n");
+        writer.write_bytes<uint32_t>(COMPACT_ANIMATION_TAG);
+        writer.write_bytes(compactAnimation.numFrames);
+        writer.write_bytes(compactAnimation.numVertices);
+        writer.write_vector_bytes(compactAnimation.indexBuffer);
+        writer.write_vector_bytes(compactAnimation.baseVertices);
+        writer.write_vector_bytes(compactAnimation.frameBounds);
+        writer.write_vector_bytes(compactAnimation.frameVertices);
+        writer.write_checksum();
+        assert_msg(writer.close(), "Failed to write compact animation\n");
     }
 }
\ No newline at end of file
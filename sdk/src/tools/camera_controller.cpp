@@ -233,7 +233,8 @@ void CameraController::update(double deltaTime)
             float3 pos = lerp(m_PositionSpline[0], m_PositionSpline[1], t);
             float4 rot = slerp(m_RotationSpline[0], m_RotationSpline[1], t);
             rot = normalize(rot);
-            float fov = lerp(m_FOVSpline[0], m_FOVSpline[1], t);
+            // Scalar lerp spelled out, libstdc++ also exposes std::lerp through math.h
+            float fov = m_FOVSpline[0] * (1.0f - t) + m_FOVSpline[1] * t;
 
             // Update the camera data
             m_Camera.position = pos;
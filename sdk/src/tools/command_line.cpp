@@ -45,6 +45,21 @@ namespace command_line
 				commandLineOptions.adapterIndex = atoi(args[current_arg_idx + 1].c_str());
 				current_arg_idx += 2;
 			}
+			else if (args[current_arg_idx] == "--null-backend")
+			{
+				commandLineOptions.nullBackend = true;
+				current_arg_idx += 1;
+			}
+			else if (args[current_arg_idx] == "--frame-count")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide a number of frames.");
+					continue;
+				}
+				commandLineOptions.frameCount = (uint32_t)std::max(atoi(args[current_arg_idx + 1].c_str()), 0);
+				current_arg_idx += 2;
+			}
 			else if (args[current_arg_idx] == "--poi")
 			{
 				if (current_arg_idx == num_args - 1)
@@ -95,17 +110,147 @@ namespace command_line
 				commandLineOptions.filteringMode = (FilteringMode)clamp(atoi(args[current_arg_idx + 1].c_str()), 0, 2);
 				current_arg_idx += 2;
 			}
+			else if (args[current_arg_idx] == "--animation-ring")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide a number of key frames.");
+					continue;
+				}
+				commandLineOptions.animationRingSize = (uint32_t)std::max(atoi(args[current_arg_idx + 1].c_str()), 0);
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--texture-budget")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide a budget in MiB.");
+					continue;
+				}
+				commandLineOptions.textureBudget = (uint32_t)std::max(atoi(args[current_arg_idx + 1].c_str()), 0);
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--feature-textures")
+			{
+				commandLineOptions.featureTextures = true;
+				current_arg_idx += 1;
+			}
+			else if (args[current_arg_idx] == "--benchmark-feature-textures")
+			{
+				commandLineOptions.benchmarkFeatureTextures = true;
+				current_arg_idx += 1;
+			}
+			else if (args[current_arg_idx] == "--prune-network")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide an output directory.");
+					continue;
+				}
+				commandLineOptions.pruneOutputDir = args[current_arg_idx + 1];
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--prune-threshold")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide a pruning threshold.");
+					continue;
+				}
+				commandLineOptions.pruneThreshold = (float)atof(args[current_arg_idx + 1].c_str());
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--prune-max-width")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide a maximal hidden width (multiple of 16).");
+					continue;
+				}
+				commandLineOptions.pruneMaxWidth = (uint32_t)atoi(args[current_arg_idx + 1].c_str()) / 16 * 16;
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--export-int8")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide an output directory.");
+					continue;
+				}
+				commandLineOptions.exportInt8Dir = args[current_arg_idx + 1];
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--export-container")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide an output file.");
+					continue;
+				}
+				commandLineOptions.exportContainerPath = args[current_arg_idx + 1];
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--export-half-weights")
+			{
+				commandLineOptions.exportHalfWeights = true;
+				current_arg_idx += 1;
+			}
+			else if (args[current_arg_idx] == "--compress-animation")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide an output file.");
+					continue;
+				}
+				commandLineOptions.compressAnimationPath = args[current_arg_idx + 1];
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--compress-animation-pca")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide an output file.");
+					continue;
+				}
+				commandLineOptions.pcaAnimationPath = args[current_arg_idx + 1];
+				current_arg_idx += 2;
+			}
+			else if (args[current_arg_idx] == "--pca-components")
+			{
+				if (current_arg_idx == num_args - 1)
+				{
+					printf("Command line parser: please provide a number of components.");
+					continue;
+				}
+				commandLineOptions.pcaComponents = (uint32_t)std::max(atoi(args[current_arg_idx + 1].c_str()), 1);
+				current_arg_idx += 2;
+			}
 			else if (args[current_arg_idx] == "--help")
 			{
 				printf("Option list:\n");
 				printf("--data-dir Location of the resource folders.\n");
 				printf("--adapter-id Integer that allows to pick the desired GPU [-1 = Largest VRAM, >= 0 System adapter ID].\n");
+				printf("--null-backend Record the frames on the headless null backend and report their CPU cost at exit.\n");
+				printf("--frame-count Number of frames rendered before exiting [0 = Unlimited].\n");
 				printf("--poi Integer that allows to pick the initial camera location.\n");
 				printf("--disable-coop Disable cooperative vector usage at launch.\n");
 				printf("--disable-animation Disable mesh animation at launch.\n");
 				printf("--rendering-mode Pick the rendering mode [0 = Material, 1 = GBuffer, 2 = Debug].\n");
 				printf("--texture-mode Pick the texture mode [0 = Uncompressed, 1 = BC6, 2 = Neural].\n");
 				printf("--filtering-mode Pick the filtering mode [0 = Nearest, 1 = Linear, 2 = Anisotropic].\n");
+				printf("--animation-ring Number of key frames kept resident on the GPU, the others are streamed [0 = All].\n");
+				printf("--texture-budget VRAM budget of the uncompressed and BC6 texture sets in MiB, loaded on first use and evicted least recently used [0 = Unlimited].\n");
+				printf("--feature-textures Bake the first layer of the network in feature textures.\n");
+				printf("--benchmark-feature-textures Compare the feature textures to the latent space on the CPU and exit.\n");
+				printf("--prune-network Remove the dead and low contribution hidden neurons, write the mlp_*.bin files to the given directory and exit.\n");
+				printf("--prune-threshold Contribution below which a neuron is removed, relative to the largest one of its layer.\n");
+				printf("--prune-max-width Upper bound of the pruned hidden widths [0 = Threshold only].\n");
+				printf("--export-int8 Quantize the weights of the network to int8, write the mlp_*.bin files to the given directory and exit.\n");
+				printf("--export-container Convert the model directory to a single .tsnc file at the given path and exit.\n");
+				printf("--export-half-weights Store the float weights of the exported container in fp16.\n");
+				printf("--compress-animation Convert the mesh animation to a quantized .canim file at the given path and exit.\n");
+				printf("--compress-animation-pca Compress the mesh animation to a low rank basis in a .pcanim file at the given path and exit.\n");
+				printf("--pca-components Size of the basis of the PCA animation.\n");
 				return false;
 			}
 			else
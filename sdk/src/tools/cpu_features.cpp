@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "tools/cpu_features.h"
+
+// System includes
+#include <stdint.h>
+#if defined(CPU_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(CPU_X64)
+static void cpuid(uint32_t leaf, uint32_t subLeaf, uint32_t regs[4])
+{
+#if defined(_MSC_VER)
+    __cpuidex((int*)regs, (int)leaf, (int)subLeaf);
+#else
+    __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t read_xcr0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif
+
+static CPUFeatures query_cpu_features()
+{
+    CPUFeatures features;
+#if defined(CPU_X64)
+    uint32_t regs[4];
+    cpuid(0, 0, regs);
+    const uint32_t maxLeaf = regs[0];
+
+    // Leaf 1: SSE4.2, FMA, F16C and OS support for the extended states
+    cpuid(1, 0, regs);
+    features.sse42 = (regs[2] & (1u << 20)) != 0;
+    bool osxsave = (regs[2] & (1u << 27)) != 0;
+    bool avx = (regs[2] & (1u << 28)) != 0;
+    bool fma = (regs[2] & (1u << 12)) != 0;
+    bool f16c = (regs[2] & (1u << 29)) != 0;
+
+    // The OS needs to save the ymm (and zmm) registers
+    uint64_t xcr0 = osxsave ? read_xcr0() : 0;
+    bool ymmState = (xcr0 & 0x6) == 0x6;
+    bool zmmState = (xcr0 & 0xe6) == 0xe6;
+
+    // Leaf 7: AVX2 and AVX-512
+    if (maxLeaf >= 7)
+    {
+        cpuid(7, 0, regs);
+        bool avx2 = (regs[1] & (1u << 5)) != 0;
+        bool avx512f = (regs[1] & (1u << 16)) != 0;
+        bool avx512bw = (regs[1] & (1u << 30)) != 0;
+        bool avx512vl = (regs[1] & (1u << 31)) != 0;
+        bool avx512vnni = (regs[2] & (1u << 11)) != 0;
+
+        features.fma = avx && ymmState && fma;
+        features.f16c = avx && ymmState && f16c;
+        features.avx2 = avx && ymmState && avx2 && features.fma && features.f16c;
+        features.avx512 = features.avx2 && zmmState && avx512f && avx512bw && avx512vl;
+        features.avx512vnni = features.avx512 && avx512vnni;
+    }
+#endif
+    return features;
+}
+
+const CPUFeatures& cpu_features()
+{
+    static const CPUFeatures features = query_cpu_features();
+    return features;
+}
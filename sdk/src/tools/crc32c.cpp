@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "tools/crc32c.h"
+#include "tools/cpu_features.h"
+
+// System includes
+#include <string.h>
+#if defined(CPU_X64)
+#include <nmmintrin.h>
+#elif defined(CPU_ARM64) && (defined(_MSC_VER) || defined(__ARM_FEATURE_CRC32))
+#define CRC32C_ARM64
+#include <arm_acle.h>
+#endif
+
+namespace crc32c
+{
+    // Reflected Castagnoli polynomial
+    #define CRC32C_POLYNOMIAL 0x82F63B78
+
+    struct CRCTable
+    {
+        uint32_t entries[256];
+    };
+
+    constexpr CRCTable build_table()
+    {
+        CRCTable table = {};
+        for (uint32_t byte = 0; byte < 256; ++byte)
+        {
+            uint32_t crc = byte;
+            for (uint32_t bit = 0; bit < 8; ++bit)
+                crc = (crc >> 1) ^ ((crc & 1) ? CRC32C_POLYNOMIAL : 0);
+            table.entries[byte] = crc;
+        }
+        return table;
+    }
+
+    static constexpr CRCTable crcTable = build_table();
+
+    uint32_t update_scalar(uint32_t crc, const uint8_t* data, uint64_t size)
+    {
+        for (uint64_t i = 0; i < size; ++i)
+            crc = crcTable.entries[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return crc;
+    }
+
+#if defined(CPU_X64)
+    // One 8 byte step per cycle of throughput, the dependency chain (3 cycles) is the limit: 8 to 10 GB/s
+    TARGET_SSE42 uint32_t update_sse42(uint32_t crc, const uint8_t* data, uint64_t size)
+    {
+        // Head bytes up to the 8 byte alignment
+        for (; size > 0 && ((uintptr_t)data & 7) != 0; --size)
+            crc = _mm_crc32_u8(crc, *data++);
+
+        uint64_t crc64 = crc;
+        for (; size >= 32; size -= 32, data += 32)
+        {
+            uint64_t words[4];
+            memcpy(words, data, sizeof(words));
+            crc64 = _mm_crc32_u64(crc64, words[0]);
+            crc64 = _mm_crc32_u64(crc64, words[1]);
+            crc64 = _mm_crc32_u64(crc64, words[2]);
+            crc64 = _mm_crc32_u64(crc64, words[3]);
+        }
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+        }
+        crc = (uint32_t)crc64;
+
+        // Tail bytes
+        for (; size > 0; --size)
+            crc = _mm_crc32_u8(crc, *data++);
+        return crc;
+    }
+#endif
+
+#if defined(CRC32C_ARM64)
+    uint32_t update_arm64(uint32_t crc, const uint8_t* data, uint64_t size)
+    {
+        for (; size > 0 && ((uintptr_t)data & 7) != 0; --size)
+            crc = __crc32cb(crc, *data++);
+        for (; size >= 8; size -= 8, data += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data, sizeof(word));
+            crc = __crc32cd(crc, word);
+        }
+        for (; size > 0; --size)
+            crc = __crc32cb(crc, *data++);
+        return crc;
+    }
+#endif
+
+    CRC32CLevel best_level()
+    {
+#if defined(CPU_X64)
+        return cpu_features().sse42 ? CRC32CLevel::SSE42 : CRC32CLevel::Table;
+#elif defined(CRC32C_ARM64)
+        return CRC32CLevel::ARMv8;
+#else
+        return CRC32CLevel::Table;
+#endif
+    }
+
+    uint32_t compute(const void* data, uint64_t size, uint32_t previous, CRC32CLevel level)
+    {
+        const uint8_t* bytes = (const uint8_t*)data;
+        uint32_t crc = ~previous;
+        switch (level)
+        {
+#if defined(CPU_X64)
+            case CRC32CLevel::SSE42:
+                return ~update_sse42(crc, bytes, size);
+#elif defined(CRC32C_ARM64)
+            case CRC32CLevel::ARMv8:
+                return ~update_arm64(crc, bytes, size);
+#endif
+            default:
+                return ~update_scalar(crc, bytes, size);
+        }
+    }
+
+    uint32_t compute(const void* data, uint64_t size, uint32_t previous)
+    {
+        static const CRC32CLevel level = best_level();
+        return compute(data, size, previous, level);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "tools/file_view.h"
+
+// System includes
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FileView::FileView()
+{
+}
+
+FileView::~FileView()
+{
+    close();
+}
+
+bool FileView::open(const char* filePath)
+{
+    close();
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    m_Size = (uint64_t)fileSize.QuadPart;
+
+    // Empty files can't be mapped
+    if (m_Size != 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr)
+        {
+            m_Data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+            // The view keeps the mapping alive
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int file = ::open(filePath, O_RDONLY);
+    if (file < 0)
+        return false;
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0)
+    {
+        ::close(file);
+        return false;
+    }
+    m_Size = (uint64_t)fileStat.st_size;
+
+    // Empty files can't be mapped
+    if (m_Size != 0)
+    {
+        void* mapping = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+        m_Data = mapping != MAP_FAILED ? (const char*)mapping : nullptr;
+    }
+
+    // The mapping keeps the file alive
+    ::close(file);
+#endif
+    m_Open = m_Size == 0 || m_Data != nullptr;
+    if (!m_Open)
+        m_Size = 0;
+    return m_Open;
+}
+
+void FileView::close()
+{
+    if (m_Data != nullptr)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(m_Data);
+#else
+        munmap((void*)m_Data, m_Size);
+#endif
+    }
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Open = false;
+}
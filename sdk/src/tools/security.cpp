@@ -12,11 +12,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <iostream>
+#if !defined(_WIN32)
+#include <signal.h>
+#endif
 
 void __handle_fail(const char* msg, const char* file_name, int)
 {
 	printf("[ERROR] %s\n", msg);
 	printf("Triggered at %s\n", file_name);
+#if defined(_WIN32)
 	__debugbreak();
+#else
+	raise(SIGTRAP);
+#endif
 	exit(-1);
 }
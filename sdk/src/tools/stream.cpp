@@ -6,10 +6,12 @@
  */
 
 // Includes
+#include "tools/crc32c.h"
 #include "tools/stream.h"
 
 // External includes
 #include <string>
+#include <string.h>
 
 void pack_buffer(std::vector<char>& buffer, size_t write_size, const char* data)
 {
@@ -63,4 +65,149 @@ void unpack_type(const char*& stream, std::string& str)
 		memcpy((void*)str.data(), stream, numChars);
 		stream += numChars;
 	}
-}
\ No newline at end of file
+}
+void pack_checksum(std::vector<char>& buffer)
+{
+	const uint32_t checksum = crc32c::compute(buffer.data(), buffer.size());
+	pack_bytes<uint32_t>(buffer, STREAM_CHECKSUM_TAG);
+	pack_bytes<uint32_t>(buffer, checksum);
+}
+
+StreamReader::StreamReader(const char* data, uint64_t size)
+: m_Begin(data)
+, m_Cursor(data)
+, m_End(data + size)
+{
+}
+
+bool StreamReader::fail()
+{
+	m_Failed = true;
+	return false;
+}
+
+bool StreamReader::read_buffer(uint64_t readSize, char* data)
+{
+	if (m_Failed || readSize > remaining())
+		return fail();
+	if (readSize) {
+		memcpy(data, m_Cursor, readSize);
+		m_Cursor += readSize;
+	}
+	return true;
+}
+
+bool StreamReader::skip(uint64_t size)
+{
+	if (m_Failed || size > remaining())
+		return fail();
+	m_Cursor += size;
+	return true;
+}
+
+bool StreamReader::verify_checksum(bool required)
+{
+	// Files written before the trailer existed are accepted unless it is required
+	uint32_t trailer[2] = { 0, 0 };
+	const uint64_t size = (uint64_t)(m_End - m_Begin);
+	if (size >= STREAM_CHECKSUM_TRAILER_SIZE)
+		memcpy(trailer, m_End - STREAM_CHECKSUM_TRAILER_SIZE, STREAM_CHECKSUM_TRAILER_SIZE);
+	if (trailer[0] != STREAM_CHECKSUM_TAG)
+		return required ? fail() : !m_Failed;
+
+	m_End -= STREAM_CHECKSUM_TRAILER_SIZE;
+	if (m_Failed || m_Cursor != m_Begin || crc32c::compute(m_Begin, size - STREAM_CHECKSUM_TRAILER_SIZE) != trailer[1])
+		return fail();
+	return true;
+}
+
+bool StreamReader::verify_checksum(uint64_t size, uint32_t checksum)
+{
+	if (m_Failed || size > remaining() || crc32c::compute(m_Cursor, size) != checksum)
+		return fail();
+	return true;
+}
+
+StreamWriter::StreamWriter()
+{
+}
+
+StreamWriter::~StreamWriter()
+{
+	close();
+}
+
+bool StreamWriter::open(const char* filePath, uint64_t chunkSize)
+{
+	close();
+	m_File = fopen(filePath, "wb");
+	m_Chunk.resize(chunkSize);
+	m_ChunkUsed = 0;
+	m_Size = 0;
+	m_Checksum = 0;
+	m_Failed = m_File == nullptr;
+	return !m_Failed;
+}
+
+bool StreamWriter::write_to_file(const char* data, uint64_t size)
+{
+	if (size) {
+		m_Checksum = crc32c::compute(data, size, m_Checksum);
+		if (fwrite(data, sizeof(char), size, m_File) != size)
+			m_Failed = true;
+	}
+	return !m_Failed;
+}
+
+bool StreamWriter::flush()
+{
+	const bool result = write_to_file(m_Chunk.data(), m_ChunkUsed);
+	m_ChunkUsed = 0;
+	return result;
+}
+
+bool StreamWriter::write_buffer(uint64_t writeSize, const char* data)
+{
+	if (m_Failed || m_File == nullptr)
+		return false;
+	m_Size += writeSize;
+
+	// Small writes are gathered in the chunk
+	if (writeSize <= m_Chunk.size() - m_ChunkUsed) {
+		if (writeSize)
+			memcpy(m_Chunk.data() + m_ChunkUsed, data, writeSize);
+		m_ChunkUsed += writeSize;
+		return true;
+	}
+
+	// Larger ones go straight to the file once the pending bytes are out
+	if (!flush())
+		return false;
+	if (writeSize >= m_Chunk.size())
+		return write_to_file(data, writeSize);
+	memcpy(m_Chunk.data(), data, writeSize);
+	m_ChunkUsed = writeSize;
+	return true;
+}
+
+bool StreamWriter::write_checksum()
+{
+	if (!flush())
+		return false;
+	const uint32_t checksum = m_Checksum;
+	return write_bytes<uint32_t>(STREAM_CHECKSUM_TAG) && write_bytes<uint32_t>(checksum);
+}
+
+bool StreamWriter::close()
+{
+	if (m_File == nullptr)
+		return !m_Failed;
+	flush();
+	if (fclose(m_File) != 0)
+		m_Failed = true;
+	m_File = nullptr;
+
+	// Release the staging memory
+	std::vector<char>().swap(m_Chunk);
+	return !m_Failed;
+}
@@ -18,117 +18,108 @@
 
 GraphicsBuffer load_bc1_to_graphics_buffer(GraphicsDevice device, const char* texturePath, uint3& dimensions, float2& uvOffset)
 {
-	// Vector that will hold our packed mesh 
-	std::vector<char> binaryFile;
-
-	// Read from disk
-	FILE* pFile;
-	pFile = fopen(texturePath, "rb");
-	fseek(pFile, 0L, SEEK_END);
-	size_t fileSize = _ftelli64(pFile);
-	binaryFile.resize(fileSize);
-	_fseeki64(pFile, 0L, SEEK_SET);
-	rewind(pFile);
-	fread(binaryFile.data(), sizeof(char), fileSize, pFile);
-	fclose(pFile);
+	// Map the file, the upload buffer is filled straight from it
+	FileView binaryFile;
+	assert_msg(binaryFile.open(texturePath), "Failed to open texture\n");
 
 	// Read the sizes
-	uint32_t* intArray = (uint32_t*)binaryFile.data();
-	float* floatArray = (float*)binaryFile.data();
-	dimensions.x = intArray[0] * 4;
-	dimensions.y = intArray[1] * 4;
-	dimensions.z = intArray[2];
-	uvOffset.x = floatArray[3];
-	uvOffset.y = floatArray[4];
-
-	uint32_t sizesOffset = sizeof(uint32_t) * 5;
-	dimensions.z = std::max(1, (int32_t)dimensions.z - 2);
-	const uint32_t bufferSize = (uint32_t)binaryFile.size() - sizesOffset;
+	StreamReader reader(binaryFile.data(), binaryFile.size());
+	uint32_t blocksX = 0, blocksY = 0, mipCount = 0;
+	reader.read_bytes(blocksX);
+	reader.read_bytes(blocksY);
+	reader.read_bytes(mipCount);
+	reader.read_bytes(uvOffset.x);
+	reader.read_bytes(uvOffset.y);
+	assert_msg(!reader.failed(), "Invalid texture\n");
+	dimensions.x = blocksX * 4;
+	dimensions.y = blocksY * 4;
+	dimensions.z = std::max(1, (int32_t)mipCount - 2);
+	const uint32_t bufferSize = (uint32_t)reader.remaining();
 
 	// Create the buffer, upload to it and return it
 	GraphicsBuffer textureBuffer = graphics::resources::create_graphics_buffer(device, bufferSize, 4, GraphicsBufferType::Upload);
-	graphics::resources::set_buffer_data(textureBuffer, binaryFile.data() + sizesOffset, bufferSize);
+	graphics::resources::set_buffer_data(textureBuffer, reader.cursor(), bufferSize);
 	return textureBuffer;
 }
 
 GraphicsBuffer load_bc6_to_graphics_buffer(GraphicsDevice device, const char* texturePath, uint32_t& width, uint32_t& height, uint32_t& mipCount)
 {
-	// Vector that will hold our packed mesh 
-	std::vector<char> binaryFile;
-
-	// Read from disk
-	FILE* pFile;
-	pFile = fopen(texturePath, "rb");
-	fseek(pFile, 0L, SEEK_END);
-	size_t fileSize = _ftelli64(pFile);
-	binaryFile.resize(fileSize);
-	_fseeki64(pFile, 0L, SEEK_SET);
-	rewind(pFile);
-	fread(binaryFile.data(), sizeof(char), fileSize, pFile);
-	fclose(pFile);
+	// Map the file, the upload buffer is filled straight from it
+	FileView binaryFile;
+	assert_msg(binaryFile.open(texturePath), "Failed to open texture\n");
 
 	// Read the sizes
-	uint32_t* intArray = (uint32_t*)binaryFile.data();
-	width = intArray[0] * 4;
-	height = intArray[1] * 4;
-	mipCount = intArray[2];
-	uint32_t sizesOffset = sizeof(uint32_t) * 3;
+	StreamReader reader(binaryFile.data(), binaryFile.size());
+	uint32_t blocksX = 0, blocksY = 0;
+	reader.read_bytes(blocksX);
+	reader.read_bytes(blocksY);
+	reader.read_bytes(mipCount);
+	assert_msg(!reader.failed(), "Invalid texture\n");
+	width = blocksX * 4;
+	height = blocksY * 4;
 	mipCount = std::max(1, (int32_t)mipCount - 2);
-	const uint32_t bufferSize = (uint32_t)binaryFile.size() - sizesOffset;
+	const uint32_t bufferSize = (uint32_t)reader.remaining();
 
 	// Create the buffer, upload to it and return it
 	GraphicsBuffer textureBuffer = graphics::resources::create_graphics_buffer(device, bufferSize, 4, GraphicsBufferType::Upload);
-	graphics::resources::set_buffer_data(textureBuffer, binaryFile.data() + sizesOffset, bufferSize);
+	graphics::resources::set_buffer_data(textureBuffer, reader.cursor(), bufferSize);
 	return textureBuffer;
 }
 
 namespace binary_texture
 {
-	void import_binary_texture(const char* path, BinaryTexture& bt)
+	bool map_binary_texture(const FileView& file, BinaryTextureView& btv)
 	{
-		// Vector that will hold our packed mesh 
-		std::vector<char> binaryFile;
-
-		// Read from disk
-		FILE* pFile;
-		pFile = fopen(path, "rb");
-		fseek(pFile, 0L, SEEK_END);
-		size_t fileSize = _ftelli64(pFile);
-		binaryFile.resize(fileSize);
-		_fseeki64(pFile, 0L, SEEK_SET);
-		rewind(pFile);
-		fread(binaryFile.data(), sizeof(char), fileSize, pFile);
-		fclose(pFile);
+		// Files written by export_binary_texture end with a checksum
+		StreamReader reader(file.data(), file.size());
+		if (!reader.verify_checksum())
+			return false;
+
+		// Header and element count of the data
+		reader.read_bytes(btv.width);
+		reader.read_bytes(btv.height);
+		reader.read_bytes(btv.depth);
+		reader.read_bytes(btv.mipCount);
+		reader.read_bytes(btv.format);
+		reader.read_bytes(btv.type);
+		size_t dataSize = 0;
+		reader.read_bytes(dataSize);
+		return reader.map_span(dataSize, btv.data);
+	}
 
-		// Pack the structure in a buffer
-		const char* binaryPtr = binaryFile.data();
-		unpack_bytes(binaryPtr, bt.width);
-		unpack_bytes(binaryPtr, bt.height);
-		unpack_bytes(binaryPtr, bt.depth);
-		unpack_bytes(binaryPtr, bt.mipCount);
-		unpack_bytes(binaryPtr, bt.format);
-		unpack_bytes(binaryPtr, bt.type);
-		unpack_vector_bytes(binaryPtr, bt.data);
+	void import_binary_texture(const char* path, BinaryTexture& bt)
+	{
+		// Map the file
+		FileView binaryFile;
+		assert_msg(binaryFile.open(path), "Failed to open binary texture\n");
+		BinaryTextureView btv;
+		assert_msg(map_binary_texture(binaryFile, btv), "Invalid binary texture\n");
+
+		// Single copy to the owned structure
+		bt.width = btv.width;
+		bt.height = btv.height;
+		bt.depth = btv.depth;
+		bt.mipCount = btv.mipCount;
+		bt.format = btv.format;
+		bt.type = btv.type;
+		bt.data.assign(btv.data.begin(), btv.data.end());
 	}
 
 	void export_binary_texture(const BinaryTexture& bt, const char* path)
 	{
-		// Vector that will hold our packed mesh 
-		std::vector<char> binaryFile;
+		// Streamed to disk, the texels are not copied
+		StreamWriter writer;
+		assert_msg(writer.open(path), "Failed to create binary texture\n");
 
 		// Per-tetra data
-		pack_bytes(binaryFile, bt.width);
-		pack_bytes(binaryFile, bt.height);
-		pack_bytes(binaryFile, bt.depth);
-		pack_bytes(binaryFile, bt.mipCount);
-		pack_bytes(binaryFile, bt.format);
-		pack_bytes(binaryFile, bt.type);
-		pack_vector_bytes(binaryFile, bt.data);
-
-		// Write to disk
-		FILE* pFile;
-		pFile = fopen(path, "wb");
-		fwrite(binaryFile.data(), sizeof(char), binaryFile.size(), pFile);
-		fclose(pFile);
+		writer.write_bytes(bt.width);
+		writer.write_bytes(bt.height);
+		writer.write_bytes(bt.depth);
+		writer.write_bytes(bt.mipCount);
+		writer.write_bytes(bt.format);
+		writer.write_bytes(bt.type);
+		writer.write_vector_bytes(bt.data);
+		writer.write_checksum();
+		assert_msg(writer.close(), "Failed to write binary texture\n");
 	}
 }
\ No newline at end of file
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Includes
+#include "graphics/backend.h"
+#include "tools/security.h"
+#include "tools/upload_manager.h"
+
+// System includes
+#include <string.h>
+
+#define CONVERT_KERNEL_WORKGROUP_SIZE 1024
+
+UploadManager::UploadManager()
+{
+}
+
+UploadManager::~UploadManager()
+{
+}
+
+void UploadManager::initialize(GraphicsDevice device, CommandQueue cmdQ, uint64_t ringSize)
+{
+	// The buffer copies take 32 bit offsets
+	assert_msg(ringSize > 0 && ringSize <= UINT32_MAX, "Invalid upload ring size\n");
+	m_Device = device;
+	m_CmdQueue = cmdQ;
+
+	// Command buffers and fence of the batches
+	for (uint32_t cmdIdx = 0; cmdIdx < UPLOAD_COMMAND_BUFFER_COUNT; ++cmdIdx)
+		m_FreeCmdBuffers.push_back(graphics::command_buffer::create_command_buffer(m_Device));
+	m_CmdBuffer = 0;
+	m_Fence = graphics::fence::create_fence(m_Device);
+	m_FenceValue = 0;
+
+	// Staging ring, mapped for the lifetime of the manager
+	m_RingSize = ringSize;
+	m_RingBuffer = graphics::resources::create_graphics_buffer(m_Device, m_RingSize, sizeof(uint32_t), GraphicsBufferType::Upload);
+	m_RingData = graphics::resources::allocate_cpu_buffer(m_RingBuffer);
+	m_RingHead = 0;
+	m_RingTail = 0;
+	m_Recording = false;
+}
+
+void UploadManager::release()
+{
+	// Nothing can be in flight when the resources are destroyed
+	flush();
+
+	graphics::resources::release_cpu_buffer(m_RingBuffer);
+	graphics::resources::destroy_graphics_buffer(m_RingBuffer);
+	graphics::fence::destroy_fence(m_Fence);
+	for (CommandBuffer cmdBuffer : m_FreeCmdBuffers)
+		graphics::command_buffer::destroy_command_buffer(cmdBuffer);
+	m_FreeCmdBuffers.clear();
+	m_RingData = nullptr;
+}
+
+void UploadManager::retire_batches(bool waitOldest)
+{
+	if (waitOldest && !m_InFlightBatches.empty())
+		graphics::fence::wait_value(m_Fence, m_InFlightBatches.front().fenceValue);
+
+	// The batches complete in submission order
+	const uint64_t completedValue = graphics::fence::get_value(m_Fence);
+	while (!m_InFlightBatches.empty() && m_InFlightBatches.front().fenceValue <= completedValue)
+	{
+		UploadBatch& batch = m_InFlightBatches.front();
+		m_RingTail = batch.ringEnd;
+		m_FreeCmdBuffers.push_back(batch.cmdBuffer);
+		for (GraphicsBuffer transientBuffer : batch.transientBuffers)
+			graphics::resources::destroy_graphics_buffer(transientBuffer);
+		m_InFlightBatches.pop_front();
+	}
+}
+
+void UploadManager::begin_batch()
+{
+	if (m_Recording)
+		return;
+
+	// Reuse the command buffer of a completed batch, waiting for the oldest one if they are all in flight
+	retire_batches(false);
+	if (m_FreeCmdBuffers.empty())
+		retire_batches(true);
+	m_CmdBuffer = m_FreeCmdBuffers.back();
+	m_FreeCmdBuffers.pop_back();
+	graphics::command_buffer::reset(m_CmdBuffer);
+	m_Recording = true;
+}
+
+GraphicsBuffer UploadManager::allocate(uint64_t size, uint64_t& offset)
+{
+	// Too large for the ring, the dedicated buffer lives as long as the batch
+	if (size > m_RingSize)
+	{
+		GraphicsBuffer uploadBuffer = graphics::resources::create_graphics_buffer(m_Device, size, sizeof(uint32_t), GraphicsBufferType::Upload);
+		m_CurrentBatch.transientBuffers.push_back(uploadBuffer);
+		offset = 0;
+		return uploadBuffer;
+	}
+
+	while (true)
+	{
+		// Nothing staged, restart from the beginning of the ring
+		if (m_RingHead == m_RingTail && m_InFlightBatches.empty())
+			m_RingHead = m_RingTail = 0;
+
+		// A range never wraps, the end of the ring is skipped if it doesn't fit before it
+		uint64_t start = (m_RingHead + UPLOAD_RING_ALIGNMENT - 1) / UPLOAD_RING_ALIGNMENT * UPLOAD_RING_ALIGNMENT;
+		if (start % m_RingSize + size > m_RingSize)
+			start = (start / m_RingSize + 1) * m_RingSize;
+		if (start + size - m_RingTail <= m_RingSize)
+		{
+			m_RingHead = start + size;
+			offset = start % m_RingSize;
+			return m_RingBuffer;
+		}
+
+		// The ring is full, submit what has been recorded and wait for the oldest batch
+		if (m_InFlightBatches.empty())
+			submit();
+		retire_batches(true);
+	}
+}
+
+GraphicsBuffer UploadManager::stage(const char* cpuBuffer, uint64_t size, uint64_t& offset)
+{
+	GraphicsBuffer stagingBuffer = allocate(size, offset);
+	if (stagingBuffer == m_RingBuffer)
+		memcpy(m_RingData + offset, cpuBuffer, size);
+	else
+		graphics::resources::set_buffer_data(stagingBuffer, cpuBuffer, size);
+	return stagingBuffer;
+}
+
+void UploadManager::upload_buffer(const char* cpuBuffer, uint64_t bufferSize, GraphicsBuffer targetBuffer, uint64_t targetOffset)
+{
+	uint64_t offset = 0;
+	GraphicsBuffer stagingBuffer = stage(cpuBuffer, bufferSize, offset);
+	begin_batch();
+	graphics::command_buffer::copy_graphics_buffer(m_CmdBuffer, stagingBuffer, (uint32_t)offset, targetBuffer, (uint32_t)targetOffset, bufferSize);
+}
+
+void UploadManager::convert_and_upload_buffer(ComputeShader convertCS, const char* cpuBuffer, uint64_t bufferSize, uint32_t elementSize, GraphicsBuffer convertedBuffer, GraphicsBuffer rawBuffer)
+{
+	uint64_t offset = 0;
+	GraphicsBuffer stagingBuffer = stage(cpuBuffer, bufferSize, offset);
+	begin_batch();
+
+	// The conversion reads a whole buffer, the raw one if defined or a transient copy of the staged range
+	GraphicsBuffer inputBuffer = rawBuffer;
+	if (inputBuffer == 0)
+	{
+		inputBuffer = graphics::resources::create_graphics_buffer(m_Device, bufferSize, elementSize, GraphicsBufferType::Default);
+		m_CurrentBatch.transientBuffers.push_back(inputBuffer);
+	}
+	graphics::command_buffer::copy_graphics_buffer(m_CmdBuffer, stagingBuffer, (uint32_t)offset, inputBuffer, 0, bufferSize);
+
+	// Convert
+	const uint64_t numElements = bufferSize / elementSize;
+	graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, convertCS, binding_slot("_InputBuffer"), inputBuffer);
+	graphics::command_buffer::set_compute_shader_buffer(m_CmdBuffer, convertCS, binding_slot("_OutputBufferRW"), convertedBuffer);
+	graphics::command_buffer::dispatch(m_CmdBuffer, convertCS, (uint32_t)((numElements + CONVERT_KERNEL_WORKGROUP_SIZE - 1) / CONVERT_KERNEL_WORKGROUP_SIZE), 1, 1);
+}
+
+void UploadManager::convert_and_upload_matrix(const char* cpuBuffer, uint32_t width, uint32_t height, GraphicsBuffer mainBuffer, GraphicsBuffer optimalBuffer, uint64_t targetOffset)
+{
+	const uint64_t bufferSize = (uint64_t)width * height * sizeof(float);
+	uint64_t offset = 0;
+	GraphicsBuffer stagingBuffer = stage(cpuBuffer, bufferSize, offset);
+	begin_batch();
+
+	// The matrix conversion reads from a default buffer
+	GraphicsBuffer tmpBuffer = graphics::resources::create_graphics_buffer(m_Device, bufferSize, sizeof(float), GraphicsBufferType::Default);
+	m_CurrentBatch.transientBuffers.push_back(tmpBuffer);
+	graphics::command_buffer::copy_graphics_buffer(m_CmdBuffer, stagingBuffer, (uint32_t)offset, tmpBuffer, 0, bufferSize);
+	if (optimalBuffer != 0)
+		graphics::command_buffer::convert_mat_32_to_16(m_CmdBuffer, tmpBuffer, 0, optimalBuffer, targetOffset, width, height, true);
+	if (mainBuffer != 0)
+		graphics::command_buffer::convert_mat_32_to_16(m_CmdBuffer, tmpBuffer, 0, mainBuffer, targetOffset, width, height, false);
+}
+
+void UploadManager::upload_texture(const char* cpuBuffer, uint64_t bufferSize, Texture texture, uint32_t sliceIdx, uint32_t mipIdx)
+{
+	uint64_t offset = 0;
+	GraphicsBuffer stagingBuffer = stage(cpuBuffer, bufferSize, offset);
+	begin_batch();
+	graphics::command_buffer::copy_buffer_into_texture(m_CmdBuffer, stagingBuffer, offset, texture, sliceIdx, mipIdx);
+}
+
+void UploadManager::upload_texture_mips(const char* cpuBuffer, uint64_t bufferSize, uint32_t imageSize, Texture texture, uint32_t sliceIdx)
+{
+	uint64_t offset = 0;
+	GraphicsBuffer stagingBuffer = stage(cpuBuffer, bufferSize, offset);
+	begin_batch();
+	graphics::command_buffer::copy_buffer_into_texture_mips(m_CmdBuffer, stagingBuffer, offset, imageSize, texture, sliceIdx);
+}
+
+void UploadManager::upload_texture_mips(GraphicsBuffer uploadBuffer, uint32_t imageSize, Texture texture, uint32_t sliceIdx)
+{
+	begin_batch();
+	graphics::command_buffer::copy_buffer_into_texture_mips(m_CmdBuffer, uploadBuffer, 0, imageSize, texture, sliceIdx);
+	m_CurrentBatch.transientBuffers.push_back(uploadBuffer);
+}
+
+uint64_t UploadManager::submit()
+{
+	if (!m_Recording)
+		return 0;
+
+	// Execute the batch and signal its completion
+	graphics::command_buffer::close(m_CmdBuffer);
+	graphics::command_queue::execute_command_buffer(m_CmdQueue, m_CmdBuffer);
+	graphics::command_queue::signal(m_CmdQueue, m_Fence, ++m_FenceValue);
+	m_Recording = false;
+
+	// Keep the ring range, the transient buffers and the command buffer until then
+	m_CurrentBatch.fenceValue = m_FenceValue;
+	m_CurrentBatch.ringEnd = m_RingHead;
+	m_CurrentBatch.cmdBuffer = m_CmdBuffer;
+	m_CmdBuffer = 0;
+	m_InFlightBatches.push_back(std::move(m_CurrentBatch));
+	m_CurrentBatch = UploadBatch();
+	return m_FenceValue;
+}
+
+void UploadManager::flush()
+{
+	submit();
+	graphics::fence::wait_value(m_Fence, m_FenceValue);
+	retire_batches(false);
+}
+
+bool UploadManager::is_complete(uint64_t fenceValue)
+{
+	retire_batches(false);
+	return graphics::fence::get_value(m_Fence) >= fenceValue;
+}
@@ -35,7 +35,8 @@ cbuffer _GlobalCB : register(GLOBAL_CB_BINDING_SLOT)
 
     // Filtering
     float _EnableFiltering;
-    float2 _PaddingGB0;
+    // Key frames interpolated by the skinning
+    uint2 _AnimationFrames;
     uint32_t _FrameIndex;
     
     // Sun direction
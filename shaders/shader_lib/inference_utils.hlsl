@@ -11,6 +11,11 @@
 // DXC Includes
 #include "shader_lib/linalg.h"
 
+// Outputs of the last layer that are evaluated (bit c for channel c), the others are set to zero
+#if !defined(MLP_CHANNEL_MASK)
+#define MLP_CHANNEL_MASK 0xFFFFFFFF
+#endif
+
 // Resources
 StructuredBuffer<float2> _UVOffsetBuffer: register(UV_OFFSET_BUFFER_BINDING);
 
@@ -23,6 +28,16 @@ ByteAddressBuffer _MLPBias1Buffer: register(WEIGHT_1_BIAS_BINDING);
 
 ByteAddressBuffer _MLPWeight2Buffer: register(WEIGHT_2_BUFFER_BINDING);
 ByteAddressBuffer _MLPBias2Buffer: register(WEIGHT_2_BIAS_BINDING);
+#elif defined(MLP_INT8_WEIGHTS)
+// Per set: scales (float), zero points (int) and the int8 weights packed by 4
+StructuredBuffer<uint> _MLPWeight0Buffer: register(WEIGHT_0_BUFFER_BINDING);
+StructuredBuffer<float16_t> _MLPBias0Buffer: register(WEIGHT_0_BIAS_BINDING);
+
+StructuredBuffer<uint> _MLPWeight1Buffer: register(WEIGHT_1_BUFFER_BINDING);
+StructuredBuffer<float16_t> _MLPBias1Buffer: register(WEIGHT_1_BIAS_BINDING);
+
+StructuredBuffer<uint> _MLPWeight2Buffer: register(WEIGHT_2_BUFFER_BINDING);
+StructuredBuffer<float16_t> _MLPBias2Buffer: register(WEIGHT_2_BIAS_BINDING);
 #else
 StructuredBuffer<float16_t> _MLPWeight0Buffer: register(WEIGHT_0_BUFFER_BINDING);
 StructuredBuffer<float16_t> _MLPBias0Buffer: register(WEIGHT_0_BIAS_BINDING);
@@ -35,14 +50,71 @@ StructuredBuffer<float16_t> _MLPBias2Buffer: register(WEIGHT_2_BIAS_BINDING);
 #endif
 
 #if defined(LS_BC1_COMPRESSION)
+#if defined(MLP_FEATURE_TEXTURES)
+	// First layer products baked per latent texel, 4 hidden neurons per slice
+	Texture2DArray<float4> _Feature0Texture : register(FEATURE0_BINDING);
+	Texture2DArray<float4> _Feature1Texture : register(FEATURE1_BINDING);
+	Texture2DArray<float4> _Feature2Texture : register(FEATURE2_BINDING);
+	Texture2DArray<float4> _Feature3Texture : register(FEATURE3_BINDING);
+	// Per set: LOD row of the first layer followed by its bias
+	StructuredBuffer<float16_t> _FeatureLayer0Buffer: register(FEATURE_LAYER0_BUFFER_BINDING);
+#else
 	Texture2DArray<float4> _LS0Texture : register(LS0_BC1_BINDING);
 	Texture2DArray<float4> _LS1Texture : register(LS1_BC1_BINDING);
 	Texture2DArray<float4> _LS2Texture : register(LS2_BC1_BINDING);
 	Texture2DArray<float4> _LS3Texture : register(LS3_BC1_BINDING);
+#endif
 	sampler bc1_linear_clamp_sampler: register(BC1_SAMPLER_BINDING);
 #endif
 
-#if defined(LS_BC1_COMPRESSION)
+#if defined(LS_BC1_COMPRESSION) && defined(MLP_FEATURE_TEXTURES)
+// Number of feature slices of a set
+#define FEATURE_SLICE_COUNT (MLP0_OUT_DIM / 4)
+
+float4 sample_features(uint sliceIdx, float2 uv, float2 uvDX, float2 uvDY, uint matID)
+{
+    // The features of the 4 latent textures add up (each one has its own resolution and UV offset)
+    float slice = float(FEATURE_SLICE_COUNT * matID + sliceIdx);
+    float4 features = _Feature0Texture.SampleGrad(bc1_linear_clamp_sampler, float3(uv.xy + _UVOffsetBuffer[4 * matID], slice), uvDX, uvDY);
+    features += _Feature1Texture.SampleGrad(bc1_linear_clamp_sampler, float3(uv.xy + _UVOffsetBuffer[4 * matID + 1], slice), uvDX, uvDY);
+    features += _Feature2Texture.SampleGrad(bc1_linear_clamp_sampler, float3(uv.xy + _UVOffsetBuffer[4 * matID + 2], slice), uvDX, uvDY);
+    features += _Feature3Texture.SampleGrad(bc1_linear_clamp_sampler, float3(uv.xy + _UVOffsetBuffer[4 * matID + 3], slice), uvDX, uvDY);
+    return features;
+}
+
+float first_layer_neuron(float feature, float lod, uint neuronIdx, uint matID)
+{
+    // Only the LOD input is left to multiply, then bias and RELU
+    uint layerOffset = 2 * MLP0_OUT_DIM * matID;
+    float acc = fma(lod, _FeatureLayer0Buffer[layerOffset + neuronIdx], feature);
+    acc += _FeatureLayer0Buffer[layerOffset + MLP0_OUT_DIM + neuronIdx];
+    return max(acc, 0.0);
+}
+
+#if defined(COOP_VECTOR_SUPPORTED)
+void sample_feature_textures(out vector<float16_t, MLP0_OUT_DIM> hiddenVector, float2 uv, float2 uvDX, float2 uvDY, float lod, uint matID)
+{
+    [unroll] for (uint32_t s = 0; s < FEATURE_SLICE_COUNT; ++s)
+    {
+        float4 features = sample_features(s, uv, uvDX, uvDY, matID);
+        [unroll] for (uint32_t c = 0; c < 4; ++c)
+            hiddenVector[4 * s + c] = float16_t(first_layer_neuron(features[c], lod, 4 * s + c, matID));
+    }
+}
+#endif
+
+void sample_feature_textures(out float16_t hiddenMemory[MLP0_OUT_DIM], float2 uv, float2 uvDX, float2 uvDY, float lod, uint matID)
+{
+    [unroll] for (uint32_t s = 0; s < FEATURE_SLICE_COUNT; ++s)
+    {
+        float4 features = sample_features(s, uv, uvDX, uvDY, matID);
+        [unroll] for (uint32_t c = 0; c < 4; ++c)
+            hiddenMemory[4 * s + c] = float16_t(first_layer_neuron(features[c], lod, 4 * s + c, matID));
+    }
+}
+#endif
+
+#if defined(LS_BC1_COMPRESSION) && !defined(MLP_FEATURE_TEXTURES)
 #if defined(COOP_VECTOR_SUPPORTED)
 void sample_latent_space_bc1(out vector<float16_t, 16> coopVector, float2 uv, float2 uvDX, float2 uvDY, uint matID)
 {
@@ -101,47 +173,126 @@ void sample_latent_space_bc1(out float16_t initialMemory[16], float2 uv, float2
 #endif
 
 #if defined(COOP_VECTOR_SUPPORTED)
-void mlp_evaluation(inout vector<float16_t, MLP0_IN_DIM> inOutVec, uint matID)
+// Last two layers, from the output of the first one (after RELU)
+void mlp_evaluation_hidden(vector<float16_t, MLP0_OUT_DIM> hiddenVector, inout vector<float16_t, MLP0_IN_DIM> inOutVec, uint matID)
 {
-    // First layer
-    dx::linalg::MatrixRef<dx::linalg::DATA_TYPE_FLOAT16, MLP0_OUT_DIM, MLP0_IN_DIM, dx::linalg::MATRIX_LAYOUT_MUL_OPTIMAL> WeightMatrix0 = {_MLPWeight0Buffer, (MLP0_IN_DIM * MLP0_OUT_DIM) * matID * 2, 0};
-    dx::linalg::VectorRef<dx::linalg::DATA_TYPE_FLOAT16> BiasVector0 = {_MLPBias0Buffer, MLP0_OUT_DIM * matID * 2};
-    vector<float16_t, MLP0_OUT_DIM> tempVector = dx::linalg::MulAdd<float16_t>(WeightMatrix0, dx::linalg::MakeInterpretedVector<dx::linalg::DATA_TYPE_FLOAT16>(inOutVec), BiasVector0);
-    
-    // RELU
-    tempVector = max(tempVector, 0);
-
     // Hidden layer
     dx::linalg::MatrixRef<dx::linalg::DATA_TYPE_FLOAT16, MLP1_OUT_DIM, MLP0_OUT_DIM, dx::linalg::MATRIX_LAYOUT_MUL_OPTIMAL> WeightMatrix1 = {_MLPWeight1Buffer, (MLP0_OUT_DIM * MLP1_OUT_DIM) * matID * 2, 0};
     dx::linalg::VectorRef<dx::linalg::DATA_TYPE_FLOAT16> BiasVector1 = {_MLPBias1Buffer, MLP1_OUT_DIM * matID * 2};
-    tempVector = dx::linalg::MulAdd<float16_t>(WeightMatrix1, dx::linalg::MakeInterpretedVector<dx::linalg::DATA_TYPE_FLOAT16>(tempVector), BiasVector1);
+    vector<float16_t, MLP1_OUT_DIM> tempVector = dx::linalg::MulAdd<float16_t>(WeightMatrix1, dx::linalg::MakeInterpretedVector<dx::linalg::DATA_TYPE_FLOAT16>(hiddenVector), BiasVector1);
     
     // RELU
     tempVector = max(tempVector, 0);
 
-    // Third layer
+    // Third layer (the matrix is opaque in the optimal layout, MLP_CHANNEL_MASK doesn't apply)
     dx::linalg::MatrixRef<dx::linalg::DATA_TYPE_FLOAT16, MLP2_OUT_DIM, MLP1_OUT_DIM, dx::linalg::MATRIX_LAYOUT_MUL_OPTIMAL> WeightMatrix2 = {_MLPWeight2Buffer, (MLP1_OUT_DIM * MLP2_OUT_DIM) * matID * 2, 0};
     dx::linalg::VectorRef<dx::linalg::DATA_TYPE_FLOAT16> BiasVector2 = {_MLPBias2Buffer, MLP2_OUT_DIM * matID * 2};
     inOutVec = dx::linalg::MulAdd<float16_t>(WeightMatrix2, dx::linalg::MakeInterpretedVector<dx::linalg::DATA_TYPE_FLOAT16>(tempVector), BiasVector2);
 }
+
+void mlp_evaluation(inout vector<float16_t, MLP0_IN_DIM> inOutVec, uint matID)
+{
+    // First layer
+    dx::linalg::MatrixRef<dx::linalg::DATA_TYPE_FLOAT16, MLP0_OUT_DIM, MLP0_IN_DIM, dx::linalg::MATRIX_LAYOUT_MUL_OPTIMAL> WeightMatrix0 = {_MLPWeight0Buffer, (MLP0_IN_DIM * MLP0_OUT_DIM) * matID * 2, 0};
+    dx::linalg::VectorRef<dx::linalg::DATA_TYPE_FLOAT16> BiasVector0 = {_MLPBias0Buffer, MLP0_OUT_DIM * matID * 2};
+    vector<float16_t, MLP0_OUT_DIM> tempVector = dx::linalg::MulAdd<float16_t>(WeightMatrix0, dx::linalg::MakeInterpretedVector<dx::linalg::DATA_TYPE_FLOAT16>(inOutVec), BiasVector0);
+    
+    // RELU
+    tempVector = max(tempVector, 0);
+
+    // Remaining layers
+    mlp_evaluation_hidden(tempVector, inOutVec, matID);
+}
 #endif
 
-#if !defined(COOP_VECTOR_SUPPORTED)
+#if !defined(COOP_VECTOR_SUPPORTED) && defined(MLP_INT8_WEIGHTS)
+// Size (in uints) of a layer of one set (see mlp::pack_int8_layer)
+#define MLP_INT8_LAYER_SIZE(IN_DIM, OUT_DIM) (2 * OUT_DIM + (IN_DIM * OUT_DIM) / 4)
+
+float read_int8_weight(StructuredBuffer<uint> weightBuffer, uint layerOffset, uint outDim, uint weightIdx)
+{
+    // Sign extend the byte
+    uint packedWeights = weightBuffer[layerOffset + 2 * outDim + (weightIdx >> 2)];
+    return float(int(packedWeights << (24 - 8 * (weightIdx & 3))) >> 24);
+}
+
+// Last two layers, from the output of the first one (after RELU)
+void mlp_evaluation_hidden(float16_t pongMemoryA[MLP0_OUT_DIM], inout float16_t initialMemory[16], uint matID)
+{
+    float inputSum = 0.0;
+    [unroll] for (uint32_t l = 0; l < MLP0_OUT_DIM; ++l)
+        inputSum += pongMemoryA[l];
+
+    // Do the mat mul
+    float16_t pongMemoryB[MLP1_OUT_DIM];
+    uint32_t layerOffset = MLP_INT8_LAYER_SIZE(MLP0_OUT_DIM, MLP1_OUT_DIM) * matID;
+    [unroll]  for (uint32_t x = 0; x < MLP1_OUT_DIM; ++x)
+    {
+        float acc = 0.0;
+        [unroll] for (uint32_t l = 0; l < MLP0_OUT_DIM; ++l)
+            acc = fma(float(pongMemoryA[l]), read_int8_weight(_MLPWeight1Buffer, layerOffset, MLP1_OUT_DIM, MLP1_OUT_DIM * l + x), acc);
+
+        // Dequantize and add the bias
+        acc = asfloat(_MLPWeight1Buffer[layerOffset + x]) * (acc - asint(_MLPWeight1Buffer[layerOffset + MLP1_OUT_DIM + x]) * inputSum);
+        acc += _MLPBias1Buffer[x + MLP1_OUT_DIM * matID];
+        pongMemoryB[x] = float16_t(max(acc, 0.0));
+    }
+
+    inputSum = 0.0;
+    [unroll] for (uint32_t l = 0; l < MLP1_OUT_DIM; ++l)
+        inputSum += pongMemoryB[l];
+
+    layerOffset = MLP_INT8_LAYER_SIZE(MLP1_OUT_DIM, MLP2_OUT_DIM) * matID;
+    [unroll] for (uint32_t x = 0; x < MLP2_OUT_DIM; ++x)
+    {
+        // Resolved at compile time, skipped rows cost nothing
+        if (((MLP_CHANNEL_MASK >> x) & 1) == 0)
+        {
+            initialMemory[x] = float16_t(0.0);
+            continue;
+        }
+
+        // Do the mat mul
+        float acc = 0.0;
+        [unroll] for (uint32_t l = 0; l < MLP1_OUT_DIM; ++l)
+            acc = fma(float(pongMemoryB[l]), read_int8_weight(_MLPWeight2Buffer, layerOffset, MLP2_OUT_DIM, MLP2_OUT_DIM * l + x), acc);
+
+        // Dequantize and add the bias
+        acc = asfloat(_MLPWeight2Buffer[layerOffset + x]) * (acc - asint(_MLPWeight2Buffer[layerOffset + MLP2_OUT_DIM + x]) * inputSum);
+        acc += _MLPBias2Buffer[x + MLP2_OUT_DIM * matID];
+        initialMemory[x] = float16_t(acc);
+    }
+}
+
 void mlp_evaluation(inout float16_t initialMemory[16], uint matID)
 {
+    // Sum(in * (q - zp)) = Sum(in * q) - zp * Sum(in), accumulated in fp32 as the int8 range would overflow fp16
+    float inputSum = 0.0;
+    [unroll] for (uint32_t l = 0; l < MLP0_IN_DIM; ++l)
+        inputSum += initialMemory[l];
+
     // Do the mat mul
     float16_t pongMemoryA[MLP0_OUT_DIM];
+    uint32_t layerOffset = MLP_INT8_LAYER_SIZE(MLP0_IN_DIM, MLP0_OUT_DIM) * matID;
     [unroll] for (uint32_t x = 0; x < MLP0_OUT_DIM; ++x)
     {
-        float16_t acc = float16_t(0.0);
+        float acc = 0.0;
         [unroll] for (uint32_t l = 0; l < MLP0_IN_DIM; ++l)
-            acc = fma(initialMemory[l], _MLPWeight0Buffer[MLP0_OUT_DIM * l + x + (MLP0_IN_DIM * MLP0_OUT_DIM) * matID], acc);
+            acc = fma(float(initialMemory[l]), read_int8_weight(_MLPWeight0Buffer, layerOffset, MLP0_OUT_DIM, MLP0_OUT_DIM * l + x), acc);
 
-        // Add the bias
+        // Dequantize and add the bias
+        acc = asfloat(_MLPWeight0Buffer[layerOffset + x]) * (acc - asint(_MLPWeight0Buffer[layerOffset + MLP0_OUT_DIM + x]) * inputSum);
         acc += _MLPBias0Buffer[x + MLP0_OUT_DIM * matID];
-        pongMemoryA[x] = max(acc, float16_t(0.0));
+        pongMemoryA[x] = float16_t(max(acc, 0.0));
     }
 
+    // Remaining layers
+    mlp_evaluation_hidden(pongMemoryA, initialMemory, matID);
+}
+#elif !defined(COOP_VECTOR_SUPPORTED)
+// Last two layers, from the output of the first one (after RELU)
+void mlp_evaluation_hidden(float16_t pongMemoryA[MLP0_OUT_DIM], inout float16_t initialMemory[16], uint matID)
+{
     // Do the mat mul
     float16_t pongMemoryB[MLP1_OUT_DIM];
     [unroll]  for (uint32_t x = 0; x < MLP1_OUT_DIM; ++x)
@@ -157,6 +308,13 @@ void mlp_evaluation(inout float16_t initialMemory[16], uint matID)
 
     [unroll] for (uint32_t x = 0; x < MLP2_OUT_DIM; ++x)
     {
+        // Resolved at compile time, skipped rows cost nothing
+        if (((MLP_CHANNEL_MASK >> x) & 1) == 0)
+        {
+            initialMemory[x] = float16_t(0.0);
+            continue;
+        }
+
         // Do the mat mul
         float16_t acc = float16_t(0.0);
         [unroll] for (uint32_t l = 0; l < MLP1_OUT_DIM; ++l)
@@ -167,6 +325,25 @@ void mlp_evaluation(inout float16_t initialMemory[16], uint matID)
         initialMemory[x] = acc;
     }
 }
+
+void mlp_evaluation(inout float16_t initialMemory[16], uint matID)
+{
+    // Do the mat mul
+    float16_t pongMemoryA[MLP0_OUT_DIM];
+    [unroll] for (uint32_t x = 0; x < MLP0_OUT_DIM; ++x)
+    {
+        float16_t acc = float16_t(0.0);
+        [unroll] for (uint32_t l = 0; l < MLP0_IN_DIM; ++l)
+            acc = fma(initialMemory[l], _MLPWeight0Buffer[MLP0_OUT_DIM * l + x + (MLP0_IN_DIM * MLP0_OUT_DIM) * matID], acc);
+
+        // Add the bias
+        acc += _MLPBias0Buffer[x + MLP0_OUT_DIM * matID];
+        pongMemoryA[x] = max(acc, float16_t(0.0));
+    }
+
+    // Remaining layers
+    mlp_evaluation_hidden(pongMemoryA, initialMemory, matID);
+}
 #endif
 
 #endif // INFERENCE_UTILS_HLSL
\ No newline at end of file
@@ -49,6 +49,70 @@ uint mat_id(in VertexData vData)
     return asuint(vData.data2.w);
 }
 
+// Attributes shared by every frame of a compact animation (AnimationBaseVertex)
+struct AnimationBaseVertex
+{
+    float4 data0;
+    float2 data1;
+};
+
+// Inverse of the octahedral mapping, e is in [-1, 1]
+float3 octahedral_decode(float2 e)
+{
+    float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+// Orthonormal basis around a unit vector (Duff et al. 2017)
+void tangent_basis(float3 n, out float3 b1, out float3 b2)
+{
+    float s = n.z >= 0.0 ? 1.0 : -1.0;
+    float a = -1.0 / (s + n.z);
+    float b = n.x * n.y * a;
+    b1 = float3(1.0 + s * n.x * n.x * a, s * b, -s * n.x);
+    b2 = float3(b, s + n.y * n.y * a, -n.y);
+}
+
+// Rebuild a vertex of a compact animation frame, same decoding as mesh::decompress_frame
+VertexData decode_compact_vertex(AnimationBaseVertex baseVertex, uint2 compactVertex, float3 boundsMin, float3 boundsScale)
+{
+    // Quantized position delta (11, 11 and 10 bits)
+    float3 quantized = float3(compactVertex.x & 0x7ff, (compactVertex.x >> 11) & 0x7ff, compactVertex.x >> 22);
+    float3 pos = baseVertex.data0.xyz + boundsMin + quantized * boundsScale;
+
+    // Octahedral normal (2 x 11 bits) and tangent angle around it (10 bits)
+    float2 octNormal = float2(compactVertex.y & 0x7ff, (compactVertex.y >> 11) & 0x7ff) / 2047.0 * 2.0 - 1.0;
+    float3 nrm = octahedral_decode(octNormal);
+    float3 b1, b2;
+    tangent_basis(nrm, b1, b2);
+    float angle = (compactVertex.y >> 22) / 1024.0 * 6.28318530718;
+    float3 tgt = b1 * cos(angle) + b2 * sin(angle);
+
+    VertexData vData;
+    vData.data0 = float4(pos, nrm.x);
+    vData.data1 = float4(nrm.y, nrm.z, tgt.x, tgt.y);
+    vData.data2 = float4(tgt.z, baseVertex.data0.w, baseVertex.data1.x, baseVertex.data1.y);
+    return vData;
+}
+
+// Animated attributes of the mean frame and of the basis vectors of a PCA animation (PCAVertex)
+struct PCAVertex
+{
+    float3 position;
+    float3 normal;
+    float3 tangent;
+};
+
+// Attributes shared by every frame of a PCA animation (AnimationVertexAttributes)
+struct AnimationVertexAttributes
+{
+    float2 texCoord;
+    uint matID;
+};
+
 #if defined(INDEX_BUFFER_BINDING)
 uint3 primitive_indices(uint primitiveIndex)
 {
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Decodes BC1 blocks with every level supported by the host and compares the bits to latent_space::decode_bc1_texel.
+// The endpoint sweep reaches every palette entry of every channel, which covers the reciprocal and FMA division of the AVX2 path.
+
+// Includes
+#include "network/bc1_decoder.h"
+#include "network/latent_space.h"
+#include "tools/cpu_features.h"
+
+// System includes
+#include <random>
+#include <stdio.h>
+#include <string.h>
+
+// Indices 0, 1, 2 and 3 on every row
+#define ALL_PALETTE_ENTRIES 0xE4
+
+static void push_block(std::vector<uint8_t>& blocks, uint16_t c0, uint16_t c1, uint8_t indices)
+{
+    const uint8_t block[8] = { (uint8_t)c0, (uint8_t)(c0 >> 8), (uint8_t)c1, (uint8_t)(c1 >> 8), indices, indices, indices, indices };
+    blocks.insert(blocks.end(), block, block + 8);
+}
+
+static uint16_t pack_565(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static bool check_level(const std::vector<uint8_t>& blocks, BC1DecodeLevel level, const char* levelName)
+{
+    const uint64_t blockCount = blocks.size() / 8;
+    std::vector<float> decoded(blockCount * BC1_DECODED_BLOCK_SIZE);
+    bc1_decoder::decode_blocks(blocks.data(), blockCount, decoded.data(), level);
+    for (uint64_t blockIdx = 0; blockIdx < blockCount; ++blockIdx)
+    {
+        const uint8_t* block = blocks.data() + 8 * blockIdx;
+        const float* decodedBlock = decoded.data() + BC1_DECODED_BLOCK_SIZE * blockIdx;
+        for (uint32_t t = 0; t < 16; ++t)
+        {
+            const float3 texel = latent_space::decode_bc1_texel(block, t & 0x3, t >> 2);
+            const float expected[3] = { texel.x, texel.y, texel.z };
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                if (memcmp(&decodedBlock[16 * c + t], &expected[c], sizeof(float)) != 0)
+                {
+                    printf("%s: block %02X%02X %02X%02X %02X%02X%02X%02X, texel %u, channel %u is %.9g, expected %.9g\n", levelName,
+                        block[1], block[0], block[3], block[2], block[4], block[5], block[6], block[7], t, c, decodedBlock[16 * c + t], expected[c]);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    std::vector<uint8_t> blocks;
+
+    // Every pair of values of each channel, in both modes when the other channels can pick it.
+    // Red decides the mode unless both reds are equal, green then blue break the ties.
+    for (uint32_t v0 = 0; v0 < 32; ++v0)
+    {
+        for (uint32_t v1 = 0; v1 < 32; ++v1)
+        {
+            push_block(blocks, pack_565(v0, 1, 0), pack_565(v1, 0, 0), ALL_PALETTE_ENTRIES);
+            push_block(blocks, pack_565(v0, 0, 0), pack_565(v1, 1, 0), ALL_PALETTE_ENTRIES);
+            push_block(blocks, pack_565(1, 0, v0), pack_565(0, 0, v1), ALL_PALETTE_ENTRIES);
+            push_block(blocks, pack_565(0, 0, v0), pack_565(1, 0, v1), ALL_PALETTE_ENTRIES);
+        }
+    }
+    for (uint32_t v0 = 0; v0 < 64; ++v0)
+    {
+        for (uint32_t v1 = 0; v1 < 64; ++v1)
+        {
+            push_block(blocks, pack_565(1, v0, 0), pack_565(0, v1, 0), ALL_PALETTE_ENTRIES);
+            push_block(blocks, pack_565(0, v0, 0), pack_565(1, v1, 0), ALL_PALETTE_ENTRIES);
+        }
+    }
+
+    // Edge cases: equal endpoints (three color mode), extreme endpoints in both orders, single index blocks
+    const uint16_t endpoints[] = { 0x0000, 0xFFFF, 0x8410, 0x7BEF, 0xF800, 0x07E0, 0x001F };
+    for (uint16_t c0 : endpoints)
+    {
+        for (uint16_t c1 : endpoints)
+        {
+            push_block(blocks, c0, c1, ALL_PALETTE_ENTRIES);
+            for (uint32_t index = 0; index < 4; ++index)
+                push_block(blocks, c0, c1, (uint8_t)(index * 0x55));
+        }
+    }
+
+    // Random blocks
+    std::mt19937 generator(0xbc1);
+    for (uint32_t blockIdx = 0; blockIdx < (1 << 16); ++blockIdx)
+    {
+        for (uint32_t byteIdx = 0; byteIdx < 8; ++byteIdx)
+            blocks.push_back((uint8_t)generator());
+    }
+
+    // Levels supported by the host
+    const CPUFeatures& features = cpu_features();
+    bool success = check_level(blocks, BC1DecodeLevel::Scalar, "Scalar");
+    uint32_t numLevels = 1;
+    if (features.sse42)
+    {
+        success &= check_level(blocks, BC1DecodeLevel::SSE42, "SSE4.2");
+        numLevels++;
+    }
+    if (features.avx2 && features.fma)
+    {
+        success &= check_level(blocks, BC1DecodeLevel::AVX2, "AVX2");
+        numLevels++;
+    }
+
+    printf("Checked %llu blocks with %u decode levels\n", (unsigned long long)(blocks.size() / 8), numLevels);
+    printf("BC1 decoder: %s\n", success ? "passed" : "failed");
+    return success ? 0 : 1;
+}
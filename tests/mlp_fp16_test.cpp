@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the fp16 operations against hand computed roundings, then the batched evaluation of every SIMD level
+// against a per operation evaluation built on mlp_fp16::fma and mlp_fp16::add.
+
+// Includes
+#include "math/operators.h"
+#include "network/mlp_fp16.h"
+#include "tools/cpu_features.h"
+
+// System includes
+#include <random>
+#include <stdio.h>
+#include <string.h>
+
+// Operands and correctly rounded results (fp16 bits)
+struct AddCase
+{
+    float16_t a;
+    float16_t b;
+    float16_t result;
+};
+
+struct FMACase
+{
+    float16_t a;
+    float16_t b;
+    float16_t c;
+    float16_t fused;
+    float16_t separate;
+};
+
+static const AddCase addCases[] = {
+    // Ties to even: 1 + 2^-11 stays at 1, (1 + 2^-10) + 2^-11 goes up, above the tie goes up
+    { 0x3C00, 0x1000, 0x3C00 },
+    { 0x3C01, 0x1000, 0x3C02 },
+    { 0x3C00, 0x1001, 0x3C01 },
+    // Subnormals, the largest one plus the smallest one is the smallest normal, opposite values give +0
+    { 0x0001, 0x0001, 0x0002 },
+    { 0x03FF, 0x0001, 0x0400 },
+    { 0x8001, 0x0001, 0x0000 },
+    // Overflow: 65504 + 16 is the tie between 65504 and 65536 and rounds to infinity, 65504 + 12 doesn't
+    { 0x7BFF, 0x7BFF, 0x7C00 },
+    { 0x7BFF, 0x4C00, 0x7C00 },
+    { 0x7BFF, 0x4A00, 0x7BFF },
+    { 0xFBFF, 0xCC00, 0xFC00 },
+};
+
+static const FMACase fmaCases[] = {
+    // (1 + 3 * 2^-10)^2 - 1, the fused result keeps the 9 * 2^-20 term of the product
+    { 0x3C03, 0x3C03, 0xBC00, 0x1E02, 0x1E00 },
+    // Subnormal products: 2^-25 is the tie between 0 and 2^-24, 1.5 * 2^-24 the one between 2^-24 and 2^-23
+    { 0x0001, 0x3800, 0x0000, 0x0000, 0x0000 },
+    { 0x0003, 0x3800, 0x0000, 0x0002, 0x0002 },
+    // 255.875 * 256 is the largest finite value, 256 * 256 overflows
+    { 0x5BFF, 0x5C00, 0x0000, 0x7BFF, 0x7BFF },
+    { 0x5C00, 0x5C00, 0x0000, 0x7C00, 0x7C00 },
+    // Rounding the fp32 sum to fp16 would round twice and land one ulp below
+    { 0x331B, 0x2CED, 0xBEB6, 0xBEA5, 0xBEA4 },
+    { 0x410C, 0x2FED, 0x5848, 0x584B, 0x584A },
+};
+
+static bool check_operations()
+{
+    bool success = true;
+    for (const AddCase& addCase : addCases)
+    {
+        const float16_t result = mlp_fp16::add(addCase.a, addCase.b);
+        if (result != addCase.result)
+        {
+            printf("add(0x%04X, 0x%04X) = 0x%04X, expected 0x%04X\n", addCase.a, addCase.b, result, addCase.result);
+            success = false;
+        }
+    }
+
+    for (const FMACase& fmaCase : fmaCases)
+    {
+        const float16_t fused = mlp_fp16::fma(fmaCase.a, fmaCase.b, fmaCase.c, FP16MulAdd::Fused);
+        const float16_t separate = mlp_fp16::fma(fmaCase.a, fmaCase.b, fmaCase.c, FP16MulAdd::Separate);
+        if (fused != fmaCase.fused || separate != fmaCase.separate)
+        {
+            printf("fma(0x%04X, 0x%04X, 0x%04X) = 0x%04X fused, 0x%04X separate, expected 0x%04X and 0x%04X\n", fmaCase.a, fmaCase.b, fmaCase.c,
+                fused, separate, fmaCase.fused, fmaCase.separate);
+            success = false;
+        }
+    }
+    return success;
+}
+
+// Random layer in the CPUMLP layout, weights followed by the bias
+static void random_layer(std::mt19937& generator, uint32_t width, uint32_t height, uint32_t& layerWidth, uint32_t& layerHeight, std::vector<float>& buffer)
+{
+    std::uniform_real_distribution<float> distribution(-0.75f, 0.75f);
+    layerWidth = width;
+    layerHeight = height;
+    buffer.resize((size_t)width * height + width);
+    for (float& value : buffer)
+        value = distribution(generator);
+}
+
+// Same order as the shader, every operation is done on fp16 values
+static void evaluate_layer_reference(const float16_t* input, const std::vector<float>& layerBuffer, uint32_t width, uint32_t height, bool relu, float16_t* output, uint32_t batchSize, FP16MulAdd mode)
+{
+    for (uint32_t x = 0; x < width; ++x)
+    {
+        for (uint32_t t = 0; t < batchSize; ++t)
+        {
+            float16_t acc = 0;
+            for (uint32_t l = 0; l < height; ++l)
+                acc = mlp_fp16::fma(input[l * batchSize + t], to_half(layerBuffer[width * l + x]), acc, mode);
+            acc = mlp_fp16::add(acc, to_half(layerBuffer[width * height + x]));
+            output[x * batchSize + t] = relu && !(to_float(acc) > 0.0f) ? 0 : acc;
+        }
+    }
+}
+
+static bool check_batches()
+{
+    // The hidden widths leave partial tiles for every batch size
+    std::mt19937 generator(0x16f);
+    CPUMLP mlp;
+    random_layer(generator, 32, 16, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer);
+    random_layer(generator, 30, 32, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer);
+    random_layer(generator, 13, 30, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer);
+    FP16Network network;
+    mlp_fp16::prepare(mlp, network);
+
+    // Levels supported by the host
+    std::vector<SIMDLevel> levels = { SIMDLevel::Scalar };
+    const CPUFeatures& features = cpu_features();
+    if (features.avx2 && features.fma && features.f16c)
+        levels.push_back(SIMDLevel::AVX2);
+    if (features.avx512 && features.fma && features.f16c)
+        levels.push_back(SIMDLevel::AVX512);
+
+    bool success = true;
+    std::uniform_real_distribution<float> inputDistribution(-1.0f, 1.0f);
+    const uint32_t batchSizes[] = { 8, 16, 32 };
+    for (uint32_t mode = 0; mode < (uint32_t)FP16MulAdd::Count; ++mode)
+    {
+        for (uint32_t batchSize : batchSizes)
+        {
+            for (uint32_t batchIdx = 0; batchIdx < 64; ++batchIdx)
+            {
+                std::vector<float> input(mlp.mlp0Height * batchSize);
+                for (float& value : input)
+                    value = inputDistribution(generator);
+
+                // Reference
+                std::vector<float16_t> inputHalf(input.size()), hidden0(mlp.mlp0Width * batchSize), hidden1(mlp.mlp1Width * batchSize), reference(mlp.mlp2Width * batchSize);
+                for (uint32_t i = 0; i < input.size(); ++i)
+                    inputHalf[i] = to_half(input[i]);
+                evaluate_layer_reference(inputHalf.data(), mlp.mlp0Buffer, mlp.mlp0Width, mlp.mlp0Height, true, hidden0.data(), batchSize, (FP16MulAdd)mode);
+                evaluate_layer_reference(hidden0.data(), mlp.mlp1Buffer, mlp.mlp1Width, mlp.mlp1Height, true, hidden1.data(), batchSize, (FP16MulAdd)mode);
+                evaluate_layer_reference(hidden1.data(), mlp.mlp2Buffer, mlp.mlp2Width, mlp.mlp2Height, false, reference.data(), batchSize, (FP16MulAdd)mode);
+
+                for (SIMDLevel level : levels)
+                {
+                    std::vector<float> scratch(mlp_fp16::scratch_size(network, batchSize)), output(mlp.mlp2Width * batchSize);
+                    mlp_fp16::evaluate_batch(network, input.data(), output.data(), scratch.data(), batchSize, (FP16MulAdd)mode, level);
+                    for (uint32_t i = 0; i < output.size(); ++i)
+                    {
+                        const float expected = to_float(reference[i]);
+                        if (memcmp(&output[i], &expected, sizeof(float)) != 0)
+                        {
+                            printf("Level %u, mode %u, batch size %u: output %u is %.9g, expected %.9g\n", (uint32_t)level, mode, batchSize, i, output[i], expected);
+                            success = false;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    printf("Checked %u SIMD levels\n", (uint32_t)levels.size());
+    return success;
+}
+
+int main()
+{
+    bool success = check_operations();
+    success &= check_batches();
+    printf("FP16 emulation: %s\n", success ? "passed" : "failed");
+    return success ? 0 : 1;
+}
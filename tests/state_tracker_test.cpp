@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Records back to back dispatches on the null backend and checks the calls skipped by the state tracker.
+// Every step resets the statistics, the expected values only cover the commands of the step.
+
+// Includes
+#include "graphics/backend.h"
+#include "imgui/imgui.h"
+#include "null/null_backend.h"
+#include "render_pipeline/tile_classifier.h"
+
+// System includes
+#include <stdio.h>
+
+// Expected skipped calls, in the order of StateStats
+struct ExpectedStats
+{
+    uint64_t pipelineStates;
+    uint64_t rootSignatures;
+    uint64_t descriptorHeaps;
+    uint64_t rootTables;
+    uint64_t tableCopies;
+};
+
+static bool check_step(CommandBuffer cmd, const char* step, const ExpectedStats& expected)
+{
+    const StateStats& stats = graphics::command_buffer::state_statistics(cmd);
+    const bool success = stats.skippedPipelineStates == expected.pipelineStates && stats.skippedRootSignatures == expected.rootSignatures
+        && stats.skippedDescriptorHeaps == expected.descriptorHeaps && stats.skippedRootTables == expected.rootTables && stats.skippedTableCopies == expected.tableCopies;
+    if (!success)
+    {
+        printf("%s: skipped %llu pipelines, %llu root signatures, %llu heaps, %llu tables, %llu table copies. Expected %llu, %llu, %llu, %llu, %llu.\n", step,
+            (unsigned long long)stats.skippedPipelineStates, (unsigned long long)stats.skippedRootSignatures, (unsigned long long)stats.skippedDescriptorHeaps,
+            (unsigned long long)stats.skippedRootTables, (unsigned long long)stats.skippedTableCopies,
+            (unsigned long long)expected.pipelineStates, (unsigned long long)expected.rootSignatures, (unsigned long long)expected.descriptorHeaps,
+            (unsigned long long)expected.rootTables, (unsigned long long)expected.tableCopies);
+    }
+    graphics::command_buffer::reset_state_statistics(cmd);
+    return success;
+}
+
+int main()
+{
+    // Null device
+    graphics::setup_graphics_api(GraphicsAPI::Null);
+    GraphicsDevice device = graphics::device::create_graphics_device();
+    RenderWindow window = graphics::window::create_window(device, 0, 256, 256);
+    CommandQueue cmdQueue = graphics::command_queue::create_command_queue(device);
+    CommandBuffer cmd = graphics::command_buffer::create_command_buffer(device);
+    CommandBuffer otherCmd = graphics::command_buffer::create_command_buffer(device);
+    graphics::imgui::initialize_imgui(device, window, TextureFormat::R8G8B8A8_UNorm);
+
+    // Resources
+    ConstantBuffer globalCB = graphics::resources::create_constant_buffer(device, 256, ConstantBufferType::Mixed);
+    GraphicsBuffer bufferA = graphics::resources::create_graphics_buffer(device, 256, 4);
+    GraphicsBuffer bufferB = graphics::resources::create_graphics_buffer(device, 256, 4);
+    TextureDescriptor descriptor;
+    descriptor.type = TextureType::Tex2D;
+    descriptor.width = 256;
+    descriptor.height = 256;
+    descriptor.depth = 1;
+    descriptor.mipCount = 1;
+    descriptor.isUAV = true;
+    descriptor.format = TextureFormat::R32_UInt;
+    RenderTexture visibilityBuffer = graphics::resources::create_render_texture(device, descriptor);
+
+    // Shaders, nothing is compiled by the null backend
+    ComputeShaderDescriptor csd;
+    csd.filename = "ResetCS.compute";
+    ComputeShader resetCS = graphics::compute_shader::create_compute_shader(device, csd);
+    csd.filename = "ClassifyCS.compute";
+    ComputeShader classifyCS = graphics::compute_shader::create_compute_shader(device, csd);
+    GraphicsPipelineDescriptor gpd;
+    gpd.filename = "UberPost.graphics";
+    GraphicsPipeline uberPostGP = graphics::graphics_pipeline::create_graphics_pipeline(device, gpd);
+
+    bool success = true;
+    graphics::command_buffer::reset(cmd);
+
+    // First dispatch of the recording, everything is set
+    graphics::command_buffer::set_compute_shader_cbuffer(cmd, resetCS, binding_slot("_GlobalCB"), globalCB);
+    graphics::command_buffer::set_compute_shader_buffer(cmd, resetCS, binding_slot("_TileBufferRW"), bufferA);
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "First dispatch", { 0, 0, 0, 0, 0 });
+
+    // Same shader without new bindings, direct and indirect
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    graphics::command_buffer::dispatch_indirect(cmd, resetCS, bufferB);
+    success &= check_step(cmd, "Back to back dispatches", { 2, 2, 2, 8, 2 });
+
+    // Binding the same resources again doesn't dirty the tables
+    graphics::command_buffer::set_compute_shader_cbuffer(cmd, resetCS, binding_slot("_GlobalCB"), globalCB);
+    graphics::command_buffer::set_compute_shader_buffer(cmd, resetCS, binding_slot("_TileBufferRW"), bufferA);
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "Identical bindings", { 1, 1, 1, 4, 1 });
+
+    // A new resource requires a new range and new tables
+    graphics::command_buffer::set_compute_shader_buffer(cmd, resetCS, binding_slot("_TileBufferRW"), bufferB);
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "Changed binding", { 1, 1, 1, 0, 0 });
+
+    // Another shader, only the heaps are kept
+    graphics::command_buffer::set_compute_shader_render_texture(cmd, classifyCS, binding_slot("_VisibilityBuffer"), visibilityBuffer);
+    graphics::command_buffer::dispatch(cmd, classifyCS, 8, 8, 1);
+    success &= check_step(cmd, "Other shader", { 0, 0, 1, 0, 0 });
+
+    // Back to the first shader, its range is reused but the root signature change invalidated the tables
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "Root signature change", { 0, 0, 1, 0, 1 });
+
+    // The graphics root signature and tables are separate from the compute ones
+    graphics::command_buffer::set_graphics_pipeline_cbuffer(cmd, uberPostGP, binding_slot("_GlobalCB"), globalCB);
+    graphics::command_buffer::draw_procedural(cmd, uberPostGP, 1, 1);
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "Graphics pipeline in between", { 0, 1, 2, 4, 1 });
+
+    // The imgui pass replaces the heaps, everything is set again but the range of the recording stays valid
+    graphics::imgui::start_frame();
+    graphics::imgui::end_frame();
+    graphics::imgui::draw_frame(cmd, visibilityBuffer);
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "Heap change", { 0, 0, 0, 0, 1 });
+
+    // The ranges of a recording aren't reused by the next one, nor by another command buffer
+    graphics::command_buffer::close(cmd);
+    graphics::command_queue::execute_command_buffer(cmdQueue, cmd);
+    graphics::command_buffer::reset(otherCmd);
+    graphics::command_buffer::dispatch(otherCmd, resetCS, 1, 1, 1);
+    success &= check_step(otherCmd, "Other command buffer", { 0, 0, 0, 0, 0 });
+    graphics::command_buffer::close(otherCmd);
+    graphics::command_buffer::reset(cmd);
+    graphics::command_buffer::dispatch(cmd, resetCS, 1, 1, 1);
+    success &= check_step(cmd, "New recording", { 0, 0, 0, 0, 0 });
+    graphics::command_buffer::close(cmd);
+
+    // Two classifications in a row, the second one reuses the tables of every dispatch of the first
+    {
+        TileClassifier classifier;
+        classifier.initialize(device, { 32, 64 }, 1);
+        classifier.reload_shaders("shaders");
+
+        graphics::command_buffer::reset(cmd);
+        classifier.classify(cmd, globalCB, visibilityBuffer, bufferA, bufferB);
+        graphics::command_buffer::reset_state_statistics(cmd);
+        const uint64_t firstDispatches = null_backend::device::statistics(device).numCommands[(uint32_t)NullCommandType::Dispatch];
+        classifier.classify(cmd, globalCB, visibilityBuffer, bufferA, bufferB);
+        const uint64_t numDispatches = null_backend::device::statistics(device).numCommands[(uint32_t)NullCommandType::Dispatch] - firstDispatches;
+        const StateStats& stats = graphics::command_buffer::state_statistics(cmd);
+        if (numDispatches == 0 || stats.skippedTableCopies != numDispatches || stats.skippedDescriptorHeaps != numDispatches)
+        {
+            printf("Repeated classification: %llu dispatches, %llu table copies and %llu heaps skipped.\n", (unsigned long long)numDispatches,
+                (unsigned long long)stats.skippedTableCopies, (unsigned long long)stats.skippedDescriptorHeaps);
+            success = false;
+        }
+        graphics::command_buffer::close(cmd);
+        classifier.release();
+    }
+
+    // Release
+    graphics::graphics_pipeline::destroy_graphics_pipeline(uberPostGP);
+    graphics::compute_shader::destroy_compute_shader(classifyCS);
+    graphics::compute_shader::destroy_compute_shader(resetCS);
+    graphics::resources::destroy_render_texture(visibilityBuffer);
+    graphics::resources::destroy_graphics_buffer(bufferB);
+    graphics::resources::destroy_graphics_buffer(bufferA);
+    graphics::resources::destroy_constant_buffer(globalCB);
+    graphics::imgui::release_imgui();
+    graphics::command_buffer::destroy_command_buffer(otherCmd);
+    graphics::command_buffer::destroy_command_buffer(cmd);
+    graphics::command_queue::destroy_command_queue(cmdQueue);
+    graphics::window::destroy_window(window);
+    graphics::device::destroy_graphics_device(device);
+
+    printf("State tracker: %s\n", success ? "passed" : "failed");
+    return success ? 0 : 1;
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the CRC32C implementations against the known answer and each other, the StreamWriter output and its checksum
+// trailer against the pack functions, then that StreamReader rejects truncated streams, flipped bits and oversized vectors.
+
+// Includes
+#include "tools/crc32c.h"
+#include "tools/file_view.h"
+#include "tools/stream.h"
+
+// System includes
+#include <filesystem>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+
+// Small enough for the writes of the test to cross chunk boundaries and to bypass the chunk
+#define TEST_CHUNK_SIZE 64
+
+// Check value of the Castagnoli polynomial
+#define CRC32C_CHECK_VALUE 0xE3069283
+
+static const char* level_name(CRC32CLevel level)
+{
+    switch (level)
+    {
+        case CRC32CLevel::SSE42:
+            return "SSE4.2";
+        case CRC32CLevel::ARMv8:
+            return "ARMv8";
+        default:
+            return "Table";
+    }
+}
+
+static bool check_crc32c()
+{
+    // Levels supported by the host, the table is always available
+    std::vector<CRC32CLevel> levels = { CRC32CLevel::Table };
+    if (crc32c::best_level() != CRC32CLevel::Table)
+        levels.push_back(crc32c::best_level());
+
+    std::mt19937 generator(0xc3c);
+    std::vector<uint8_t> data(1024);
+    for (uint8_t& byte : data)
+        byte = (uint8_t)generator();
+
+    bool success = true;
+    for (CRC32CLevel level : levels)
+    {
+        const uint32_t check = crc32c::compute("123456789", 9, 0, level);
+        if (check != CRC32C_CHECK_VALUE)
+        {
+            printf("%s: CRC32C of \"123456789\" is 0x%08X, expected 0x%08X\n", level_name(level), check, CRC32C_CHECK_VALUE);
+            success = false;
+        }
+
+        // Every alignment and tail length, in one piece and in two pieces
+        for (uint32_t offset = 0; offset < 8; ++offset)
+        {
+            for (uint32_t size = 0; size < 80; ++size)
+            {
+                const uint8_t* bytes = data.data() + offset;
+                const uint32_t expected = crc32c::compute(bytes, size, 0, CRC32CLevel::Table);
+                const uint32_t whole = crc32c::compute(bytes, size, 0, level);
+                const uint32_t split = crc32c::compute(bytes + size / 3, size - size / 3, crc32c::compute(bytes, size / 3, 0, level), level);
+                if (whole != expected || split != expected)
+                {
+                    printf("%s: CRC32C of %u bytes at offset %u is 0x%08X (0x%08X in two pieces), expected 0x%08X\n", level_name(level), size, offset, whole, split, expected);
+                    success = false;
+                }
+            }
+        }
+    }
+    printf("Checked %u CRC32C levels\n", (uint32_t)levels.size());
+    return success;
+}
+
+// Content of the test stream
+struct StreamContent
+{
+    uint32_t tag = 0;
+    std::vector<float> values;
+    std::vector<char> bytes;
+    uint64_t last = 0;
+};
+
+static void build_content(StreamContent& content)
+{
+    std::mt19937 generator(0x57e);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    content.tag = 0x54534554;
+    content.values.resize(37);
+    for (float& value : content.values)
+        value = distribution(generator);
+    content.bytes.resize(3 * TEST_CHUNK_SIZE + 5);
+    for (char& byte : content.bytes)
+        byte = (char)generator();
+    content.last = 0x0123456789ABCDEF;
+}
+
+static bool read_content(StreamReader& reader, const StreamContent& expected, StreamContent& content)
+{
+    content.bytes.resize(expected.bytes.size());
+    return reader.read_bytes(content.tag)
+        && reader.read_vector_bytes(content.values)
+        && reader.read_buffer(content.bytes.size(), content.bytes.data())
+        && reader.read_bytes(content.last);
+}
+
+static bool same_content(const StreamContent& a, const StreamContent& b)
+{
+    return a.tag == b.tag && a.values == b.values && a.bytes == b.bytes && a.last == b.last;
+}
+
+static bool check_streams(const std::string& filePath)
+{
+    StreamContent content;
+    build_content(content);
+
+    // Reference, in memory
+    std::vector<char> buffer;
+    pack_bytes(buffer, content.tag);
+    pack_vector_bytes(buffer, content.values);
+    pack_buffer(buffer, content.bytes.size(), content.bytes.data());
+    pack_bytes(buffer, content.last);
+    const uint64_t payloadSize = buffer.size();
+    pack_checksum(buffer);
+
+    // Same stream through the writer
+    StreamWriter writer;
+    bool success = writer.open(filePath.c_str(), TEST_CHUNK_SIZE)
+        && writer.write_bytes(content.tag)
+        && writer.write_vector_bytes(content.values)
+        && writer.write_buffer(content.bytes.size(), content.bytes.data())
+        && writer.write_bytes(content.last)
+        && writer.size() == payloadSize
+        && writer.write_checksum()
+        && writer.close();
+    if (!success)
+    {
+        printf("Failed to write %s\n", filePath.c_str());
+        return false;
+    }
+
+    FileView view;
+    if (!view.open(filePath.c_str()) || view.size() != buffer.size() || memcmp(view.data(), buffer.data(), buffer.size()) != 0)
+    {
+        printf("The writer output doesn't match the packed stream\n");
+        return false;
+    }
+    view.close();
+
+    // Round trip, the trailer is checked and removed
+    {
+        StreamReader reader(buffer.data(), buffer.size());
+        StreamContent readBack;
+        if (!reader.verify_checksum(true) || !read_content(reader, content, readBack) || reader.remaining() != 0 || !same_content(readBack, content))
+        {
+            printf("The stream doesn't read back\n");
+            success = false;
+        }
+    }
+
+    // Truncations: the trailer is missing or doesn't match, and without it the reads run out of data
+    for (uint64_t size = 0; size < buffer.size(); ++size)
+    {
+        StreamReader checkedReader(buffer.data(), size);
+        if (checkedReader.verify_checksum(true))
+        {
+            printf("Stream truncated to %llu bytes passed the checksum\n", (unsigned long long)size);
+            success = false;
+        }
+
+        StreamReader reader(buffer.data(), size);
+        StreamContent readBack;
+        if (size < payloadSize && (read_content(reader, content, readBack) || !reader.failed()))
+        {
+            printf("Stream truncated to %llu bytes was read\n", (unsigned long long)size);
+            success = false;
+        }
+    }
+
+    // Every single bit flip
+    for (uint64_t bitIdx = 0; bitIdx < buffer.size() * 8; ++bitIdx)
+    {
+        std::vector<char> corrupted = buffer;
+        corrupted[bitIdx / 8] ^= (char)(1 << (bitIdx % 8));
+        StreamReader reader(corrupted.data(), corrupted.size());
+        if (reader.verify_checksum(true))
+        {
+            printf("Flipping bit %llu passed the checksum\n", (unsigned long long)bitIdx);
+            success = false;
+        }
+    }
+
+    // Vector sizes beyond the stream are rejected before allocating, the failure is sticky
+    // (one element past the end of the stream, counting the trailing uint64_t, then sizes that overflow the byte count)
+    const size_t sizes[] = { content.values.size() + sizeof(uint64_t) / sizeof(float) + 1, SIZE_MAX / sizeof(float) + 1, SIZE_MAX };
+    for (size_t numElements : sizes)
+    {
+        std::vector<char> oversized;
+        pack_bytes(oversized, numElements);
+        pack_buffer(oversized, content.values.size() * sizeof(float), (const char*)content.values.data());
+        pack_bytes(oversized, content.last);
+
+        StreamReader reader(oversized.data(), oversized.size());
+        std::vector<float> values;
+        uint64_t last = 0;
+        if (reader.read_vector_bytes(values) || !values.empty() || reader.read_bytes(last) || !reader.failed())
+        {
+            printf("A vector of %llu elements was read\n", (unsigned long long)numElements);
+            success = false;
+        }
+    }
+    return success;
+}
+
+int main()
+{
+    const std::string filePath = (std::filesystem::temp_directory_path() / "stream_test.bin").string();
+    bool success = check_crc32c();
+    success &= check_streams(filePath);
+    std::filesystem::remove(filePath);
+    printf("Stream: %s\n", success ? "passed" : "failed");
+    return success ? 0 : 1;
+}
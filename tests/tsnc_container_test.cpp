@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Writes synthetic texture sets as a model directory and as .tsnc containers, checks that the container reads back the same
+// MLPs and latent textures, then that a corrupted or truncated table of contents (or payload) is rejected.
+
+// Includes
+#include "math/operators.h"
+#include "network/tsnc_container.h"
+#include "tools/file_view.h"
+#include "tools/stream.h"
+
+// System includes
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+
+// Number of texture sets of the synthetic network
+#define TEST_NUM_SETS 2
+
+// Owns the blocks of the synthetic latent textures
+struct SyntheticNetwork
+{
+    std::vector<CPUMLP> mlpArray;
+    std::vector<CPULatentTexture> latentArray;
+    std::vector<std::vector<uint8_t>> latentData;
+};
+
+static void random_layer(std::mt19937& generator, uint32_t width, uint32_t height, uint32_t& layerWidth, uint32_t& layerHeight, std::vector<float>& buffer)
+{
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    layerWidth = width;
+    layerHeight = height;
+    buffer.resize((size_t)width * height + width);
+    for (float& value : buffer)
+        value = distribution(generator);
+}
+
+static void build_network(SyntheticNetwork& network)
+{
+    // Unaligned dimensions, as in the source files
+    std::mt19937 generator(0x75c);
+    network.mlpArray.resize(TEST_NUM_SETS);
+    network.latentArray.resize(4 * TEST_NUM_SETS);
+    network.latentData.resize(4 * TEST_NUM_SETS);
+    for (uint32_t setIdx = 0; setIdx < TEST_NUM_SETS; ++setIdx)
+    {
+        CPUMLP& mlp = network.mlpArray[setIdx];
+        mlp.nbMlp = 1;
+        mlp.finalChannelCount = 9;
+        mlp.finalBlockWidth = 1;
+        random_layer(generator, 32, 13, mlp.mlp0Width, mlp.mlp0Height, mlp.mlp0Buffer);
+        random_layer(generator, 30, 32, mlp.mlp1Width, mlp.mlp1Height, mlp.mlp1Buffer);
+        random_layer(generator, 9, 30, mlp.mlp2Width, mlp.mlp2Height, mlp.mlp2Buffer);
+
+        // Two textures at full resolution and two at half resolution
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+        {
+            CPULatentTexture& texture = network.latentArray[4 * setIdx + texIdx];
+            std::vector<uint8_t>& data = network.latentData[4 * setIdx + texIdx];
+            texture.width = 64 >> (texIdx / 2);
+            texture.height = 32 >> (texIdx / 2);
+            texture.mipCount = 3;
+            texture.uvOffset = { 0.25f * texIdx, 0.125f * setIdx };
+            data.resize(latent_space::mip_offset(texture, texture.mipCount));
+            for (uint8_t& byte : data)
+                byte = (uint8_t)generator();
+            texture.data = std::span<const uint8_t>(data.data(), data.size());
+        }
+    }
+}
+
+// Same layout as the files of the models folder
+static void write_model_directory(const std::string& modelDir, const SyntheticNetwork& network)
+{
+    for (uint32_t setIdx = 0; setIdx < TEST_NUM_SETS; ++setIdx)
+    {
+        mlp::save_file((modelDir + "/mlp_" + std::to_string(setIdx) + ".bin").c_str(), network.mlpArray[setIdx]);
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+        {
+            // Blocks x, blocks y, mip count (load_bc1 drops the last two) and uv offset, then the blocks
+            const CPULatentTexture& texture = network.latentArray[4 * setIdx + texIdx];
+            StreamWriter writer;
+            writer.open((modelDir + "/tex" + std::to_string(texIdx) + "_" + std::to_string(setIdx) + ".bc1").c_str());
+            writer.write_bytes<uint32_t>(texture.width / 4);
+            writer.write_bytes<uint32_t>(texture.height / 4);
+            writer.write_bytes<uint32_t>(texture.mipCount + 2);
+            writer.write_bytes<float>(texture.uvOffset.x);
+            writer.write_bytes<float>(texture.uvOffset.y);
+            writer.write_buffer(texture.data.size(), (const char*)texture.data.data());
+            writer.close();
+        }
+    }
+}
+
+static bool same_floats(const std::vector<float>& a, const std::vector<float>& b)
+{
+    return a.size() == b.size() && memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+static bool same_mlp(const CPUMLP& a, const CPUMLP& b)
+{
+    bool same = a.weightFormat == b.weightFormat && a.nbMlp == b.nbMlp && a.finalChannelCount == b.finalChannelCount && a.finalBlockWidth == b.finalBlockWidth;
+    same &= a.mlp0Width == b.mlp0Width && a.mlp0Height == b.mlp0Height && same_floats(a.mlp0Buffer, b.mlp0Buffer);
+    same &= a.mlp1Width == b.mlp1Width && a.mlp1Height == b.mlp1Height && same_floats(a.mlp1Buffer, b.mlp1Buffer);
+    same &= a.mlp2Width == b.mlp2Width && a.mlp2Height == b.mlp2Height && same_floats(a.mlp2Buffer, b.mlp2Buffer);
+    if (a.weightFormat == MLPWeightFormat::Int8)
+    {
+        const QuantizedLayer* layersA[3] = { &a.mlp0Int8, &a.mlp1Int8, &a.mlp2Int8 };
+        const QuantizedLayer* layersB[3] = { &b.mlp0Int8, &b.mlp1Int8, &b.mlp2Int8 };
+        for (uint32_t layerIdx = 0; layerIdx < 3; ++layerIdx)
+            same &= layersA[layerIdx]->weights == layersB[layerIdx]->weights && same_floats(layersA[layerIdx]->scale, layersB[layerIdx]->scale) && layersA[layerIdx]->zeroPoint == layersB[layerIdx]->zeroPoint;
+    }
+    return same;
+}
+
+static bool same_latent(const CPULatentTexture& a, const CPULatentTexture& b)
+{
+    return a.width == b.width && a.height == b.height && a.mipCount == b.mipCount && a.uvOffset.x == b.uvOffset.x && a.uvOffset.y == b.uvOffset.y
+        && a.data.size() == b.data.size() && memcmp(a.data.data(), b.data.data(), a.data.size()) == 0;
+}
+
+// Loads the container and compares it to the expected sets
+static bool check_container(const char* containerPath, const std::vector<CPUMLP>& mlpArray, const std::vector<CPULatentTexture>& latentArray, const char* step)
+{
+    std::vector<CPUMLP> loadedMLPs;
+    std::vector<CPULatentTexture> loadedLatents;
+    ContainerHeader header;
+    if (!tsnc_container::load(containerPath, loadedMLPs, loadedLatents, header))
+    {
+        printf("%s: the container was rejected\n", step);
+        return false;
+    }
+
+    bool success = header.numSets == mlpArray.size() && loadedMLPs.size() == mlpArray.size() && loadedLatents.size() == latentArray.size();
+    for (uint32_t setIdx = 0; success && setIdx < mlpArray.size(); ++setIdx)
+    {
+        success &= same_mlp(loadedMLPs[setIdx], mlpArray[setIdx]);
+        for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+            success &= same_latent(loadedLatents[4 * setIdx + texIdx], latentArray[4 * setIdx + texIdx]);
+    }
+
+    // The metadata is computed on the aligned network
+    CPUMLP alignedMLP = mlpArray[0];
+    mlp::align_dimensions(alignedMLP);
+    success &= header.metadata.mlp0InDim == alignedMLP.mlp0Height && header.metadata.mlp2OutDim == alignedMLP.mlp2Width && header.metadata.mip0Resolution == latentArray[0].width;
+    if (!success)
+        printf("%s: the container doesn't match its source\n", step);
+    return success;
+}
+
+static bool is_rejected(const std::string& path, const std::vector<char>& content)
+{
+    {
+        StreamWriter writer;
+        writer.open(path.c_str());
+        writer.write_buffer(content.size(), content.data());
+        writer.close();
+    }
+    std::vector<CPUMLP> mlpArray;
+    std::vector<CPULatentTexture> latentArray;
+    ContainerHeader header;
+    return !tsnc_container::load(path.c_str(), mlpArray, latentArray, header);
+}
+
+static bool check_rejections(const char* containerPath, const std::string& corruptedPath)
+{
+    std::vector<char> content;
+    {
+        FileView file;
+        file.open(containerPath);
+        content.assign(file.data(), file.data() + file.size());
+    }
+    ContainerHeader header;
+    memcpy(&header, content.data(), sizeof(ContainerHeader));
+    std::vector<ContainerEntry> entries(header.entryCount);
+    memcpy(entries.data(), content.data() + sizeof(ContainerHeader), entries.size() * sizeof(ContainerEntry));
+    const uint64_t tocSize = sizeof(ContainerHeader) + entries.size() * sizeof(ContainerEntry);
+    bool success = true;
+
+    // A bit flip anywhere in the header or the table of contents
+    for (uint64_t byteIdx = 0; byteIdx < tocSize; ++byteIdx)
+    {
+        std::vector<char> corrupted = content;
+        corrupted[byteIdx] ^= (char)(1 << (byteIdx % 8));
+        if (!is_rejected(corruptedPath, corrupted))
+        {
+            printf("A bit flip at byte %llu of the table of contents was accepted\n", (unsigned long long)byteIdx);
+            success = false;
+        }
+    }
+
+    // A bit flip in the middle of each payload
+    for (const ContainerEntry& entry : entries)
+    {
+        std::vector<char> corrupted = content;
+        corrupted[entry.offset + entry.size / 2] ^= 0x10;
+        if (!is_rejected(corruptedPath, corrupted))
+        {
+            printf("A bit flip in the payload at %llu was accepted\n", (unsigned long long)entry.offset);
+            success = false;
+        }
+    }
+
+    // Truncations: inside the header, inside the table of contents, inside the first payload and at the end of the last one
+    uint64_t lastEnd = 0;
+    for (const ContainerEntry& entry : entries)
+        lastEnd = std::max(lastEnd, entry.offset + entry.size);
+    const uint64_t truncations[] = { 0, 16, sizeof(ContainerHeader) - 1, sizeof(ContainerHeader), tocSize - 1, entries[0].offset + entries[0].size / 2, lastEnd - 1 };
+    for (uint64_t truncation : truncations)
+    {
+        std::vector<char> truncated(content.begin(), content.begin() + truncation);
+        if (!is_rejected(corruptedPath, truncated))
+        {
+            printf("A container truncated to %llu bytes was accepted\n", (unsigned long long)truncation);
+            success = false;
+        }
+    }
+    return success;
+}
+
+int main()
+{
+    const std::filesystem::path tempDir = std::filesystem::temp_directory_path() / "tsnc_container_test";
+    std::filesystem::create_directories(tempDir);
+    const std::string modelDir = tempDir.string();
+    const std::string containerPath = (tempDir / "network.tsnc").string();
+    const std::string corruptedPath = (tempDir / "corrupted.tsnc").string();
+    bool success = true;
+    {
+        SyntheticNetwork network;
+        build_network(network);
+
+        // Directory layout to container, the result must match both the sources and the directory as the runtime reads it
+        write_model_directory(modelDir, network);
+        tsnc_container::export_model_directory(modelDir, TEST_NUM_SETS, containerPath.c_str(), false);
+        std::vector<CPUMLP> directoryMLPs(TEST_NUM_SETS);
+        std::vector<CPULatentTexture> directoryLatents(4 * TEST_NUM_SETS);
+        for (uint32_t setIdx = 0; setIdx < TEST_NUM_SETS; ++setIdx)
+        {
+            mlp::load_file((modelDir + "/mlp_" + std::to_string(setIdx) + ".bin").c_str(), directoryMLPs[setIdx]);
+            for (uint32_t texIdx = 0; texIdx < 4; ++texIdx)
+                latent_space::load_bc1((modelDir + "/tex" + std::to_string(texIdx) + "_" + std::to_string(setIdx) + ".bc1").c_str(), directoryLatents[4 * setIdx + texIdx]);
+        }
+        success &= check_container(containerPath.c_str(), network.mlpArray, network.latentArray, "Sources");
+        success &= check_container(containerPath.c_str(), directoryMLPs, directoryLatents, "Model directory");
+        directoryLatents.clear();
+        success &= check_rejections(containerPath.c_str(), corruptedPath);
+
+        // fp16 weights, the loaded buffers hold the rounded values
+        tsnc_container::write(containerPath.c_str(), network.mlpArray, network.latentArray, true);
+        std::vector<CPUMLP> halfMLPs = network.mlpArray;
+        for (CPUMLP& mlp : halfMLPs)
+        {
+            for (std::vector<float>* buffer : { &mlp.mlp0Buffer, &mlp.mlp1Buffer, &mlp.mlp2Buffer })
+            {
+                for (float& value : *buffer)
+                    value = to_float(to_half(value));
+            }
+        }
+        success &= check_container(containerPath.c_str(), halfMLPs, network.latentArray, "Half weights");
+
+        // Int8 weights, the odd layer sizes require the padding of the weights
+        std::vector<CPUMLP> int8MLPs = network.mlpArray;
+        for (CPUMLP& mlp : int8MLPs)
+            mlp::quantize_int8(mlp);
+        tsnc_container::write(containerPath.c_str(), int8MLPs, network.latentArray, true);
+        success &= check_container(containerPath.c_str(), int8MLPs, network.latentArray, "Int8 weights");
+        success &= check_rejections(containerPath.c_str(), corruptedPath);
+    }
+    std::filesystem::remove_all(tempDir);
+
+    printf("TSNC container: %s\n", success ? "passed" : "failed");
+    return success ? 0 : 1;
+}